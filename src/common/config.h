@@ -41,14 +41,27 @@ static constexpr int INVALID_TIMESTAMP = -1;                                  //
 static constexpr int INVALID_LSN = -1;                                        // invalid log sequence number
 static constexpr int INVALID_OFFSET = -1;
 static constexpr int HEADER_PAGE_ID = 0;                                      // the header page id
-static constexpr int PAGE_SIZE = 4096;                                        // size of a data page in byte  4KB
+static constexpr int DEFAULT_PAGE_SIZE = 4096;                                // 新建数据库默认的页面大小 4KB
+static constexpr int MAX_PAGE_SIZE = 32768;                                   // 页面大小的上限 32KB
+// size of a data page in byte，创建数据库时选择并记录在db.meta中，打开数据库时由BufferPoolManager::set_page_size设置
+inline int PAGE_SIZE = DEFAULT_PAGE_SIZE;
 // static constexpr int BUFFER_POOL_SIZE = 4;                                      // size of buffer pool 16KB
 // static constexpr int BUFFER_POOL_SIZE = 65536;                                // size of buffer pool 256MB
-static constexpr int BUFFER_POOL_SIZE = 131072;                                // size of buffer pool 512MB
+static constexpr int BUFFER_POOL_SIZE = 131072;                                // default size of buffer pool 512MB, rmdb -b overrides it
 // static constexpr int BUFFER_POOL_SIZE = 262144;                                // size of buffer pool 1GB
 //static constexpr int BUFFER_POOL_SIZE =  262144;
-static constexpr int JOIN_POOL_SIZE = BUFFER_POOL_SIZE/2;
-static constexpr int LOG_BUFFER_SIZE = (1024 * PAGE_SIZE);                    // size of a log buffer in byte
+static constexpr bool BUFFER_POOL_USE_HUGETLB = true;                         // 系统预留了hugetlbfs大页时，帧数据优先使用大页
+static constexpr int BUFFER_POOL_INSTANCES = 16;                              // number of buffer pool shards
+static constexpr size_t BULKREAD_RING_SIZE = 256;                            // 顺序扫描的环形缓冲区大小 1MB
+static constexpr size_t BULKWRITE_RING_SIZE = 4096;                          // 批量写入的环形缓冲区大小 16MB
+static constexpr int BGWRITER_MIN_DELAY_MS = 5;                               // 后台写线程两轮之间的最短间隔
+static constexpr int BGWRITER_MAX_DELAY_MS = 200;                             // 没有脏页需要写回时，间隔逐渐延长到该值
+static constexpr size_t BGWRITER_MIN_LOOKAHEAD = 16;                          // 后台写线程每轮在每个分片至少检查的淘汰候选帧数
+static constexpr size_t BGWRITER_MAX_LOOKAHEAD = 1024;                        // 后台写线程每轮在每个分片最多检查的淘汰候选帧数
+static constexpr double BGWRITER_LOOKAHEAD_MULTIPLIER = 2.0;                  // 每轮检查的候选帧数相对于近期每轮淘汰帧数的倍数
+static constexpr size_t JOIN_POOL_RATIO = 2;                                 // 连接算子最多使用buffer pool的1/JOIN_POOL_RATIO
+static constexpr unsigned IO_QUEUE_DEPTH = 64;                                // 每个线程的异步I/O队列深度
+static constexpr int LOG_BUFFER_SIZE = (1024 * DEFAULT_PAGE_SIZE);            // size of a log buffer in byte，日志记录不包含整个页面，与页面大小无关
 // static constexpr int LOG_BUFFER_SIZE = (1 * PAGE_SIZE);                    // 测试性质的小buffer
 static constexpr int BUCKET_SIZE = 50;                                        // size of extendible hash bucket
 static constexpr int TMP_FD = -2; // 临时使用的fd (不知道会不会有冲突)
@@ -66,7 +79,26 @@ using timestamp_t = int32_t;  // timestamp type, used for transaction concurrenc
 // log file
 static const std::string LOG_FILE_NAME = "db.log";
 
-// replacer
-static const std::string REPLACER_TYPE = "LRU";
+// buffer pool中驻留页面的清单，关闭数据库时写入，打开数据库时据此预读
+static const std::string BUFFER_POOL_MANIFEST_NAME = "buffer_pool.manifest";
+static constexpr int BUFFER_POOL_MANIFEST_INTERVAL_MS = 60000;                // 后台写线程定期更新清单的间隔
+static constexpr size_t PREFETCH_BATCH_PAGES = 4096;                          // 预读时每批按(fd, page_no)排序合并的页面数
+static constexpr int PREFETCH_MAX_READ_PAGES = 64;                            // 预读时一次读取的最大页面数 256KB
+static constexpr int PREFETCH_MAX_GAP_PAGES = 8;                              // 间隔不超过该页数的两个页面合并为一次读取
+static constexpr int PREFETCH_IO_DEPTH = 16;                                  // 预读时同时在途的读取请求数
+static constexpr int READAHEAD_MIN_PAGES = 16;                                // 顺序预读的初始窗口 64KB
+static constexpr int READAHEAD_MAX_PAGES = 256;                               // 顺序预读窗口的上限 1MB，窗口每次预读后翻倍
+static constexpr int READAHEAD_MAX_READ_PAGES = 64;                           // 顺序预读时一次读取的最大页面数 256KB
+static constexpr int READAHEAD_SEQUENTIAL_ACCESSES = 2;                       // 连续访问相邻页面达到该次数后才开始预读
+static constexpr int EXTENT_MIN_PAGES = 256;                                  // 数据文件每次扩展的最小页面数 1MB
+static constexpr int EXTENT_MAX_PAGES = 2048;                                 // 数据文件每次扩展的最大页面数 8MB，扩展量随文件大小增长
+
+// replacer: "LRU"、"CLOCK" 或 "LRUK"
+static const std::string REPLACER_TYPE = "LRUK";
+static constexpr size_t LRUK_REPLACER_K = 2;                                  // LRU-K中的K
+static constexpr size_t LRUK_CORRELATED_PERIOD = 2;                           // 相隔不超过该值(逻辑时钟)的访问视为相关访问
 
 static const std::string DB_META_NAME = "db.meta";
+
+// 表数据文件的zone map在关闭数据库时写入名为"表名 + 后缀"的旁路文件
+static const std::string ZONE_MAP_FILE_SUFFIX = ".zonemap";
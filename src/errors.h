@@ -71,6 +71,13 @@ class InvalidRecordSizeError : public RMDBError {
     InvalidRecordSizeError(int record_size) : RMDBError("Invalid record size: " + std::to_string(record_size)) {}
 };
 
+// 变长格式的记录更新后变长，所在页面中已经没有足够的空间
+class PageFullError : public RMDBError {
+   public:
+    PageFullError(int page_no, int slot_no)
+        : RMDBError("Page " + std::to_string(page_no) + " has no room to grow record in slot " + std::to_string(slot_no)) {}
+};
+
 // IX errors
 class InvalidColLengthError : public RMDBError {
    public:
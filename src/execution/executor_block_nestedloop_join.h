@@ -227,7 +227,7 @@ class BlockNestedLoopJoinExecutor : public AbstractExecutor {
     void init_right_page() {
       right_->beginTuple();
       while(!right_->is_end()) {
-        if(right_buffer_pages_.size()>=JOIN_POOL_SIZE/2) {
+        if(right_buffer_pages_.size()>=bpm_->get_join_pool_size()/2) {
           break;
         }
 
@@ -267,7 +267,7 @@ class BlockNestedLoopJoinExecutor : public AbstractExecutor {
         left_->beginTuple();
         while(!left_->is_end()) {
           // if(bpm_->get_free_size() <= 35) {
-             if(left_buffer_pages_.size()>=JOIN_POOL_SIZE/2) { // 在测试时，可以只用两个buffer page
+             if(left_buffer_pages_.size()>=bpm_->get_join_pool_size()/2) { // 在测试时，可以只用两个buffer page
                 // 已经缓存了足够数量的左侧tuple
                 // 这个35是我随便写的数字，最后给bpm 留个几页防止出什么问题。
                 // 比如 如果不小心调用到了index scan，给b+树的页留个几页。
@@ -297,9 +297,12 @@ class IndexScanExecutor : public AbstractExecutor {
                     context_->lock_mgr_->lock_shared_on_record(context_->txn_, rid_, fh_->GetFd());
                 }
             }
-            rm_ = fh_->get_record(rid_,context_);
-            if(CheckConditions()) {
+            // 直接在页面上判断条件，只有满足条件的记录才复制出来；申请记录锁之前要先释放视图持有的页面
+            RecordView view = fh_->get_record_view(rid_);
+            if(CheckConditions(view.data())) {
                 // 如果条件为真（所有where 通过）
+                rm_ = view.materialize();
+                view.release();
                 if(context_->txn_->get_isolation_level()==IsolationLevel::REPEATABLE_READ) {
                     // 对行上锁
                     if(dml_mode_) {
@@ -336,21 +339,21 @@ class IndexScanExecutor : public AbstractExecutor {
     [[nodiscard]] bool is_end() const override {
         return is_end_;
     }
-    bool CheckConditions() {
+    bool CheckConditions(const char* rec) {
         /**
          * 检查所有条件
          */
-        return std::all_of(conds_.begin(),conds_.end(),[ this](const Condition& condition){
-            return CheckCondition(condition);
+        return std::all_of(conds_.begin(),conds_.end(),[rec, this](const Condition& condition){
+            return CheckCondition(rec,condition);
         });
     }
-    bool CheckCondition(const Condition& condition) {
+    bool CheckCondition(const char* rec, const Condition& condition) {
         if(condition.is_always_false_) {
             return false;
         }
         auto left_col = get_col(cols_,condition.lhs_col); // 首先根据condition中，左侧列的名字，来获取该列的数据
-        char* l_value = rm_->data+left_col->offset; // 获得左值。CHECK(AntiO2) 这里左值一定是常量吗？有没有可能两边都是常数。
-        char* r_value;
+        const char* l_value = rec+left_col->offset; // 获得左值。CHECK(AntiO2) 这里左值一定是常量吗？有没有可能两边都是常数。
+        const char* r_value;
         ColType r_type{};
         if(condition.is_rhs_val) {
             // 如果右值是一个常数
@@ -359,7 +362,7 @@ class IndexScanExecutor : public AbstractExecutor {
         } else {
             // check(AntiO2) 这里只有同一张表上两个列比较的情况吗？
             auto r_col =  get_col(cols_,condition.rhs_col);
-            r_value = rm_->data + r_col->offset;
+            r_value = rec + r_col->offset;
             r_type = r_col->type;
         }
      //    assert(left_col->type==r_type); // 保证两个值类型一样。
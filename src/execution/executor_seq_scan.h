@@ -31,7 +31,12 @@ class SeqScanExecutor : public AbstractExecutor {
 //    AggregateOp op_;
 
     Rid rid_;
-    std::unique_ptr<RecScan> scan_;     // table_iterator
+    std::unique_ptr<RmPageScan> page_scan_;     // table_iterator
+    RecordBatch batch_;                         // 当前扫描到的页面
+    std::vector<std::pair<Rid, std::unique_ptr<RmRecord>>> matches_;  // 当前页面中满足条件的记录
+    size_t match_idx_{0};                       // 下一个要返回的matches_下标
+    std::unique_ptr<BufferAccessStrategy> strategy_; // 顺序扫描只在自己的环形缓冲区中换页，避免冲掉其他查询的热点页面
+    std::vector<int> output_offsets_;           // 输出的记录中需要的字段，PAX格式的表只读取这些字段和条件中的字段
 
     SmManager *sm_manager_;
 
@@ -51,6 +56,10 @@ class SeqScanExecutor : public AbstractExecutor {
         len_ = cols_.back().offset + cols_.back().len; // 输出字段长度
         context_ = context;
         fed_conds_ = conds_;
+        strategy_ = sm_manager_->get_bpm()->get_access_strategy(BufferAccessType::BULKREAD);
+        for(auto &col : cols_) {
+            output_offsets_.push_back(col.offset);
+        }
     }
 //    //liamY 重载了构造函数，使得对聚合函数有新的信息col_as_name_ 和 op_
 //    SeqScanExecutor(SmManager *sm_manager, std::string tab_name, std::vector<Condition> conds, Context *context,std::string col_as_name,AggregateOp op) {
@@ -69,62 +78,16 @@ class SeqScanExecutor : public AbstractExecutor {
 
     void beginTuple() override {
         // 首先初始化。
-        is_end_ = false;
-        scan_ = std::make_unique<RmScan>(fh_); // 首先通过RmScan 获取对表的扫描
-        while(!scan_->is_end()) {
-            rid_ = scan_->rid();
-
-            // LOG_DEBUG("%s", fmt::format("rid page_no {} slot_no{}",rid_.page_no,rid_.slot_no).c_str());
-            if(CheckConditionByRid(rid_)) {
-                // 找到了满足条件的
-                // 找到了满足条件的
-                if(context_->txn_->get_isolation_level()==IsolationLevel::REPEATABLE_READ) {
-                    if(dml_mode_) {
-                        context_->lock_mgr_->lock_exclusive_on_record(context_->txn_, rid_, fh_->GetFd());
-                    } else {
-                        if(!context_->txn_->IsRowSharedLocked(fh_->GetFd(),rid_)&&!context_->txn_->IsRowExclusiveLocked(fh_->GetFd(),rid_)) {
-                            context_->lock_mgr_->lock_shared_on_record(context_->txn_, rid_, fh_->GetFd());
-                        }
-                    }
-                }
-                if(fh_->is_mark_delete(rid_,context_)) {
-                    scan_->next();
-                    continue;
-                }
-                is_end_ = false;
-                return;
-            }
-            scan_->next();
-        }
-        is_end_ = true;
+        page_scan_ = std::make_unique<RmPageScan>(fh_, strategy_.get()); // 按页扫描，每个页面只pin一次
+        page_scan_->set_predicates(GetZonePredicates()); // 根据zone map跳过不可能满足条件的页面
+        page_scan_->set_columns(GetScanOffsets(), output_offsets_);
+        matches_.clear();
+        match_idx_ = 0;
+        is_end_ = !FindNext();
     }
 
     void nextTuple() override {
-        scan_->next();
-        while(!scan_->is_end()) {
-            rid_ = scan_->rid();
-
-            // LOG_DEBUG("%s", fmt::format("rid page_no {} slot_no{}",rid_.page_no,rid_.slot_no).c_str());
-            if(CheckConditionByRid(rid_)) {
-                // 找到了满足条件的
-                if(context_->txn_->get_isolation_level()==IsolationLevel::REPEATABLE_READ) {
-                    if(dml_mode_) {
-                        context_->lock_mgr_->lock_exclusive_on_record(context_->txn_, rid_, fh_->GetFd());
-                    } else {
-                        if(!context_->txn_->IsRowSharedLocked(fh_->GetFd(),rid_)&&!context_->txn_->IsRowExclusiveLocked(fh_->GetFd(),rid_)) {
-                            context_->lock_mgr_->lock_shared_on_record(context_->txn_, rid_, fh_->GetFd());
-                        }
-                    }
-                }
-                if(fh_->is_mark_delete(rid_,context_)) {
-                    scan_->next();
-                    continue;
-                }
-                return;
-            }
-            scan_->next();
-        }
-        is_end_ = true;
+        is_end_ = !FindNext();
     }
 
     std::unique_ptr<RmRecord> Next() override {
@@ -141,10 +104,105 @@ class SeqScanExecutor : public AbstractExecutor {
       return is_end_;
     }
 
-    bool CheckConditionByRid(const Rid& rid) {
-        rec_ = fh_->get_record(rid,context_);
-        auto rec = rec_.get();
-        return CheckConditions(rec_.get(),conds_);
+    /**
+     * @description 只输出sel_cols中的字段，其余字段为0。用于投影直接在扫描之上的情况
+     * @param sel_cols 上层需要的字段
+     */
+    void SetOutputColumns(const std::vector<TabCol> &sel_cols) {
+        output_offsets_.clear();
+        for(auto &sel_col : sel_cols) {
+            output_offsets_.push_back(get_col(cols_, sel_col)->offset);
+        }
+    }
+
+    /**
+     * @description 判断条件需要读取的字段
+     * @return 字段在记录中的偏移
+     */
+    std::vector<int> GetScanOffsets() {
+        std::vector<int> offsets;
+        for(auto &cond : conds_) {
+            offsets.push_back(get_col(cols_, cond.lhs_col)->offset);
+            if(!cond.is_rhs_val) {
+                offsets.push_back(get_col(cols_, cond.rhs_col)->offset);
+            }
+        }
+        return offsets;
+    }
+
+    /**
+     * @description 从conds_中选出能用zone map判断的条件：字段与同类型常量比较，字段在zone map中维护了范围
+     * @return
+     */
+    std::vector<ZonePredicate> GetZonePredicates() {
+        std::vector<ZonePredicate> preds;
+        auto &zone_map = fh_->get_zone_map();
+        for(auto &cond : conds_) {
+            if(!cond.is_rhs_val || cond.is_always_false_ || cond.op == OP_NE || cond.rhs_val.raw == nullptr) {
+                continue;
+            }
+            auto col = get_col(cols_, cond.lhs_col);
+            int zone_col = zone_map.find_col(col->offset);
+            if(zone_col != -1 && cond.rhs_val.type == col->type) {
+                preds.push_back(ZonePredicate{zone_col, cond.op, cond.rhs_val.raw->data});
+            }
+        }
+        return preds;
+    }
+
+    /**
+     * @description 找到下一条满足条件且未被删除的记录，放入rid_和rec_
+     * @return 是否找到
+     */
+    bool FindNext() {
+        while(true) {
+            while(match_idx_ < matches_.size()) {
+                auto &match = matches_[match_idx_++];
+                rid_ = match.first;
+                if(context_->txn_->get_isolation_level()==IsolationLevel::REPEATABLE_READ) {
+                    if(dml_mode_) {
+                        context_->lock_mgr_->lock_exclusive_on_record(context_->txn_, rid_, fh_->GetFd());
+                    } else {
+                        if(!context_->txn_->IsRowSharedLocked(fh_->GetFd(),rid_)&&!context_->txn_->IsRowExclusiveLocked(fh_->GetFd(),rid_)) {
+                            context_->lock_mgr_->lock_shared_on_record(context_->txn_, rid_, fh_->GetFd());
+                        }
+                    }
+                    // 拿到记录锁之后再确认记录没有被标记删除
+                    if(fh_->is_mark_delete(rid_,context_)) {
+                        continue;
+                    }
+                }
+                rec_ = std::move(match.second);
+                return true;
+            }
+            if(!FillMatches()) {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * @description 读出下一个有满足条件记录的页面，在页面上直接判断条件，只复制满足条件的记录
+     * @return 扫描完所有页面时返回false
+     */
+    bool FillMatches() {
+        matches_.clear();
+        match_idx_ = 0;
+        // 可重复读时要在拿到记录锁之后才能判断标记删除，其他隔离级别直接在批次中跳过
+        bool skip_mark_deleted = context_->txn_->get_isolation_level()!=IsolationLevel::REPEATABLE_READ;
+        while(page_scan_->next_batch(&batch_, skip_mark_deleted)) {
+            for(size_t i = 0; i < batch_.size(); i++) {
+                if(CheckConditions(batch_.data(i),conds_)) {
+                    matches_.emplace_back(batch_.rid(i), batch_.materialize(i));
+                }
+            }
+            // 申请记录锁可能阻塞，先释放页面
+            batch_.release();
+            if(!matches_.empty()) {
+                return true;
+            }
+        }
+        return false;
     }
     /**
      * TODO(AntiO2) 这里可以考虑创建 Filter Executor， 从而在Seq Scan中不进行逻辑判断
@@ -153,7 +211,7 @@ class SeqScanExecutor : public AbstractExecutor {
      * @param conds
      * @return
      */
-    bool CheckConditions(RmRecord* rec, const std::vector<Condition>& conditions) {
+    bool CheckConditions(const char* rec, const std::vector<Condition>& conditions) {
         /**
          * 检查所有条件
          */
@@ -167,13 +225,13 @@ class SeqScanExecutor : public AbstractExecutor {
      * @param conditions
      * @return
      */
-    bool CheckCondition(RmRecord* rec, const Condition& condition) {
+    bool CheckCondition(const char* rec, const Condition& condition) {
             if(condition.is_always_false_) {
                 return false;
             }
             auto left_col = get_col(cols_,condition.lhs_col); // 首先根据condition中，左侧列的名字，来获取该列的数据
-            char* l_value = rec->data+left_col->offset; // 获得左值。CHECK(AntiO2) 这里左值一定是常量吗？有没有可能两边都是常数。
-            char* r_value;
+            const char* l_value = rec+left_col->offset; // 获得左值。CHECK(AntiO2) 这里左值一定是常量吗？有没有可能两边都是常数。
+            const char* r_value;
             ColType r_type{};
             if(condition.is_rhs_val) {
                 // 如果右值是一个常数
@@ -182,7 +240,7 @@ class SeqScanExecutor : public AbstractExecutor {
             } else {
                 // check(AntiO2) 这里只有同一张表上两个列比较的情况吗？
                auto r_col =  get_col(cols_,condition.rhs_col);
-               r_value = rec->data + r_col->offset;
+               r_value = rec + r_col->offset;
                r_type = r_col->type;
             }
              //  assert(left_col->type==r_type); // 保证两个值类型一样。
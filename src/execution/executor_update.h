@@ -145,13 +145,42 @@ class UpdateExecutor : public AbstractExecutor {
                 }
                 RmRecord update_record(*tuple);
                 auto undo_next = context_->txn_->get_prev_lsn();
-                fh_->update_record(rid,new_tuple.data,context_,&tab_name_);
-                context_->txn_->append_write_record(std::make_unique<WriteRecord>(WType::UPDATE_TUPLE,tab_name_,rid,update_record,undo_next));
+                try {
+                    fh_->update_record(rid,new_tuple.data,context_,&tab_name_);
+                    context_->txn_->append_write_record(std::make_unique<WriteRecord>(WType::UPDATE_TUPLE,tab_name_,rid,update_record,undo_next));
+                } catch (PageFullError &e) {
+                    // VARCHAR字段变长后原页面放不下，删除原记录并把新记录插入到其他页面
+                    RelocateRecord(rid, update_record, new_tuple, undo_next);
+                }
             }});
         // LOG_DEBUG("Update Complete");
         return nullptr;
     }
 
+    /**
+     * @description 把更新后的记录移到新的位置，按删除原记录和插入新记录写日志，回滚时分别撤销。
+     * 索引中的新键已经指向rid，改为指向新位置
+     * @param rid 原记录的位置
+     * @param old_tuple 更新前的记录
+     * @param new_tuple 更新后的记录
+     * @param undo_next 更新之前事务的最后一条日志
+     */
+    void RelocateRecord(const Rid &rid, const RmRecord &old_tuple, RmRecord &new_tuple, lsn_t undo_next) {
+        fh_->mark_delete_record(rid,context_,&tab_name_);
+        context_->txn_->append_write_record(std::make_unique<WriteRecord>(WType::DELETE_TUPLE,tab_name_,rid,old_tuple,undo_next));
+        undo_next = context_->txn_->get_prev_lsn();
+        auto new_rid = fh_->insert_record(new_tuple.data, context_, &tab_name_);
+        if(context_->txn_->get_isolation_level()==IsolationLevel::REPEATABLE_READ) {
+            context_->lock_mgr_->lock_exclusive_on_record(context_->txn_, new_rid, fh_->GetFd());
+        }
+        context_->txn_->append_write_record(std::make_unique<WriteRecord>(WType::INSERT_TUPLE,tab_name_,new_rid, undo_next));
+        for(size_t i = 0; i < index_handlers.size(); i++) {
+            auto key = new_tuple.key_from_rec(tab_.indexes.at(i).cols);
+            index_handlers.at(i)->delete_entry(key->data, context_->txn_);
+            index_handlers.at(i)->insert_entry(key->data, new_rid, context_->txn_);
+        }
+    }
+
     bool CheckConditions(RmRecord* rec, const std::vector<Condition>& conditions) {
         /**
          * 检查所有条件
@@ -0,0 +1,388 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "ix_bulk_builder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <queue>
+
+constexpr size_t IX_BULK_RUN_BUFFER_SIZE = 1024 * 1024;   // 每个临时文件的读写缓冲区大小
+
+/**
+ * @description: 把count个元素尽量平均地分给n个结点，前count % n个结点多分一个
+ * @return {size_t} 第i个结点的第一个元素的下标，i == n时为count
+ */
+static size_t group_begin(size_t count, size_t n, size_t i) { return count / n * i + std::min(i, count % n); }
+
+/**
+ * @description: 与group_begin相反，第i个元素所在结点的下标
+ */
+static size_t group_of(size_t count, size_t n, size_t i) {
+    size_t base = count / n;
+    size_t rem = count % n;
+    if (i < rem * (base + 1)) {
+        return i / (base + 1);
+    }
+    return rem + (i - rem * (base + 1)) / base;
+}
+
+IxBulkBuilder::IxBulkBuilder(IxIndexHandle *index_handle, double fill_factor, size_t sort_buffer_size)
+    : index_handle_(index_handle),
+      file_hdr_(index_handle->getFileHdr()),
+      fill_factor_(fill_factor),
+      sort_buffer_size_(sort_buffer_size),
+      entry_size_(file_hdr_->col_tot_len_ + sizeof(Rid)),
+      extent_(IX_BULK_EXTENT_PAGES) {}
+
+IxBulkBuilder::~IxBulkBuilder() {
+    for (auto run : runs_) {
+        std::fclose(run);
+    }
+}
+
+/**
+ * @description: 加入一个索引项，finish之前索引不变
+ * @param {char*} key 索引包含的字段依次拼接成的key
+ * @param {Rid&} rid 记录的位置
+ */
+void IxBulkBuilder::add(const char *key, const Rid &rid) {
+    buffer_.insert(buffer_.end(), key, key + file_hdr_->col_tot_len_);
+    buffer_.insert(buffer_.end(), reinterpret_cast<const char *>(&rid), reinterpret_cast<const char *>(&rid) + sizeof(Rid));
+    num_entries_++;
+    sorted_ = false;
+    checked_ = false;
+    if (buffer_.size() >= sort_buffer_size_) {
+        spill();
+    }
+}
+
+/**
+ * @description: 检查加入的索引项的key是否互不相同，已有数据的索引还要检查key是否已经在索引中。
+ * 检查时把索引项排好序，finish直接按顺序读取。key重复时抛出IndexEntryDuplicateError，索引不变
+ */
+void IxBulkBuilder::check() {
+    if (num_entries_ == 0 || checked_) {
+        return;
+    }
+    bool fresh = is_fresh();
+    Transaction transaction(INVALID_TXN_ID);
+    std::vector<char> prev_key(file_hdr_->col_tot_len_);
+    bool has_prev = false;
+    std::vector<Rid> result;
+    for_each_sorted([&](const char *entry) {
+        if (has_prev && ix_compare(entry, prev_key.data(), file_hdr_->col_types_, file_hdr_->col_lens_) == 0) {
+            throw IndexEntryDuplicateError();
+        }
+        if (!fresh && index_handle_->get_value(entry, &result, &transaction)) {
+            throw IndexEntryDuplicateError();
+        }
+        memcpy(prev_key.data(), entry, prev_key.size());
+        has_prev = true;
+    });
+    checked_ = true;
+}
+
+/**
+ * @description: 把所有索引项写入索引。空索引自底向上构建，否则按key的顺序逐条插入。
+ * 先调用check，key重复时抛出IndexEntryDuplicateError，索引不变
+ */
+void IxBulkBuilder::finish() {
+    check();
+    if (num_entries_ == 0) {
+        return;
+    }
+    if (is_fresh()) {
+        build();
+        return;
+    }
+    Transaction transaction(INVALID_TXN_ID);
+    int key_len = file_hdr_->col_tot_len_;
+    for_each_sorted([&](const char *entry) {
+        Rid rid;
+        memcpy(&rid, entry + key_len, sizeof(Rid));
+        index_handle_->insert_entry(entry, rid, &transaction);
+    });
+}
+
+/**
+ * @description: 把内存中的索引项按key排序，key相同时按rid排序
+ */
+void IxBulkBuilder::sort_buffer() {
+    int key_len = file_hdr_->col_tot_len_;
+    size_t n = buffer_.size() / entry_size_;
+    std::vector<const char *> order(n);
+    for (size_t i = 0; i < n; i++) {
+        order[i] = buffer_.data() + i * entry_size_;
+    }
+    std::sort(order.begin(), order.end(), [&](const char *a, const char *b) {
+        int res = ix_compare(a, b, file_hdr_->col_types_, file_hdr_->col_lens_);
+        if (res != 0) {
+            return res < 0;
+        }
+        return memcmp(a + key_len, b + key_len, sizeof(Rid)) < 0;
+    });
+    std::vector<char> sorted(buffer_.size());
+    for (size_t i = 0; i < n; i++) {
+        memcpy(sorted.data() + i * entry_size_, order[i], entry_size_);
+    }
+    buffer_.swap(sorted);
+}
+
+/**
+ * @description: 创建一个临时文件，用于保存一段有序的索引项
+ */
+std::FILE *IxBulkBuilder::create_run() {
+    std::FILE *run = std::tmpfile();
+    if (run == nullptr) {
+        throw UnixError();
+    }
+    setvbuf(run, nullptr, _IOFBF, IX_BULK_RUN_BUFFER_SIZE);
+    return run;
+}
+
+/**
+ * @description: 把内存中的索引项排好序后写到一个新的临时文件中
+ */
+void IxBulkBuilder::spill() {
+    if (buffer_.empty()) {
+        return;
+    }
+    sort_buffer();
+    std::FILE *run = create_run();
+    runs_.push_back(run);
+    size_t n = buffer_.size() / entry_size_;
+    if (std::fwrite(buffer_.data(), entry_size_, n, run) != n) {
+        throw UnixError();
+    }
+    buffer_.clear();
+}
+
+/**
+ * @description: 按key的顺序把每个索引项交给consumer。没有写过临时文件时直接在内存中排序，
+ * 否则把剩下的索引项也写入临时文件，再多路归并所有临时文件。归并的结果写入一个新的临时文件，
+ * 代替原来的临时文件，再次调用时只需要顺序读取
+ */
+void IxBulkBuilder::for_each_sorted(const std::function<void(const char *entry)> &consumer) {
+    if (runs_.empty()) {
+        if (!sorted_) {
+            sort_buffer();
+            sorted_ = true;
+        }
+        for (size_t offset = 0; offset < buffer_.size(); offset += entry_size_) {
+            consumer(buffer_.data() + offset);
+        }
+        return;
+    }
+    spill();
+    std::vector<char>().swap(buffer_);
+    if (runs_.size() == 1) {
+        std::vector<char> entry(entry_size_);
+        std::rewind(runs_[0]);
+        while (std::fread(entry.data(), entry_size_, 1, runs_[0]) == 1) {
+            consumer(entry.data());
+        }
+        return;
+    }
+
+    int key_len = file_hdr_->col_tot_len_;
+    // 每个临时文件当前的索引项
+    std::vector<std::vector<char>> heads(runs_.size(), std::vector<char>(entry_size_));
+    auto greater = [&](size_t a, size_t b) {
+        int res = ix_compare(heads[a].data(), heads[b].data(), file_hdr_->col_types_, file_hdr_->col_lens_);
+        if (res != 0) {
+            return res > 0;
+        }
+        return memcmp(heads[a].data() + key_len, heads[b].data() + key_len, sizeof(Rid)) > 0;
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> queue(greater);
+    for (size_t i = 0; i < runs_.size(); i++) {
+        std::rewind(runs_[i]);
+        if (std::fread(heads[i].data(), entry_size_, 1, runs_[i]) == 1) {
+            queue.push(i);
+        }
+    }
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> merged(create_run(), std::fclose);
+    while (!queue.empty()) {
+        size_t i = queue.top();
+        queue.pop();
+        consumer(heads[i].data());
+        if (std::fwrite(heads[i].data(), entry_size_, 1, merged.get()) != 1) {
+            throw UnixError();
+        }
+        if (std::fread(heads[i].data(), entry_size_, 1, runs_[i]) == 1) {
+            queue.push(i);
+        }
+    }
+    for (auto run : runs_) {
+        std::fclose(run);
+    }
+    runs_.assign(1, merged.release());
+}
+
+/**
+ * @description: 索引是否是刚创建的空索引，即只有一个没有索引项的根结点，也没有释放过页面
+ */
+bool IxBulkBuilder::is_fresh() const {
+    if (file_hdr_->num_pages_ != IX_INIT_NUM_PAGES || file_hdr_->first_free_page_no_ != IX_NO_PAGE ||
+        file_hdr_->root_page_ != IX_INIT_ROOT_PAGE) {
+        return false;
+    }
+    auto buffer_pool_manager = index_handle_->getBufferPoolManager();
+    PageId root_id{index_handle_->getFd(), IX_INIT_ROOT_PAGE};
+    Page *page = buffer_pool_manager->fetch_page(root_id);
+    IxNodeHandle root(file_hdr_, page);
+    bool empty = root.get_size() == 0;
+    buffer_pool_manager->unpin_page(root_id, false);
+    return empty;
+}
+
+/**
+ * @description: 自底向上构建B+树。每一层的结点个数和页号都可以事先算出，叶子结点按key的顺序依次填充，
+ * 非叶子结点的第i个key是第i个孩子的第一个key。新结点从文件末尾开始依次分配页号，原来的空根结点放入空闲页链表。
+ * 调用者已经通过check保证key不重复
+ */
+void IxBulkBuilder::build() {
+    int key_len = file_hdr_->col_tot_len_;
+    int fd = index_handle_->getFd();
+    size_t capacity = std::clamp(static_cast<int>(file_hdr_->btree_order_ * fill_factor_), 2, file_hdr_->btree_order_);
+
+    // 每一层的结点个数和第一个结点的页号，第0层是叶子结点
+    std::vector<size_t> level_sizes{(num_entries_ + capacity - 1) / capacity};
+    while (level_sizes.back() > 1) {
+        level_sizes.push_back((level_sizes.back() + capacity - 1) / capacity);
+    }
+    std::vector<page_id_t> level_pages;
+    page_id_t num_pages = file_hdr_->num_pages_;
+    for (auto n : level_sizes) {
+        level_pages.push_back(num_pages);
+        num_pages += static_cast<page_id_t>(n);
+    }
+    auto parent_of = [&](size_t level, size_t i) {
+        if (level + 1 == level_sizes.size()) {
+            return INVALID_PAGE_ID;
+        }
+        return level_pages[level + 1] + static_cast<page_id_t>(group_of(level_sizes[level], level_sizes[level + 1], i));
+    };
+    first_page_no_ = file_hdr_->num_pages_;
+    num_pages_ = 0;
+
+    // 叶子结点，同时记录每个结点的第一个key
+    size_t num_leaves = level_sizes[0];
+    std::vector<char> first_keys;
+    std::unique_ptr<Page> page;
+    std::unique_ptr<IxNodeHandle> node;
+    size_t leaf = 0;
+    int pos = 0;
+    int leaf_size = 0;
+    for_each_sorted([&](const char *entry) {
+        if (pos == 0) {
+            page_id_t page_no;
+            char *data = next_page(&page_no);
+            page = std::make_unique<Page>(PageId{fd, page_no}, data);
+            node = std::make_unique<IxNodeHandle>(file_hdr_, page.get());
+            node->init(parent_of(0, leaf), IX_NO_PAGE, true);
+            node->set_prev_leaf(leaf == 0 ? IX_LEAF_HEADER_PAGE : page_no - 1);
+            node->set_next_leaf(leaf + 1 == num_leaves ? IX_LEAF_HEADER_PAGE : page_no + 1);
+            leaf_size = static_cast<int>(group_begin(num_entries_, num_leaves, leaf + 1) -
+                                         group_begin(num_entries_, num_leaves, leaf));
+            first_keys.insert(first_keys.end(), entry, entry + key_len);
+        }
+        Rid rid;
+        memcpy(&rid, entry + key_len, sizeof(Rid));
+        node->set_key(pos, entry);
+        node->set_rid(pos, rid);
+        node->set_size(++pos);
+        if (pos == leaf_size) {
+            leaf++;
+            pos = 0;
+        }
+    });
+    assert(leaf == num_leaves);
+
+    // 非叶子结点
+    for (size_t level = 1; level < level_sizes.size(); level++) {
+        size_t num_children = level_sizes[level - 1];
+        size_t n = level_sizes[level];
+        std::vector<char> parent_keys(n * key_len);
+        for (size_t i = 0; i < n; i++) {
+            size_t begin = group_begin(num_children, n, i);
+            size_t end = group_begin(num_children, n, i + 1);
+            page_id_t page_no;
+            char *data = next_page(&page_no);
+            Page inner_page(PageId{fd, page_no}, data);
+            IxNodeHandle inner(file_hdr_, &inner_page);
+            inner.init(parent_of(level, i), IX_NO_PAGE, false);
+            for (size_t c = begin; c < end; c++) {
+                inner.set_key(static_cast<int>(c - begin), first_keys.data() + c * key_len);
+                inner.set_rid(static_cast<int>(c - begin),
+                              Rid{.page_no = level_pages[level - 1] + static_cast<page_id_t>(c), .slot_no = IX_NO_PAGE});
+            }
+            inner.set_size(static_cast<int>(end - begin));
+            memcpy(parent_keys.data() + i * key_len, first_keys.data() + begin * key_len, key_len);
+        }
+        first_keys.swap(parent_keys);
+    }
+    flush_pages();
+
+    // leaf header的前一个/后一个叶子分别是最后一个/第一个叶子
+    page_id_t first_leaf = level_pages[0];
+    page_id_t last_leaf = level_pages[0] + static_cast<page_id_t>(num_leaves) - 1;
+    auto buffer_pool_manager = index_handle_->getBufferPoolManager();
+    PageId leaf_header_id{fd, IX_LEAF_HEADER_PAGE};
+    IxNodeHandle leaf_header(file_hdr_, buffer_pool_manager->fetch_page(leaf_header_id));
+    leaf_header.set_next_leaf(first_leaf);
+    leaf_header.set_prev_leaf(last_leaf);
+    buffer_pool_manager->unpin_page(leaf_header_id, true);
+
+    // 最后更新文件头，原来的根结点在磁盘上的next_free_page_no为IX_NO_PAGE，直接作为空闲页链表的唯一页面
+    file_hdr_->first_free_page_no_ = file_hdr_->root_page_;
+    file_hdr_->root_page_ = level_pages.back();
+    file_hdr_->first_leaf_ = first_leaf;
+    file_hdr_->last_leaf_ = last_leaf;
+    file_hdr_->num_pages_ = num_pages;
+    auto disk_manager = index_handle_->getDiskManager();
+    disk_manager->set_fd2pageno(fd, num_pages);
+    std::vector<char> data(file_hdr_->tot_len_);
+    file_hdr_->serialize(data.data());
+    disk_manager->write_page(fd, IX_FILE_HDR_PAGE, data.data(), file_hdr_->tot_len_);
+}
+
+/**
+ * @description: 在extent中分配下一个页面，extent用完时先写出
+ * @param {page_id_t*} page_no 返回页面的页号
+ * @return {char*} 清零的页面数据
+ */
+char *IxBulkBuilder::next_page(page_id_t *page_no) {
+    if (num_pages_ == IX_BULK_EXTENT_PAGES) {
+        flush_pages();
+    }
+    *page_no = first_page_no_ + num_pages_;
+    char *data = extent_.get_frame(num_pages_++);
+    memset(data, 0, PAGE_SIZE);
+    return data;
+}
+
+/**
+ * @description: 把extent中的页面一次写到文件中
+ */
+void IxBulkBuilder::flush_pages() {
+    if (num_pages_ == 0) {
+        return;
+    }
+    std::vector<char *> pages(num_pages_);
+    for (int i = 0; i < num_pages_; i++) {
+        pages[i] = extent_.get_frame(i);
+    }
+    index_handle_->getDiskManager()->write_pages(index_handle_->getFd(), first_page_no_, pages.data(), num_pages_);
+    first_page_no_ += num_pages_;
+    num_pages_ = 0;
+}
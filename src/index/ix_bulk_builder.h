@@ -0,0 +1,83 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include "ix_index_handle.h"
+#include "storage/frame_arena.h"
+
+constexpr double IX_BULK_FILL_FACTOR = 0.9;                     // 批量构建时结点填充到最大键值对数量的比例
+constexpr size_t IX_BULK_SORT_BUFFER_SIZE = 64 * 1024 * 1024;   // 内存中排序的(key, rid)的字节数上限，超过后写入临时文件
+constexpr int IX_BULK_EXTENT_PAGES = 256;                       // 批量构建时每次顺序写出的页面个数
+
+/**
+ * @description: 自底向上批量构建B+树。先收集所有(key, rid)，内存放不下时把排好序的部分写到临时文件，
+ * 最后多路归并得到有序序列；叶子结点按填充因子依次填满，再逐层向上构建非叶子结点，所有结点页号连续，
+ * 绕过buffer pool顺序写到文件末尾，最后写文件头。
+ * 只有刚创建的空索引才能批量构建，已有数据的索引按key的顺序逐条insert_entry；构建期间索引上不能有其他操作。
+ * check只检查key是否重复，不修改索引，调用者可以在所有检查都通过之后再写入
+ */
+class IxBulkBuilder {
+   public:
+    /**
+     * @param {IxIndexHandle*} index_handle 要构建的索引
+     * @param {double} fill_factor 叶子结点和非叶子结点的填充因子
+     * @param {size_t} sort_buffer_size 内存中排序的(key, rid)的字节数上限
+     */
+    IxBulkBuilder(IxIndexHandle *index_handle, double fill_factor = IX_BULK_FILL_FACTOR,
+                  size_t sort_buffer_size = IX_BULK_SORT_BUFFER_SIZE);
+
+    ~IxBulkBuilder();
+
+    IxBulkBuilder(const IxBulkBuilder &) = delete;
+    IxBulkBuilder &operator=(const IxBulkBuilder &) = delete;
+
+    void add(const char *key, const Rid &rid);
+
+    void check();
+
+    void finish();
+
+   private:
+    void sort_buffer();
+
+    std::FILE *create_run();
+
+    void spill();
+
+    void for_each_sorted(const std::function<void(const char *entry)> &consumer);
+
+    bool is_fresh() const;
+
+    void build();
+
+    char *next_page(page_id_t *page_no);
+
+    void flush_pages();
+
+    IxIndexHandle *index_handle_;
+    IxFileHdr *file_hdr_;
+    double fill_factor_;
+    size_t sort_buffer_size_;
+    size_t entry_size_;             // 每个(key, rid)的长度，key在前
+    size_t num_entries_ = 0;
+    bool sorted_ = false;           // buffer_是否已经排好序
+    bool checked_ = false;          // 加入的索引项是否已经通过check
+    std::vector<char> buffer_;      // 还没有写入临时文件的(key, rid)
+    std::vector<std::FILE *> runs_; // 写入临时文件的有序段
+
+    FrameArena extent_;             // 正在填充的结点页面
+    page_id_t first_page_no_ = IX_NO_PAGE;  // extent中第一个页面的页号
+    int num_pages_ = 0;             // extent中已经使用的页面个数
+};
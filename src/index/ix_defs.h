@@ -128,7 +128,7 @@ public:
 
 class IxPageHdr {
 public:
-    page_id_t next_free_page_no;    // unused
+    page_id_t next_free_page_no;    // 页面被释放后，空闲页链表中的下一个页面
     page_id_t parent;               // 父亲节点所在页面的叶号
     int num_key;                    // # current keys (always equals to #child - 1) 已插入的keys数量，key_idx∈[0,num_key)
     bool is_leaf;                   // 是否为叶节点
@@ -10,6 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #include "ix_index_handle.h"
 
+#include <algorithm>
+
 #include "ix_scan.h"
 
 /**
@@ -274,8 +276,8 @@ IxIndexHandle::IxIndexHandle(DiskManager *disk_manager, BufferPoolManager *buffe
     file_hdr_->deserialize(buf);
     
     // disk_manager管理的fd对应的文件中，设置从file_hdr_->num_pages开始分配page_no
-    int now_page_no = disk_manager_->get_fd2pageno(fd);
-    disk_manager_->set_fd2pageno(fd, now_page_no + 1);
+    // 被释放的页面记录在file_hdr_的空闲页链表中，num_pages_包括这些页面，新页面总是在文件末尾分配
+    disk_manager_->set_fd2pageno(fd, file_hdr_->num_pages_);
 }
 
 /**
@@ -507,13 +509,13 @@ page_id_t IxIndexHandle::insert_entry(const char *key, const Rid &value, Transac
         file_hdr_->serialize(data); // 将fhdr的数据结构化，存储到data中
         disk_manager_->write_page(fd_, IX_FILE_HDR_PAGE, data, file_hdr_->tot_len_);
 
-        char page_buf[PAGE_SIZE];  // 在内存中初始化page_buf中的内容，然后将其写入磁盘
-        memset(page_buf, 0, PAGE_SIZE);
+        std::vector<char> page_buf(PAGE_SIZE);  // 在内存中初始化page_buf中的内容，然后将其写入磁盘
+        memset(page_buf.data(), 0, PAGE_SIZE);
         // 注意leaf header页号为1，也标记为叶子结点，其前一个/后一个叶子均指向root node
         // Create leaf list header page and write to file
         {
-            memset(page_buf, 0, PAGE_SIZE);
-            auto phdr = reinterpret_cast<IxPageHdr *>(page_buf);
+            memset(page_buf.data(), 0, PAGE_SIZE);
+            auto phdr = reinterpret_cast<IxPageHdr *>(page_buf.data());
             *phdr = {
                     .next_free_page_no = IX_NO_PAGE,
                     .parent = IX_NO_PAGE,
@@ -522,11 +524,11 @@ page_id_t IxIndexHandle::insert_entry(const char *key, const Rid &value, Transac
                     .prev_leaf = root_node->get_page_no(),
                     .next_leaf = root_node->get_page_no(),
             };
-            disk_manager_->write_page(fd_, IX_LEAF_HEADER_PAGE, page_buf, PAGE_SIZE);
+            disk_manager_->write_page(fd_, IX_LEAF_HEADER_PAGE, page_buf.data(), PAGE_SIZE);
         }
         {
-            memset(page_buf, 0, PAGE_SIZE);
-            auto phdr = reinterpret_cast<IxPageHdr *>(page_buf);
+            memset(page_buf.data(), 0, PAGE_SIZE);
+            auto phdr = reinterpret_cast<IxPageHdr *>(page_buf.data());
             *phdr = {
                     .next_free_page_no = IX_NO_PAGE,
                     .parent = IX_NO_PAGE,
@@ -536,7 +538,7 @@ page_id_t IxIndexHandle::insert_entry(const char *key, const Rid &value, Transac
                     .next_leaf = IX_LEAF_HEADER_PAGE,
             };
             // Must write PAGE_SIZE here in case of future fetch_node()
-            disk_manager_->write_page(fd_, root_node->get_page_no(), page_buf, PAGE_SIZE);
+            disk_manager_->write_page(fd_, root_node->get_page_no(), page_buf.data(), PAGE_SIZE);
         }
         buffer_pool_manager_->unpin_page(root_node->get_page_id(),true);
         release_ancestors(transaction);
@@ -606,13 +608,22 @@ bool IxIndexHandle::delete_entry(const char *key, Transaction *transaction) {
          leaf_node->page->WUnlock();
         // 4. 如果需要并发，并且需要删除叶子结点，则需要在事务的delete_page_set中添加删除结点的对应页面；记得处理并发的上锁
         if(need_delete) {
-            transaction->append_index_deleted_page(leaf_node->page);
+            transaction->append_index_deleted_page(leaf_node->get_page_id());
         }
         buffer_pool_manager_->unpin_page(leaf_node->get_page_id(), true);
-        for(auto page:*(transaction->get_index_deleted_page_set())) {
-            buffer_pool_manager_->delete_page(page->get_page_id());
+        // 被删除的结点此时都已经unpin并释放了latch，才能放入空闲页链表供其他线程的create_node复用
+        // 同一个页面可能被记录多次，去重后再放入
+        auto deleted_pages = transaction->get_index_deleted_page_set();
+        std::vector<page_id_t> page_nos;
+        for(auto &page_id:*deleted_pages) {
+            page_nos.push_back(page_id.page_no);
+        }
+        std::sort(page_nos.begin(), page_nos.end());
+        page_nos.erase(std::unique(page_nos.begin(), page_nos.end()), page_nos.end());
+        for(auto page_no:page_nos) {
+            release_node_page(page_no);
         }
-        transaction->get_index_deleted_page_set()->clear();
+        deleted_pages->clear();
         return true;
     }
 
@@ -666,7 +677,7 @@ bool IxIndexHandle::coalesce_or_redistribute(IxNodeHandle *node, Transaction *tr
         // 5. 如果不满足上述条件，则需要合并两个结点，将右边的结点合并到左边的结点（调用Coalesce函数）
         auto parent_delete = coalesce(&sibling_node, &node, &parent_node, pos , transaction, root_is_latched);
         if(parent_delete) {
-            transaction->append_index_deleted_page(parent_page);
+            transaction->append_index_deleted_page(parent_page->get_page_id());
         }
         buffer_pool_manager_->unpin_page(parent_page->get_page_id(),true);
          sibling_page->WUnlock();
@@ -689,9 +700,9 @@ bool IxIndexHandle::coalesce_or_redistribute(IxNodeHandle *node, Transaction *tr
         // coalesce
         auto sibling_idx = parent_node->find_child(sibling_node);
         auto parent_node_should_delete = coalesce( &sibling_node,&node, &parent_node, pos, transaction,root_is_latched);  // NOLINT
-        transaction->append_index_deleted_page(sibling_page);
+        transaction->append_index_deleted_page(sibling_page->get_page_id());
         if (parent_node_should_delete) {
-            transaction->append_index_deleted_page(parent_page);
+            transaction->append_index_deleted_page(parent_page->get_page_id());
         }
         buffer_pool_manager_->unpin_page(parent_page->get_page_id(), true);
          sibling_page->WUnlock();
@@ -716,13 +727,11 @@ bool IxIndexHandle::adjust_root(IxNodeHandle *old_root_node) {
 
         auto root_page_id_ = child_node->get_page_id();
         file_hdr_->root_page_ = root_page_id_.page_no;
-        release_node_handle(*old_root_node);
         buffer_pool_manager_->unpin_page(root_page_id_,true);
         return true;
     }
     // 2. 如果old_root_node是叶结点，且大小为0，则直接更新root page
     if (old_root_node->is_leaf_page() && old_root_node->get_size() == 0) {
-        release_node_handle(*old_root_node);
         file_hdr_->root_page_ = INVALID_PAGE_ID;
         return true;
     }
@@ -805,9 +814,8 @@ bool IxIndexHandle::coalesce(IxNodeHandle **neighbor_node, IxNodeHandle **node,
     if((*node)->is_leaf_page()) {
         erase_leaf(*node);
     }
-    release_node_handle(**node);
     (*parent)->erase_pair(index);
-    transaction->append_index_deleted_page((*node)->page);
+    transaction->append_index_deleted_page((*node)->get_page_id());
     return coalesce_or_redistribute(*parent, transaction);
 }
 
@@ -894,11 +902,24 @@ IxNodeHandle *IxIndexHandle::fetch_node(int page_no) const  {
  * @note pin the page, remember to unpin it outside!
  * 注意：对于Index的处理是，删除某个页面后，认为该被删除的页面是free_page
  * 而first_free_page实际上就是最新被删除的页面，初始为IX_NO_PAGE
- * 在最开始插入时，一直是create node，那么first_page_no一直没变，一直是IX_NO_PAGE
+ * 被删除的页面通过page_hdr->next_free_page_no串成链表，创建结点时优先复用链表头部的页面，链表为空时才扩展文件
  * 与Record的处理不同，Record将未插入满的记录页认为是free_page
  */
 IxNodeHandle *IxIndexHandle::create_node() {
     IxNodeHandle *node;
+    std::scoped_lock lock(free_list_latch_);
+    if (file_hdr_->first_free_page_no_ != IX_NO_PAGE) {
+        Page *page = buffer_pool_manager_->fetch_page(PageId{fd_, file_hdr_->first_free_page_no_});
+        if (page == nullptr) {
+            return nullptr;
+        }
+        node = new IxNodeHandle(file_hdr_, page);
+        file_hdr_->first_free_page_no_ = node->page_hdr->next_free_page_no;
+        // 与new_page得到的页面一样从全0开始，由调用者初始化
+        memset(page->get_data(), 0, PAGE_SIZE);
+        BufferPoolManager::mark_dirty(page);
+        return node;
+    }
     file_hdr_->num_pages_++;
 
     PageId new_page_id = {.fd = fd_, .page_no = INVALID_PAGE_ID};
@@ -950,12 +971,19 @@ void IxIndexHandle::erase_leaf(IxNodeHandle *leaf) {
 }
 
 /**
- * @brief 删除node时，更新file_hdr_.num_pages
+ * @brief 把被删除的结点的页面放到空闲页链表的头部，之后create_node会复用该页面
+ * 页面仍然计入file_hdr_.num_pages，链表指针保存在页面自己的page_hdr中，随页面一起写回磁盘
+ * 只能在删除结点的线程unpin该页面并释放latch之后调用，否则其他线程可能在删除完成前复用并清空该页面
  *
- * @param node
+ * @param page_no 被删除的结点的页号
  */
-void IxIndexHandle::release_node_handle(IxNodeHandle &node) {
-    // file_hdr_->num_pages_--;
+void IxIndexHandle::release_node_page(page_id_t page_no) {
+    std::scoped_lock lock(free_list_latch_);
+    IxNodeHandle *node = fetch_node(page_no);
+    node->page_hdr->next_free_page_no = file_hdr_->first_free_page_no_;
+    file_hdr_->first_free_page_no_ = page_no;
+    buffer_pool_manager_->unpin_page(node->get_page_id(), true);
+    delete node;
 }
 
 /**
@@ -10,6 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <mutex>
+
 #include "ix_defs.h"
 #include "transaction/transaction.h"
 #include "common/common.h"
@@ -168,6 +170,7 @@ class IxIndexHandle {
     IxFileHdr* file_hdr_;                       // 存了root_page，但其初始化为2（第0页存FILE_HDR_PAGE，第1页存LEAF_HEADER_PAGE）
     // std::mutex root_latch_;
     RWLatch root_latch_;
+    std::mutex free_list_latch_;                // 保护file_hdr_中的空闲页链表和num_pages_，分裂和合并可能在不同的子树上并发进行
    public:
     IxIndexHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd);
 
@@ -229,7 +232,7 @@ private:
 
     void erase_leaf(IxNodeHandle *leaf);
 
-    void release_node_handle(IxNodeHandle &node);
+    void release_node_page(page_id_t page_no);
 
     void maintain_child(IxNodeHandle *node, int child_idx);
     void release_ancestors(Transaction*transaction);
@@ -97,13 +97,13 @@ class IxManager {
 
         disk_manager_->write_page(fd, IX_FILE_HDR_PAGE, data, fhdr->tot_len_); // 将索引数据写到索引文件的第0页中（header page）
 
-        char page_buf[PAGE_SIZE];  // 在内存中初始化page_buf中的内容，然后将其写入磁盘
-        memset(page_buf, 0, PAGE_SIZE);
+        std::vector<char> page_buf(PAGE_SIZE);  // 在内存中初始化page_buf中的内容，然后将其写入磁盘
+        memset(page_buf.data(), 0, PAGE_SIZE);
         // 注意leaf header页号为1，也标记为叶子结点，其前一个/后一个叶子均指向root node
         // Create leaf list header page and write to file
         {
-            memset(page_buf, 0, PAGE_SIZE);
-            auto phdr = reinterpret_cast<IxPageHdr *>(page_buf);
+            memset(page_buf.data(), 0, PAGE_SIZE);
+            auto phdr = reinterpret_cast<IxPageHdr *>(page_buf.data());
             *phdr = {
                 .next_free_page_no = IX_NO_PAGE,
                 .parent = IX_NO_PAGE,
@@ -112,13 +112,13 @@ class IxManager {
                 .prev_leaf = IX_INIT_ROOT_PAGE,
                 .next_leaf = IX_INIT_ROOT_PAGE,
             };
-            disk_manager_->write_page(fd, IX_LEAF_HEADER_PAGE, page_buf, PAGE_SIZE);
+            disk_manager_->write_page(fd, IX_LEAF_HEADER_PAGE, page_buf.data(), PAGE_SIZE);
         }
         // 注意root node页号为2，也标记为叶子结点，其前一个/后一个叶子均指向leaf header
         // Create root node and write to file
         {
-            memset(page_buf, 0, PAGE_SIZE);
-            auto phdr = reinterpret_cast<IxPageHdr *>(page_buf);
+            memset(page_buf.data(), 0, PAGE_SIZE);
+            auto phdr = reinterpret_cast<IxPageHdr *>(page_buf.data());
             *phdr = {
                 .next_free_page_no = IX_NO_PAGE,
                 .parent = IX_NO_PAGE,
@@ -128,7 +128,7 @@ class IxManager {
                 .next_leaf = IX_LEAF_HEADER_PAGE,
             };
             // Must write PAGE_SIZE here in case of future fetch_node()
-            disk_manager_->write_page(fd, IX_INIT_ROOT_PAGE, page_buf, PAGE_SIZE);
+            disk_manager_->write_page(fd, IX_INIT_ROOT_PAGE, page_buf.data(), PAGE_SIZE);
         }
 
         disk_manager_->set_fd2pageno(fd, IX_INIT_NUM_PAGES - 1);  // DEBUG
@@ -23,6 +23,8 @@ void IxScan::next() {
     iid_.slot_no++;
     if (iid_.page_no != ih_->file_hdr_->last_leaf_ && iid_.slot_no == leaf_node_->get_size()) {
         // go to next leaf
+        // 批量插入或重建的索引中相邻叶子的页号通常也是连续的，检测到这种情况时顺序预读后面的页面
+        bpm_->read_ahead(&read_ahead_, PageId{ih_->fd_, leaf_node_->get_next_leaf()}, ih_->file_hdr_->num_pages_);
         auto next_leaf_node_ = ih_->fetch_node(leaf_node_->get_next_leaf());
         iid_.slot_no = 0;
         next_leaf_node_->page->RLock();
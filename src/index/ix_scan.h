@@ -12,6 +12,7 @@ See the Mulan PSL v2 for more details. */
 
 #include "ix_defs.h"
 #include "ix_index_handle.h"
+#include "storage/read_ahead.h"
 
 // class IxIndexHandle;
 
@@ -29,6 +30,7 @@ class IxScan : public RecScan {
     bool is_end_{false};
     IxNodeHandle* leaf_node_; // 当前的leaf_page
     GapLockPointType right_point_type; // 右key的约束类型，是 NE:<, 还是N: <, 还是INF(无右端点)
+    ReadAheadState read_ahead_;         // 叶子结点按页号连续排列时顺序预读
    public:
     IxScan(const IxIndexHandle *ih, const Iid &iid, char *endKey, size_t endKeySize, size_t colCmpNum,
            BufferPoolManager *bpm, IxNodeHandle* leaf_node, GapLockPointType rightPointType);
@@ -193,6 +193,7 @@ class DDLPlan : public Plan
         std::string tab_name_;
         std::vector<std::string> tab_col_names_;
         std::vector<ColDef> cols_;
+        bool pax_ = false;      // 建表时是否使用PAX格式
 };
 
 // help; show tables; desc tables; begin; abort; commit; rollback语句对应的plan
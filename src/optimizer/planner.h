@@ -53,7 +53,7 @@ class Planner {
 
     ColType interp_sv_type(ast::SvType sv_type) {
         std::map<ast::SvType, ColType> m = {
-            {ast::SV_TYPE_INT, TYPE_INT}, {ast::SV_TYPE_FLOAT, TYPE_FLOAT}, {ast::SV_TYPE_STRING, TYPE_STRING},{ast::SV_TYPE_BIGINT,TYPE_BIGINT},{ast::SV_TYPE_DATETIME,TYPE_DATETIME}};
+            {ast::SV_TYPE_INT, TYPE_INT}, {ast::SV_TYPE_FLOAT, TYPE_FLOAT}, {ast::SV_TYPE_STRING, TYPE_STRING},{ast::SV_TYPE_BIGINT,TYPE_BIGINT},{ast::SV_TYPE_DATETIME,TYPE_DATETIME},{ast::SV_TYPE_VARCHAR,TYPE_STRING}};
         return m.at(sv_type);
     }
 };
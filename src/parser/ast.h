@@ -19,7 +19,7 @@ enum JoinType {
 namespace ast {
 
 enum SvType {
-    SV_TYPE_INT, SV_TYPE_FLOAT, SV_TYPE_STRING, SV_TYPE_BIGINT, SV_TYPE_DATETIME
+    SV_TYPE_INT, SV_TYPE_FLOAT, SV_TYPE_STRING, SV_TYPE_BIGINT, SV_TYPE_DATETIME, SV_TYPE_VARCHAR
 };
 
 enum SvCompOp {
@@ -96,12 +96,18 @@ struct ColDef : public Field {
             col_name(std::move(col_name_)), type_len(std::move(type_len_)) {}
 };
 
+// 表数据文件的存储方式，由建表语句末尾的storage = row | pax指定
+enum StorageType {
+    STORAGE_ROW, STORAGE_PAX
+};
+
 struct CreateTable : public TreeNode {
     std::string tab_name;
     std::vector<std::shared_ptr<Field>> fields;
+    StorageType storage;
 
-    CreateTable(std::string tab_name_, std::vector<std::shared_ptr<Field>> fields_) :
-            tab_name(std::move(tab_name_)), fields(std::move(fields_)) {}
+    CreateTable(std::string tab_name_, std::vector<std::shared_ptr<Field>> fields_, StorageType storage_ = STORAGE_ROW) :
+            tab_name(std::move(tab_name_)), fields(std::move(fields_)), storage(storage_) {}
 };
 
 struct DropTable : public TreeNode {
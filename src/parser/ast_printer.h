@@ -48,6 +48,7 @@ private:
                 {SV_TYPE_STRING, "STRING"},
                 {SV_TYPE_BIGINT,"BIGINT"},
                 {SV_TYPE_DATETIME,"DATETIME"},
+                {SV_TYPE_VARCHAR,"VARCHAR"},
         };
         return m.at(type);
     }
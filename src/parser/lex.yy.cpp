@@ -379,8 +379,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 60
-#define YY_END_OF_BUFFER 61
+#define YY_NUM_RULES 61
+#define YY_END_OF_BUFFER 62
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -388,33 +388,34 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[230] =
+static const flex_int16_t yy_accept[235] =
     {   0,
-        0,    0,    0,    0,   61,   59,    6,    7,    7,   59,
-       52,   59,   59,   52,   59,   55,   52,   52,   53,   53,
-       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
-       53,   53,   53,   53,   53,   53,   53,   59,    3,    4,
-        6,    7,    0,   58,    0,   55,    5,    0,    0,    0,
-        1,    0,   56,   55,   50,   51,   49,   53,   53,   53,
-       44,   53,   53,   38,   53,   53,   53,   53,   53,   53,
-       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
-       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
-       53,    2,    0,   56,    5,    0,    0,   56,   53,   33,
-
-       39,   53,   53,   53,   53,   53,   53,   53,   53,   53,
-       53,   53,   53,   53,   53,   53,   53,   27,   53,   53,
-       53,   41,   42,   47,   53,   53,   53,   53,   25,   53,
-       43,   53,   53,   53,   53,    0,   56,   54,   53,   53,
-       53,   28,   53,   53,   53,   53,   53,   17,   16,   35,
-       53,   22,   36,   53,   53,   19,   34,   53,   46,   53,
-       53,   53,   53,    8,   53,   53,   53,   53,    0,   54,
-       11,    9,   53,   53,   40,   53,   53,   53,   29,   32,
-       53,   45,   37,   53,   53,   53,   15,   53,   53,   23,
-        0,   54,   30,   10,   14,   53,   21,   18,   53,   53,
-
-       26,   13,   24,   20,    0,   53,   53,   53,    0,   31,
-       53,   12,    0,   53,    0,   53,    0,   48,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   57,    0
+        0,    0,    0,    0,   62,   60,    6,    7,    7,   60,
+       53,   60,   60,   53,   60,   56,   53,   53,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   60,    3,    4,
+        6,    7,    0,   59,    0,   56,    5,    0,    0,    0,
+        1,    0,   57,   56,   51,   52,   50,   54,   54,   54,
+       45,   54,   54,   39,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,    2,    0,   57,    5,    0,    0,   57,   54,   34,
+
+       40,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   27,   54,   54,
+       54,   42,   43,   48,   54,   54,   54,   54,   25,   54,
+       44,   54,   54,   54,   54,   54,    0,   57,   55,   54,
+       54,   54,   28,   54,   54,   54,   54,   54,   17,   16,
+       36,   54,   22,   37,   54,   54,   19,   35,   54,   47,
+       54,   54,   54,   54,    8,   54,   54,   54,   54,   54,
+        0,   55,   11,    9,   54,   54,   41,   54,   54,   54,
+       30,   33,   54,   46,   38,   54,   54,   54,   15,   54,
+       54,   54,   23,    0,   55,   31,   10,   14,   54,   21,
+
+       18,   54,   54,   26,   13,   24,   20,   54,    0,   54,
+       54,   54,   29,    0,   32,   54,   12,    0,   54,    0,
+       54,    0,   49,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   58,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -451,185 +452,207 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[71] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    3,    1,
-        1,    1,    4,    5,    4,    1,    1,    1,    1,    1,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[240] =
+static const flex_int16_t yy_base[235] =
     {   0,
-        0,    0,  236,  218,  200,  885,   69,  885,  190,   66,
-      885,  172,   61,   64,  171,   69,   60,  153,   72,   74,
-       77,   79,   83,   96,   88,  110,  132,  108,  135,  142,
-      160,  144,  137,  162,  168,  181,  171,   94,  885,  153,
-       93,  885,  154,  885,  162,  101,    0,  193,  139,  197,
-      885,  123,  200,  203,  885,  885,  885,  206,  208,  218,
-      221,  223,  227,  234,  238,  242,  247,  244,  249,  251,
-      260,  264,  279,  289,  292,  281,  304,  283,  306,  309,
-      313,  320,  315,  332,  339,  346,  335,  360,  348,  353,
-      363,  885,  218,  103,    0,  378,  104,  386,  382,  253,
-
-      277,  373,  392,  396,  370,  402,  404,  413,  417,  399,
-      419,  426,  436,  430,  439,  447,  457,  460,  463,  465,
-      472,  474,  479,  486,  489,  491,  493,  499,  496,  502,
-      504,  515,  517,  519,  521,  223,   74,  528,  523,  535,
-      541,  543,  548,  552,  554,  558,  565,  567,  569,  573,
-      576,  583,  586,  593,  595,  597,  599,  607,  601,  611,
-      613,  618,  615,  621,  630,  637,  632,  646,  127,  654,
-      639,  662,  671,  673,  675,  678,  680,  682,  685,  691,
-      701,  703,  705,  707,  709,  711,  713,  718,  726,  731,
-      431,  735,  740,  744,  746,  748,  750,  754,  757,  760,
-
-      765,  771,  773,  775,  450,  779,  782,  784,  135,  786,
-      788,  792,  452,  797,  587,  799,  813,  807,  633,  650,
-      335,  655,  667,  474,  695,  722,   69,  885,  885,  855,
-      860,  862,  865,  866,  871,  873,  875,  877,  879
+        1,   72,   72,  143,  144,  145,  144,  147,  145,  149,
+      220,  206,  210,  210,  272,  213,  210,  208,  328,  377,
+      379,  423,  390,  413,  361,  375,  375,  375,  420,  437,
+      439,  385,  444,  432,  426,  442,  436,  282,  283,  270,
+      286,  288,  274,  290,  276,  279,  507,  557,  331,  346,
+      347,  335,  388,  404,  408,  415,  419,  421,  438,  579,
+      605,  603,  604,  423,  611,  600,  609,  391,  603,  601,
+      608,  603,  604,  611,  631,  617,  614,  627,  606,  617,
+      626,  629,  628,  644,  648,  647,  650,  662,  661,  654,
+      664,  460,  452,  468,  487,  697,  485,  481,  653,  497,
+
+      500,  714,  739,  732,  738,  738,  752,  749,  750,  753,
+      741,  739,  759,  748,  746,  758,  759,  750,  752,  758,
+      764,  501,  503,  504,  764,  754,  759,  767,  506,  753,
+      507,  761,  784,  779,  799,  786,  625,  644,  829,  835,
+      867,  868,  645,  874,  865,  866,  867,  868,  649,  687,
+      690,  869,  694,  697,  866,  873,  698,  699,  872,  700,
+      875,  873,  893,  893,  701,  892,  879,  895,  893,  897,
+      691,  928,  704,  705,  934,  960,  707,  976,  973,  978,
+      714,  778,  965,  823,  825,  966,  986,  969,  971,  986,
+      974,  993,  826,  812,  828,  829,  830,  832,  982,  833,
+
+      834,  789,  993,  836,  837,  838,  839,  980,  825,  994,
+      994,  990,  841,  830,  843,  993,  844,  831,  991,  832,
+      999,  899,  918,  908,  909,  909,  911,  925,  929,  989,
+      993, 1006, 1017, 1088
     } ;
 
-static const flex_int16_t yy_def[240] =
+static const flex_int16_t yy_def[235] =
     {   0,
-      229,    1,  230,  230,  229,  229,  229,  229,  229,  231,
-      229,  229,  229,  232,  233,  232,  229,  229,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  232,  229,  229,
-      229,  229,  231,  229,  231,  229,  235,  236,  232,  232,
-      229,  232,  236,  232,  229,  229,  229,  234,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      234,  229,  231,  229,  235,  237,  233,  232,  234,  234,
+      234,    1,    1,    3,  234,  234,    6,    6,    6,    1,
+        6,    6,   12,    6,    6,   14,    6,    6,   14,   19,
+       19,   20,   19,   23,   23,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   14,    6,    6,
+        7,    6,   10,    6,   10,   12,    6,   14,   14,   14,
+        6,   14,   48,   16,    6,    6,    6,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   23,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   24,
+       25,    6,   10,    6,   47,   14,   15,   14,   25,   25,
+
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   10,   94,   14,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   23,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       43,   14,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   10,   14,   25,   25,   25,   25,   25,
+
+       25,   25,   25,   25,   25,   25,   25,   25,   10,   25,
+       25,   25,   25,   43,   25,   25,   25,   10,   25,   10,
+       25,   43,   25,   10,   10,   43,   10,   10,   43,   10,
+       10,   43,    6,    0
+    } ;
 
+static const flex_int16_t yy_nxt[1159] =
+    {   0,
+        5,    6,    7,    8,    9,    7,   10,   11,   11,   11,
+       12,   11,   13,   14,   15,   16,    6,   11,   17,   11,
+       18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
+       28,   25,   29,   30,   25,   31,   25,   25,   32,   33,
+       34,   35,   36,   37,   25,   25,   38,   19,   20,   21,
+       22,   23,   24,   25,   26,   27,   28,   25,   29,   30,
+       25,   31,   25,   32,   33,   34,   35,   36,   37,   25,
+       25,    5,   39,   39,   39,   39,   39,   39,   39,   39,
+       40,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,    5,  234,    5,   41,    5,   42,   41,   43,
+       43,   43,   43,   43,   44,   43,   43,   43,   43,   43,
+       43,   43,   43,   45,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,    5,
+       46,   47,   48,   49,   50,   53,   57,   54,   55,   56,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       51,    5,    5,   92,   52,    5,   52,    5,   43,    5,
+       93,   94,   52,   52,   52,   52,   52,   52,   52,   52,
+
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   58,   50,   97,    5,    5,   50,   58,   59,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   60,   58,   58,   58,   58,   61,   58,   58,   58,
+       58,   58,   58,   58,   58,   59,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   60,   58,   58,
+       58,   61,   58,   58,   58,   58,   58,   58,   58,   74,
+
+       58,   62,   98,    5,   58,   63,   65,    5,   75,   76,
+       58,   58,   58,   66,    5,   58,   67,   58,    5,   84,
+        5,   64,    5,   58,   58,   74,   58,   62,   58,   58,
+      108,   63,   65,   71,   75,   76,   58,   58,   58,   66,
+       58,   67,   58,   68,   72,   84,   64,   69,   77,   58,
+       73,   58,   88,   58,   78,  108,   58,   79,   71,    5,
+       70,   89,   90,   91,   81,   80,  137,   58,   85,   68,
+       72,   86,   99,   69,   77,   73,   82,   58,   88,   83,
+       78,   58,  138,   79,   87,   70,    5,   89,   90,   91,
+       81,   80,   58,  234,   85,   98,    5,   86,   99,    5,
+
+        5,   82,    5,    5,   83,    5,    5,   95,   95,   87,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+
+       96,   96,  100,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,  101,  100,  102,
+      103,  104,  105,  107,  109,  111,  112,  113,  114,  171,
+      106,  110,  115,    5,    5,  119,  120,  121,    5,  122,
+      123,  124,  125,  101,  116,  102,  103,  104,  105,  107,
+      109,  111,  112,  113,  114,  106,  110,  126,  115,  117,
+      118,  119,  120,  121,  122,  127,  123,  124,  125,  128,
+      116,  130,  131,  132,  133,  134,    5,  129,  136,    5,
+      140,  135,  126,    5,  117,  118,    5,    5,    5,    5,
+
+        5,  127,  194,    5,    5,  128,    5,  130,  131,  132,
+      133,  134,  129,    5,  136,  140,  135,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  141,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  142,  141,  143,
+      144,  145,  146,  147,  148,  149,  150,    5,  151,  152,
+      153,  154,  155,  156,  157,  158,  159,  160,  161,  162,
+      163,  164,  166,  142,  143,  165,  144,  145,  146,  147,
+
+      148,  149,  150,  151,  167,  152,  153,  154,  155,  156,
+      157,  158,  159,  160,  161,  162,  163,  164,  166,  168,
+      165,  169,    5,  170,    5,    5,  209,    5,    5,    5,
+      167,    5,    5,    5,  211,    5,    5,    5,    5,  214,
+        5,  218,    5,    5,  168,  220,  222,  169,  170,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+      172,  172,  172,  172,  173,  172,  172,  172,  172,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  172,  173,
+
+      174,  175,  176,  224,  177,  178,  179,  180,  181,  182,
+      183,  184,  185,  186,  187,  188,  189,    5,  190,  191,
+      192,  193,  225,  226,  227,  228,  174,  175,  176,  177,
+      178,  179,  180,  181,  182,  183,  184,  185,  186,  229,
+      187,  188,  189,  190,  230,  191,  192,  193,  195,  195,
+      195,  195,  195,  195,  195,  195,  195,  195,  195,  195,
+      195,  195,  195,  195,  195,  195,  195,  195,  195,  195,
+      195,  195,  195,  196,  195,  195,  195,  195,  195,  195,
+      195,  195,  195,  195,  195,  195,  195,  195,  195,  195,
+      195,  195,  195,  195,  195,  195,  195,  195,  196,  197,
+
+      198,  199,  200,  231,  201,  202,  203,  232,  204,  205,
+      206,  233,  207,  208,  210,  212,    5,  213,  215,  216,
+      217,  219,  221,  223,  197,    0,  198,  199,  200,  201,
+      202,    0,  203,  204,  205,    0,  206,  207,    0,  208,
+      210,  212,  213,    0,  215,  216,  217,  219,  221,  223,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  234,  234,  234,
       234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
+
       234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
       234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      234,  234,  234,  234,  234,  231,  229,  238,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
       234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  234,  231,  239,
       234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
       234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      231,  232,  234,  234,  234,  234,  234,  234,  234,  234,
-
-      234,  234,  234,  234,  231,  234,  234,  234,  231,  234,
-      234,  234,  231,  234,  231,  234,  231,  234,  231,  231,
-      231,  231,  231,  231,  231,  231,  231,  229,    0,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229
-    } ;
-
-static const flex_int16_t yy_nxt[956] =
-    {   0,
-        6,    7,    8,    9,    7,   10,   11,   11,   11,   12,
-       11,   13,   14,   15,   16,    6,   11,   17,   11,   18,
-       19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
-       25,   29,   30,   25,   31,   25,   25,   32,   33,   34,
-       35,   36,   37,   25,   25,   38,   19,   20,   21,   22,
-       23,   24,   25,   26,   27,   28,   25,   29,   30,   25,
-       31,   25,   32,   33,   34,   35,   36,   37,   25,   25,
-       41,   44,   47,   41,  228,   46,   48,   49,   55,   56,
-       45,   53,   49,   54,   48,   49,   48,   49,  137,   48,
-       49,   48,   49,   59,   41,   48,   49,   41,   62,   68,
-
-       48,   49,   63,   69,   65,   60,   48,   49,   48,   49,
-       61,   66,  229,   94,   67,   46,   70,  137,   64,   59,
-       48,   49,   48,   49,   62,   68,   71,   72,   63,   69,
-       65,   60,   44,   73,   74,   61,   49,   66,  191,   67,
-       44,   70,   76,   64,   48,   49,  213,   48,   49,   48,
-       49,   71,   97,   72,   48,   49,   48,   49,   73,   44,
-       74,   85,   79,   77,   86,   75,   92,   44,   76,   78,
-       80,   57,   48,   49,   48,   49,   93,   87,   84,   51,
-       48,   49,   88,   48,   49,   81,   46,   85,   79,   77,
-       86,   75,   42,   48,   49,   78,   80,   82,   91,  229,
-
-       83,   90,   87,   89,   84,   48,   49,   50,   88,   48,
-       49,   81,   48,   49,   98,   53,   49,   54,   48,   49,
-       48,   49,   82,   44,   91,   83,   40,   90,   44,   89,
-       48,   49,  136,   48,   49,   48,   49,  169,   50,   48,
-       49,  100,   99,  101,   40,   50,   48,   49,  229,  102,
-       48,   49,  229,  103,   48,   49,   48,   49,  104,   48,
-       49,   48,   49,   48,   49,   48,   49,  100,   99,  101,
-      229,  107,   48,   49,  105,  102,   48,   49,  229,  103,
-      109,  229,  106,  108,  104,  111,  229,  110,  112,   48,
-       49,   48,   49,   48,   49,   48,   49,  107,  113,  229,
-
-      105,   48,   49,  121,   48,   49,  109,  106,  108,  119,
-      229,  111,  110,  114,  112,  116,   48,   49,   48,   49,
-      115,   48,   49,  229,  113,   48,   49,   48,   49,  121,
-      117,  118,   48,   49,  229,  119,  120,  229,  124,  114,
-       44,  116,  123,  125,   48,   49,  115,   48,   49,  122,
-      222,   48,   49,  229,  126,  117,  118,  229,   48,   49,
-       48,   49,  120,  127,  124,   48,   49,  131,  123,  125,
-      128,  133,   48,   49,  122,   48,   49,  229,  129,  126,
-      130,  132,   48,   49,  134,   48,   49,  135,  229,  127,
-       48,   49,   50,  131,   48,   49,  128,  133,   48,   49,
-
-       98,  140,  143,  129,   48,   49,  130,  132,   48,   49,
-      134,   48,   49,  135,   48,   49,   48,   49,  229,  139,
-      141,  148,  229,   50,  145,   48,   49,  140,  143,   48,
-       49,   48,   49,  142,  229,  144,   44,  146,   48,   49,
-      229,  147,   48,   49,  139,  205,  141,  148,   48,   49,
-      145,   48,   49,  229,  149,   44,  151,   44,  142,   48,
-       49,  144,  152,  146,  209,  150,  215,  147,  229,   48,
-       49,  154,   48,   49,  153,   48,   49,   48,   49,   44,
-      149,  155,  151,  229,   48,   49,   48,   49,  152,  225,
-      150,   48,   49,  158,  156,  159,  157,  154,   48,   49,
-
-      153,   48,   49,   48,   49,   48,   49,  155,   48,   49,
-      229,   48,   49,  160,   48,   49,   48,   49,  229,  158,
-      156,  159,  157,  163,  162,  229,  161,   48,   49,   48,
-       49,   48,   49,   48,   49,   48,   49,  166,  229,  160,
-       48,   49,   50,  229,  164,  229,  165,   48,   49,  163,
-      162,  229,  161,   48,   49,   48,   49,  229,  168,  167,
-       48,   49,  171,  166,   48,   49,   48,   49,  172,  164,
-       48,   49,  165,   50,  173,  229,  174,   48,   49,   48,
-       49,   48,   49,  168,  167,   48,   49,  171,   48,   49,
-      229,  175,   44,  176,  172,   48,   49,  177,   48,   49,
-
-      173,  217,  174,  229,  178,   48,   49,   48,   49,   48,
-       49,   48,   49,   48,   49,  179,  175,  229,  176,   48,
-       49,  229,  177,   48,   49,   48,   49,   48,   49,  178,
-       48,   49,  181,   48,   49,  229,  180,  186,   44,  185,
-      179,  229,   48,   49,   48,   49,  182,  220,  183,   48,
-       49,   48,   49,  184,  187,   44,  189,  181,   48,   49,
-       44,  180,  229,  186,  221,  185,   48,   49,   50,  223,
-      190,  182,   44,  183,   48,   49,  188,  229,  184,  229,
-      187,  224,  189,   48,   49,   48,   49,   48,   49,  229,
-       48,   49,   48,   49,   48,   49,  190,   48,   49,   50,
-
-       44,  188,  195,   48,   49,  229,  197,  229,  196,  226,
-      193,  229,  194,   48,   49,   48,   49,   48,   49,   48,
-       49,   48,   49,   48,   49,   48,   49,   44,  195,  200,
-       48,   49,  197,  229,  196,  193,  227,  194,   48,   49,
-      198,  229,  203,   48,   49,  229,  199,   48,   49,  229,
-      201,  202,   48,   49,  229,  200,   48,   49,   48,   49,
-       48,   49,   48,   49,  204,  198,   48,   49,  203,   48,
-       49,  199,   48,   49,  229,  201,  202,   48,   49,  229,
-      206,  229,  208,   48,   49,   48,   49,   48,   49,  204,
-      229,   48,   49,  229,   48,   49,   48,   49,   48,   49,
-
-       48,   49,  207,  210,   48,   49,  206,  211,  208,   48,
-       49,   48,   49,  229,  212,  229,  214,  219,   44,   48,
-       49,  229,  229,  218,  229,  229,  229,  229,  216,  210,
-      229,  229,  229,  211,  229,  229,  229,  229,  229,  229,
-      212,  229,  214,  229,  229,  229,  229,  229,  229,  218,
-      229,  229,  229,  229,  216,   39,   39,   39,   39,   39,
-       43,   43,   43,   43,   43,   50,   50,   52,   52,   58,
-       58,   95,  229,   95,   95,   95,   96,   96,  138,  138,
-      170,  170,  192,  192,    5,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229
+      234,  234,  234,  234,  234,  234,  234,  234
     } ;
 
-static const flex_int16_t yy_chk[956] =
+static const flex_int16_t yy_chk[1159] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -638,104 +661,126 @@ static const flex_int16_t yy_chk[956] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        7,   10,   13,    7,  227,   13,   14,   14,   17,   17,
-       10,   16,   16,   16,   19,   19,   20,   20,  137,   21,
-       21,   22,   22,   19,   41,   23,   23,   41,   20,   22,
-
-       25,   25,   20,   22,   21,   19,   38,   38,   24,   24,
-       19,   21,   97,   46,   21,   46,   22,   94,   20,   19,
-       28,   28,   26,   26,   20,   22,   23,   24,   20,   22,
-       21,   19,  169,   24,   26,   19,   52,   21,  169,   21,
-      209,   22,   28,   20,   27,   27,  209,   29,   29,   33,
-       33,   23,   49,   24,   30,   30,   32,   32,   24,   43,
-       26,   33,   30,   29,   33,   27,   40,   45,   28,   29,
-       30,   18,   31,   31,   34,   34,   45,   33,   32,   15,
-       35,   35,   34,   37,   37,   31,   12,   33,   30,   29,
-       33,   27,    9,   36,   36,   29,   30,   31,   37,    5,
-
-       31,   36,   33,   35,   32,   48,   48,   48,   34,   50,
-       50,   31,   53,   53,   53,   54,   54,   54,   58,   58,
-       59,   59,   31,   93,   37,   31,    4,   36,  136,   35,
-       60,   60,   93,   61,   61,   62,   62,  136,   48,   63,
-       63,   60,   59,   61,    3,   53,   64,   64,    0,   62,
-       65,   65,    0,   63,   66,   66,   68,   68,   65,   67,
-       67,   69,   69,   70,   70,  100,  100,   60,   59,   61,
-        0,   67,   71,   71,   66,   62,   72,   72,    0,   63,
-       69,    0,   66,   68,   65,   70,    0,   69,   71,  101,
-      101,   73,   73,   76,   76,   78,   78,   67,   72,    0,
-
-       66,   74,   74,   78,   75,   75,   69,   66,   68,   76,
-        0,   70,   69,   73,   71,   75,   77,   77,   79,   79,
-       74,   80,   80,    0,   72,   81,   81,   83,   83,   78,
-       75,   75,   82,   82,    0,   76,   77,    0,   81,   73,
-      221,   75,   80,   82,   84,   84,   74,   87,   87,   79,
-      221,   85,   85,    0,   83,   75,   75,    0,   86,   86,
-       89,   89,   77,   84,   81,   90,   90,   87,   80,   82,
-       85,   89,   88,   88,   79,   91,   91,    0,   85,   83,
-       86,   88,  105,  105,   90,  102,  102,   91,    0,   84,
-       96,   96,   96,   87,   99,   99,   85,   89,   98,   98,
-
-       98,  102,  105,   85,  103,  103,   86,   88,  104,  104,
-       90,  110,  110,   91,  106,  106,  107,  107,    0,   99,
-      103,  110,    0,   96,  107,  108,  108,  102,  105,  109,
-      109,  111,  111,  104,    0,  106,  191,  108,  112,  112,
-        0,  109,  114,  114,   99,  191,  103,  110,  113,  113,
-      107,  115,  115,    0,  111,  205,  113,  213,  104,  116,
-      116,  106,  114,  108,  205,  112,  213,  109,    0,  117,
-      117,  116,  118,  118,  115,  119,  119,  120,  120,  224,
-      111,  117,  113,    0,  121,  121,  122,  122,  114,  224,
-      112,  123,  123,  120,  118,  121,  119,  116,  124,  124,
-
-      115,  125,  125,  126,  126,  127,  127,  117,  129,  129,
-        0,  128,  128,  125,  130,  130,  131,  131,    0,  120,
-      118,  121,  119,  128,  127,    0,  126,  132,  132,  133,
-      133,  134,  134,  135,  135,  139,  139,  133,    0,  125,
-      138,  138,  138,    0,  130,    0,  132,  140,  140,  128,
-      127,    0,  126,  141,  141,  142,  142,    0,  135,  134,
-      143,  143,  139,  133,  144,  144,  145,  145,  140,  130,
-      146,  146,  132,  138,  141,    0,  143,  147,  147,  148,
-      148,  149,  149,  135,  134,  150,  150,  139,  151,  151,
-        0,  144,  215,  145,  140,  152,  152,  146,  153,  153,
-
-      141,  215,  143,    0,  147,  154,  154,  155,  155,  156,
-      156,  157,  157,  159,  159,  151,  144,    0,  145,  158,
-      158,    0,  146,  160,  160,  161,  161,  163,  163,  147,
-      162,  162,  155,  164,  164,    0,  154,  163,  219,  162,
-      151,    0,  165,  165,  167,  167,  158,  219,  160,  166,
-      166,  171,  171,  161,  165,  220,  167,  155,  168,  168,
-      222,  154,    0,  163,  220,  162,  170,  170,  170,  222,
-      168,  158,  223,  160,  172,  172,  166,    0,  161,    0,
-      165,  223,  167,  173,  173,  174,  174,  175,  175,    0,
-      176,  176,  177,  177,  178,  178,  168,  179,  179,  170,
-
-      225,  166,  176,  180,  180,    0,  178,    0,  177,  225,
-      173,    0,  174,  181,  181,  182,  182,  183,  183,  184,
-      184,  185,  185,  186,  186,  187,  187,  226,  176,  185,
-      188,  188,  178,    0,  177,  173,  226,  174,  189,  189,
-      181,    0,  188,  190,  190,    0,  184,  192,  192,    0,
-      186,  187,  193,  193,    0,  185,  194,  194,  195,  195,
-      196,  196,  197,  197,  189,  181,  198,  198,  188,  199,
-      199,  184,  200,  200,    0,  186,  187,  201,  201,    0,
-      196,    0,  200,  202,  202,  203,  203,  204,  204,  189,
-        0,  206,  206,    0,  207,  207,  208,  208,  210,  210,
-
-      211,  211,  199,  206,  212,  212,  196,  207,  200,  214,
-      214,  216,  216,    0,  208,    0,  211,  217,  217,  218,
-      218,    0,    0,  216,    0,    0,    0,    0,  214,  206,
-        0,    0,    0,  207,    0,    0,    0,    0,    0,    0,
-      208,    0,  211,    0,    0,    0,    0,    0,    0,  216,
-        0,    0,    0,    0,  214,  230,  230,  230,  230,  230,
-      231,  231,  231,  231,  231,  232,  232,  233,  233,  234,
-      234,  235,    0,  235,  235,  235,  236,  236,  237,  237,
-      238,  238,  239,  239,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229,  229,  229,  229,  229,  229,
-      229,  229,  229,  229,  229
+        1,    2,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    4,    5,    6,    7,    8,    9,    7,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   11,
+       12,   13,   14,   14,   14,   16,   18,   16,   17,   17,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       15,   38,   39,   40,   15,   41,   15,   42,   43,   44,
+       45,   46,   15,   15,   15,   15,   15,   15,   15,   15,
+
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   19,   49,   49,   50,   51,   52,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   20,   26,
+
+       21,   20,   53,   54,   25,   20,   21,   55,   27,   28,
+       20,   23,   21,   21,   56,   20,   21,   21,   57,   32,
+       58,   20,   64,   23,   20,   26,   21,   20,   23,   25,
+       68,   20,   21,   23,   27,   28,   20,   23,   21,   21,
+       20,   21,   21,   22,   24,   32,   20,   22,   29,   23,
+       24,   22,   34,   23,   29,   68,   24,   30,   23,   92,
+       22,   35,   36,   37,   31,   30,   93,   22,   33,   22,
+       24,   33,   59,   22,   29,   24,   31,   22,   34,   31,
+       29,   24,   94,   30,   33,   22,   95,   35,   36,   37,
+       31,   30,   22,   97,   33,   98,  100,   33,   59,  101,
+
+      122,   31,  123,  124,   31,  129,  131,   47,   47,   33,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+
+       48,   48,   60,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   61,   60,   62,
+       63,   65,   66,   67,   69,   70,   71,   72,   73,  137,
+       66,   69,   74,  138,  143,   76,   77,   78,  149,   79,
+       80,   81,   82,   61,   75,   62,   63,   65,   66,   67,
+       69,   70,   71,   72,   73,   66,   69,   83,   74,   75,
+       75,   76,   77,   78,   79,   84,   80,   81,   82,   85,
+       75,   86,   87,   88,   89,   90,  150,   85,   91,  151,
+       99,   90,   83,  153,   75,   75,  154,  157,  158,  160,
+
+      165,   84,  171,  173,  174,   85,  177,   86,   87,   88,
+       89,   90,   85,  181,   91,   99,   90,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,  102,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,  103,  102,  104,
+      105,  106,  107,  108,  109,  110,  111,  182,  112,  113,
+      114,  115,  116,  117,  118,  119,  120,  121,  125,  126,
+      127,  128,  132,  103,  104,  130,  105,  106,  107,  108,
+
+      109,  110,  111,  112,  133,  113,  114,  115,  116,  117,
+      118,  119,  120,  121,  125,  126,  127,  128,  132,  134,
+      130,  135,  184,  136,  185,  193,  194,  195,  196,  197,
+      133,  198,  200,  201,  202,  204,  205,  206,  207,  209,
+      213,  214,  215,  217,  134,  218,  220,  135,  136,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  140,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  140,
+
+      141,  142,  144,  222,  145,  146,  147,  148,  152,  155,
+      156,  159,  161,  162,  163,  164,  166,  223,  167,  168,
+      169,  170,  224,  225,  226,  227,  141,  142,  144,  145,
+      146,  147,  148,  152,  155,  156,  159,  161,  162,  228,
+      163,  164,  166,  167,  229,  168,  169,  170,  172,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+      172,  172,  172,  175,  172,  172,  172,  172,  172,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  172,  172,
+      172,  172,  172,  172,  172,  172,  172,  172,  175,  176,
+
+      178,  179,  180,  230,  183,  186,  187,  231,  188,  189,
+      190,  232,  191,  192,  199,  203,  233,  208,  210,  211,
+      212,  216,  219,  221,  176,    0,  178,  179,  180,  183,
+      186,    0,  187,  188,  189,    0,  190,  191,    0,  192,
+      199,  203,  208,    0,  210,  211,  212,  216,  219,  221,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  234,  234,  234,
+      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
+
+      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
+      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
+      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
+      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
+      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
+      234,  234,  234,  234,  234,  234,  234,  234
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -779,9 +824,9 @@ char *yytext;
         } \
     }
 
-#line 783 "lex.yy.cpp"
+#line 828 "lex.yy.cpp"
 
-#line 785 "lex.yy.cpp"
+#line 830 "lex.yy.cpp"
 
 #define INITIAL 0
 #define STATE_COMMENT 1
@@ -1019,7 +1064,7 @@ YY_DECL
 
 #line 52 "lex.l"
     /* block comment */
-#line 1023 "lex.yy.cpp"
+#line 1068 "lex.yy.cpp"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1046,13 +1091,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 230 )
+				if ( yy_current_state >= 235 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 885 );
+		while ( yy_base[yy_current_state] != 1088 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1224,144 +1269,149 @@ YY_RULE_SETUP
 case 29:
 YY_RULE_SETUP
 #line 84 "lex.l"
-{ return FLOAT; }
+{ return VARCHAR; }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
 #line 85 "lex.l"
-{return BIGINT;}
+{ return FLOAT; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 86 "lex.l"
-{return DATETIME;}
+{return BIGINT;}
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 87 "lex.l"
-{ return INDEX; }
+{return DATETIME;}
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 88 "lex.l"
-{ return AND; }
+{ return INDEX; }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
 #line 89 "lex.l"
-{return JOIN;}
+{ return AND; }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 90 "lex.l"
-{ return EXIT; }
+{return JOIN;}
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 91 "lex.l"
-{ return HELP; }
+{ return EXIT; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 92 "lex.l"
-{ return ORDER; }
+{ return HELP; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 93 "lex.l"
-{  return BY;  }
+{ return ORDER; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 94 "lex.l"
-{ return ASC; }
+{  return BY;  }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 95 "lex.l"
-{ return COUNT; }
+{ return ASC; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 96 "lex.l"
-{ return MAX; }
+{ return COUNT; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 97 "lex.l"
-{ return MIN; }
+{ return MAX; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 98 "lex.l"
-{ return SUM; }
+{ return MIN; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
 #line 99 "lex.l"
-{ return AS; }
+{ return SUM; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 100 "lex.l"
-{ return LIMIT; }
+{ return AS; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 102 "lex.l"
-{return LOAD; }
+#line 101 "lex.l"
+{ return LIMIT; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 103 "lex.l"
-{return OFF; }
+{return LOAD; }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 104 "lex.l"
-{return OUTPUT_FILE; }
+{return OFF; }
 	YY_BREAK
-/* operators */
 case 49:
 YY_RULE_SETUP
-#line 107 "lex.l"
-{ return GEQ; }
+#line 105 "lex.l"
+{return OUTPUT_FILE; }
 	YY_BREAK
+/* operators */
 case 50:
 YY_RULE_SETUP
 #line 108 "lex.l"
-{ return LEQ; }
+{ return GEQ; }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 109 "lex.l"
-{ return NEQ; }
+{ return LEQ; }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 111 "lex.l"
+#line 110 "lex.l"
+{ return NEQ; }
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+#line 112 "lex.l"
 { return yytext[0]; }
 	YY_BREAK
 /* id */
-case 53:
+case 54:
 YY_RULE_SETUP
-#line 113 "lex.l"
+#line 114 "lex.l"
 {
     yylval->sv_str = yytext;
     return IDENTIFIER;
 }
 	YY_BREAK
-case 54:
+case 55:
 YY_RULE_SETUP
-#line 118 "lex.l"
+#line 119 "lex.l"
 {
     yylval->sv_str = yytext;
     return PATH;
 }
 	YY_BREAK
-case 55:
+case 56:
 YY_RULE_SETUP
-#line 123 "lex.l"
+#line 124 "lex.l"
 {
     int64_t num = atoll(yytext);
     if(num >= INT_MIN && num <= INT_MAX)
@@ -1376,26 +1426,26 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 57:
 YY_RULE_SETUP
-#line 136 "lex.l"
+#line 137 "lex.l"
 {
     yylval->sv_float = atof(yytext);
     return VALUE_FLOAT;
 }
 	YY_BREAK
-case 57:
+case 58:
 YY_RULE_SETUP
-#line 141 "lex.l"
+#line 142 "lex.l"
 {
     yylval->sv_str = std::string(yytext + 1, strlen(yytext) - 2);
     return VALUE_DATETIME;
 }
 	YY_BREAK
-case 58:
-/* rule 58 can match eol */
+case 59:
+/* rule 59 can match eol */
 YY_RULE_SETUP
-#line 146 "lex.l"
+#line 147 "lex.l"
 {
     yylval->sv_str = std::string(yytext + 1, strlen(yytext) - 2);
     return VALUE_STRING;
@@ -1404,21 +1454,21 @@ YY_RULE_SETUP
 /* EOF */
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(STATE_COMMENT):
-#line 152 "lex.l"
+#line 153 "lex.l"
 { return T_EOF; }
 	YY_BREAK
 /* unexpected char */
-case 59:
+case 60:
 YY_RULE_SETUP
-#line 154 "lex.l"
+#line 155 "lex.l"
 { std::cerr << "Lexer Error: unexpected character " << yytext[0] << std::endl; }
 	YY_BREAK
-case 60:
+case 61:
 YY_RULE_SETUP
-#line 155 "lex.l"
+#line 156 "lex.l"
 ECHO;
 	YY_BREAK
-#line 1422 "lex.yy.cpp"
+#line 1472 "lex.yy.cpp"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -1713,7 +1763,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 230 )
+			if ( yy_current_state >= 235 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -1741,11 +1791,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 230 )
+		if ( yy_current_state >= 235 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 229);
+	yy_is_jam = (yy_current_state == 234);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -2384,6 +2434,6 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 155 "lex.l"
+#line 156 "lex.l"
 
 
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -34,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,14 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.5.1"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -66,12 +67,13 @@
 
 
 /* First part of user prologue.  */
-#line 1 "yacc.y"
+#line 1 "/root/repo/src/parser/yacc.y"
 
 #include "ast.h"
 #include "yacc.tab.h"
 #include <iostream>
 #include <memory>
+#include <strings.h>
 
 int yylex(YYSTYPE *yylval, YYLTYPE *yylloc);
 
@@ -81,7 +83,7 @@ void yyerror(YYLTYPE *locp, const char* s) {
 
 using namespace ast;
 
-#line 85 "yacc.tab.cpp"
+#line 87 "/root/repo/src/parser/yacc.tab.cpp"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -104,162 +106,119 @@ using namespace ast;
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
-#endif
-
-/* Use api.header.include to #include this header
-   instead of duplicating it here.  */
-#ifndef YY_YY_YACC_TAB_H_INCLUDED
-# define YY_YY_YACC_TAB_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    SHOW = 258,
-    TABLES = 259,
-    CREATE = 260,
-    TABLE = 261,
-    DROP = 262,
-    DESC = 263,
-    INSERT = 264,
-    INTO = 265,
-    VALUES = 266,
-    DELETE = 267,
-    FROM = 268,
-    ASC = 269,
-    ORDER = 270,
-    BY = 271,
-    WHERE = 272,
-    UPDATE = 273,
-    SET = 274,
-    SELECT = 275,
-    INT = 276,
-    CHAR = 277,
-    FLOAT = 278,
-    BIGINT = 279,
-    DATETIME = 280,
-    INDEX = 281,
-    AND = 282,
-    JOIN = 283,
-    EXIT = 284,
-    HELP = 285,
-    TXN_BEGIN = 286,
-    TXN_COMMIT = 287,
-    TXN_ABORT = 288,
-    TXN_ROLLBACK = 289,
-    ORDER_BY = 290,
-    COUNT = 291,
-    MAX = 292,
-    MIN = 293,
-    SUM = 294,
-    AS = 295,
-    LIMIT = 296,
-    OFF = 297,
-    LOAD = 298,
-    OUTPUT_FILE = 299,
-    LEQ = 300,
-    NEQ = 301,
-    GEQ = 302,
-    T_EOF = 303,
-    IDENTIFIER = 304,
-    VALUE_STRING = 305,
-    PATH = 306,
-    VALUE_INT = 307,
-    VALUE_FLOAT = 308,
-    VALUE_BIGINT = 309,
-    VALUE_DATETIME = 310
-  };
-#endif
-/* Tokens.  */
-#define SHOW 258
-#define TABLES 259
-#define CREATE 260
-#define TABLE 261
-#define DROP 262
-#define DESC 263
-#define INSERT 264
-#define INTO 265
-#define VALUES 266
-#define DELETE 267
-#define FROM 268
-#define ASC 269
-#define ORDER 270
-#define BY 271
-#define WHERE 272
-#define UPDATE 273
-#define SET 274
-#define SELECT 275
-#define INT 276
-#define CHAR 277
-#define FLOAT 278
-#define BIGINT 279
-#define DATETIME 280
-#define INDEX 281
-#define AND 282
-#define JOIN 283
-#define EXIT 284
-#define HELP 285
-#define TXN_BEGIN 286
-#define TXN_COMMIT 287
-#define TXN_ABORT 288
-#define TXN_ROLLBACK 289
-#define ORDER_BY 290
-#define COUNT 291
-#define MAX 292
-#define MIN 293
-#define SUM 294
-#define AS 295
-#define LIMIT 296
-#define OFF 297
-#define LOAD 298
-#define OUTPUT_FILE 299
-#define LEQ 300
-#define NEQ 301
-#define GEQ 302
-#define T_EOF 303
-#define IDENTIFIER 304
-#define VALUE_STRING 305
-#define PATH 306
-#define VALUE_INT 307
-#define VALUE_FLOAT 308
-#define VALUE_BIGINT 309
-#define VALUE_DATETIME 310
-
-/* Value type.  */
-
-/* Location type.  */
-#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE YYLTYPE;
-struct YYLTYPE
+#include "yacc.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SHOW = 3,                       /* SHOW  */
+  YYSYMBOL_TABLES = 4,                     /* TABLES  */
+  YYSYMBOL_CREATE = 5,                     /* CREATE  */
+  YYSYMBOL_TABLE = 6,                      /* TABLE  */
+  YYSYMBOL_DROP = 7,                       /* DROP  */
+  YYSYMBOL_DESC = 8,                       /* DESC  */
+  YYSYMBOL_INSERT = 9,                     /* INSERT  */
+  YYSYMBOL_INTO = 10,                      /* INTO  */
+  YYSYMBOL_VALUES = 11,                    /* VALUES  */
+  YYSYMBOL_DELETE = 12,                    /* DELETE  */
+  YYSYMBOL_FROM = 13,                      /* FROM  */
+  YYSYMBOL_ASC = 14,                       /* ASC  */
+  YYSYMBOL_ORDER = 15,                     /* ORDER  */
+  YYSYMBOL_BY = 16,                        /* BY  */
+  YYSYMBOL_WHERE = 17,                     /* WHERE  */
+  YYSYMBOL_UPDATE = 18,                    /* UPDATE  */
+  YYSYMBOL_SET = 19,                       /* SET  */
+  YYSYMBOL_SELECT = 20,                    /* SELECT  */
+  YYSYMBOL_INT = 21,                       /* INT  */
+  YYSYMBOL_CHAR = 22,                      /* CHAR  */
+  YYSYMBOL_VARCHAR = 23,                   /* VARCHAR  */
+  YYSYMBOL_FLOAT = 24,                     /* FLOAT  */
+  YYSYMBOL_BIGINT = 25,                    /* BIGINT  */
+  YYSYMBOL_DATETIME = 26,                  /* DATETIME  */
+  YYSYMBOL_INDEX = 27,                     /* INDEX  */
+  YYSYMBOL_AND = 28,                       /* AND  */
+  YYSYMBOL_JOIN = 29,                      /* JOIN  */
+  YYSYMBOL_EXIT = 30,                      /* EXIT  */
+  YYSYMBOL_HELP = 31,                      /* HELP  */
+  YYSYMBOL_TXN_BEGIN = 32,                 /* TXN_BEGIN  */
+  YYSYMBOL_TXN_COMMIT = 33,                /* TXN_COMMIT  */
+  YYSYMBOL_TXN_ABORT = 34,                 /* TXN_ABORT  */
+  YYSYMBOL_TXN_ROLLBACK = 35,              /* TXN_ROLLBACK  */
+  YYSYMBOL_ORDER_BY = 36,                  /* ORDER_BY  */
+  YYSYMBOL_COUNT = 37,                     /* COUNT  */
+  YYSYMBOL_MAX = 38,                       /* MAX  */
+  YYSYMBOL_MIN = 39,                       /* MIN  */
+  YYSYMBOL_SUM = 40,                       /* SUM  */
+  YYSYMBOL_AS = 41,                        /* AS  */
+  YYSYMBOL_LIMIT = 42,                     /* LIMIT  */
+  YYSYMBOL_OFF = 43,                       /* OFF  */
+  YYSYMBOL_LOAD = 44,                      /* LOAD  */
+  YYSYMBOL_OUTPUT_FILE = 45,               /* OUTPUT_FILE  */
+  YYSYMBOL_LEQ = 46,                       /* LEQ  */
+  YYSYMBOL_NEQ = 47,                       /* NEQ  */
+  YYSYMBOL_GEQ = 48,                       /* GEQ  */
+  YYSYMBOL_T_EOF = 49,                     /* T_EOF  */
+  YYSYMBOL_IDENTIFIER = 50,                /* IDENTIFIER  */
+  YYSYMBOL_VALUE_STRING = 51,              /* VALUE_STRING  */
+  YYSYMBOL_PATH = 52,                      /* PATH  */
+  YYSYMBOL_VALUE_INT = 53,                 /* VALUE_INT  */
+  YYSYMBOL_VALUE_FLOAT = 54,               /* VALUE_FLOAT  */
+  YYSYMBOL_VALUE_BIGINT = 55,              /* VALUE_BIGINT  */
+  YYSYMBOL_VALUE_DATETIME = 56,            /* VALUE_DATETIME  */
+  YYSYMBOL_57_ = 57,                       /* ';'  */
+  YYSYMBOL_58_ = 58,                       /* '('  */
+  YYSYMBOL_59_ = 59,                       /* ')'  */
+  YYSYMBOL_60_ = 60,                       /* '='  */
+  YYSYMBOL_61_ = 61,                       /* ','  */
+  YYSYMBOL_62_ = 62,                       /* '.'  */
+  YYSYMBOL_63_ = 63,                       /* '<'  */
+  YYSYMBOL_64_ = 64,                       /* '>'  */
+  YYSYMBOL_65_ = 65,                       /* '*'  */
+  YYSYMBOL_YYACCEPT = 66,                  /* $accept  */
+  YYSYMBOL_start = 67,                     /* start  */
+  YYSYMBOL_stmt = 68,                      /* stmt  */
+  YYSYMBOL_loadStmt = 69,                  /* loadStmt  */
+  YYSYMBOL_offStmt = 70,                   /* offStmt  */
+  YYSYMBOL_txnStmt = 71,                   /* txnStmt  */
+  YYSYMBOL_dbStmt = 72,                    /* dbStmt  */
+  YYSYMBOL_ddl = 73,                       /* ddl  */
+  YYSYMBOL_dml = 74,                       /* dml  */
+  YYSYMBOL_fieldList = 75,                 /* fieldList  */
+  YYSYMBOL_colNameList = 76,               /* colNameList  */
+  YYSYMBOL_field = 77,                     /* field  */
+  YYSYMBOL_type = 78,                      /* type  */
+  YYSYMBOL_valueList = 79,                 /* valueList  */
+  YYSYMBOL_value = 80,                     /* value  */
+  YYSYMBOL_condition = 81,                 /* condition  */
+  YYSYMBOL_optWhereClause = 82,            /* optWhereClause  */
+  YYSYMBOL_whereClause = 83,               /* whereClause  */
+  YYSYMBOL_col = 84,                       /* col  */
+  YYSYMBOL_colList = 85,                   /* colList  */
+  YYSYMBOL_op = 86,                        /* op  */
+  YYSYMBOL_expr = 87,                      /* expr  */
+  YYSYMBOL_setClauses = 88,                /* setClauses  */
+  YYSYMBOL_setClause = 89,                 /* setClause  */
+  YYSYMBOL_setExpr = 90,                   /* setExpr  */
+  YYSYMBOL_selector = 91,                  /* selector  */
+  YYSYMBOL_aggregator = 92,                /* aggregator  */
+  YYSYMBOL_aggre_sum = 93,                 /* aggre_sum  */
+  YYSYMBOL_aggre_max = 94,                 /* aggre_max  */
+  YYSYMBOL_aggre_min = 95,                 /* aggre_min  */
+  YYSYMBOL_aggre_count = 96,               /* aggre_count  */
+  YYSYMBOL_tableList = 97,                 /* tableList  */
+  YYSYMBOL_opt_order_clause = 98,          /* opt_order_clause  */
+  YYSYMBOL_order_clauses = 99,             /* order_clauses  */
+  YYSYMBOL_order_clause = 100,             /* order_clause  */
+  YYSYMBOL_opt_asc_desc = 101,             /* opt_asc_desc  */
+  YYSYMBOL_tbName = 102,                   /* tbName  */
+  YYSYMBOL_colName = 103,                  /* colName  */
+  YYSYMBOL_fileName = 104                  /* fileName  */
 };
-# define YYLTYPE_IS_DECLARED 1
-# define YYLTYPE_IS_TRIVIAL 1
-#endif
-
-
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-int yyparse (void);
-
-#endif /* !YY_YY_YACC_TAB_H_INCLUDED  */
 
 
 
@@ -300,6 +259,18 @@ typedef int_least16_t yytype_int16;
 typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
 #elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
@@ -359,6 +330,7 @@ typedef int yytype_uint16;
 
 #define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
+
 /* Stored state numbers (used for stacks). */
 typedef yytype_uint8 yy_state_t;
 
@@ -377,6 +349,7 @@ typedef int yy_state_fast_t;
 # endif
 #endif
 
+
 #ifndef YY_ATTRIBUTE_PURE
 # if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
 #  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
@@ -395,17 +368,23 @@ typedef int yy_state_fast_t;
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
     _Pragma ("GCC diagnostic push")                                     \
     _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
 # define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
@@ -434,7 +413,7 @@ typedef int yy_state_fast_t;
 
 #define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -499,8 +478,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -568,25 +546,27 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  56
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   176
+#define YYLAST   183
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  65
+#define YYNTOKENS  66
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  39
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  94
+#define YYNRULES  96
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  188
+#define YYNSTATES  195
 
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   310
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   311
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  (0 <= (YYX) && (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
@@ -596,9 +576,9 @@ static const yytype_int8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-      57,    58,    64,     2,    59,     2,    60,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,    56,
-      62,    61,    63,     2,     2,     2,     2,     2,     2,     2,
+      58,    59,    65,     2,    61,     2,    62,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    57,
+      63,    60,    64,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -623,40 +603,47 @@ static const yytype_int8 yytranslate[] =
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55
+      55,    56
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,    64,    64,    69,    74,    79,    84,    92,    93,    94,
-      95,    96,   100,   107,   114,   118,   122,   126,   133,   137,
-     144,   148,   152,   156,   160,   167,   171,   175,   179,   183,
-     190,   194,   201,   205,   212,   219,   223,   227,   231,   235,
-     242,   246,   253,   257,   261,   265,   269,   276,   283,   284,
-     291,   295,   302,   306,   313,   317,   324,   328,   332,   336,
-     340,   344,   351,   355,   362,   366,   373,   380,   384,   392,
-     396,   400,   404,   408,   412,   416,   423,   430,   437,   444,
-     451,   455,   459,   466,   470,   474,   478,   482,   489,   496,
-     497,   498,   501,   503,   505
+       0,    65,    65,    70,    75,    80,    85,    93,    94,    95,
+      96,    97,   101,   108,   115,   119,   123,   127,   134,   138,
+     145,   149,   159,   163,   167,   171,   178,   182,   186,   190,
+     194,   201,   205,   212,   216,   223,   230,   234,   238,   242,
+     246,   250,   257,   261,   268,   272,   276,   280,   284,   291,
+     298,   299,   306,   310,   317,   321,   328,   332,   339,   343,
+     347,   351,   355,   359,   366,   370,   377,   381,   388,   395,
+     399,   407,   411,   415,   419,   423,   427,   431,   438,   445,
+     452,   459,   466,   470,   474,   481,   485,   489,   493,   497,
+     504,   511,   512,   513,   516,   518,   520
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 1
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SHOW", "TABLES", "CREATE", "TABLE",
-  "DROP", "DESC", "INSERT", "INTO", "VALUES", "DELETE", "FROM", "ASC",
-  "ORDER", "BY", "WHERE", "UPDATE", "SET", "SELECT", "INT", "CHAR",
-  "FLOAT", "BIGINT", "DATETIME", "INDEX", "AND", "JOIN", "EXIT", "HELP",
-  "TXN_BEGIN", "TXN_COMMIT", "TXN_ABORT", "TXN_ROLLBACK", "ORDER_BY",
-  "COUNT", "MAX", "MIN", "SUM", "AS", "LIMIT", "OFF", "LOAD",
+  "\"end of file\"", "error", "\"invalid token\"", "SHOW", "TABLES",
+  "CREATE", "TABLE", "DROP", "DESC", "INSERT", "INTO", "VALUES", "DELETE",
+  "FROM", "ASC", "ORDER", "BY", "WHERE", "UPDATE", "SET", "SELECT", "INT",
+  "CHAR", "VARCHAR", "FLOAT", "BIGINT", "DATETIME", "INDEX", "AND", "JOIN",
+  "EXIT", "HELP", "TXN_BEGIN", "TXN_COMMIT", "TXN_ABORT", "TXN_ROLLBACK",
+  "ORDER_BY", "COUNT", "MAX", "MIN", "SUM", "AS", "LIMIT", "OFF", "LOAD",
   "OUTPUT_FILE", "LEQ", "NEQ", "GEQ", "T_EOF", "IDENTIFIER",
   "VALUE_STRING", "PATH", "VALUE_INT", "VALUE_FLOAT", "VALUE_BIGINT",
-  "VALUE_DATETIME", "';'", "'('", "')'", "','", "'.'", "'='", "'<'", "'>'",
+  "VALUE_DATETIME", "';'", "'('", "')'", "'='", "','", "'.'", "'<'", "'>'",
   "'*'", "$accept", "start", "stmt", "loadStmt", "offStmt", "txnStmt",
   "dbStmt", "ddl", "dml", "fieldList", "colNameList", "field", "type",
   "valueList", "value", "condition", "optWhereClause", "whereClause",
@@ -665,213 +652,210 @@ static const char *const yytname[] =
   "aggre_count", "tableList", "opt_order_clause", "order_clauses",
   "order_clause", "opt_asc_desc", "tbName", "colName", "fileName", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,    59,    40,    41,    44,
-      46,    61,    60,    62,    42
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF (-93)
+#define YYPACT_NINF (-106)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-93)
+#define YYTABLE_NINF (-95)
 
 #define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      70,     3,     8,    14,   -30,    13,    20,   -30,    18,     0,
-     -93,   -93,   -93,   -93,   -93,   -93,    12,   -93,    74,    24,
-     -93,   -93,   -93,   -93,   -93,   -93,   -93,    63,   -30,   -30,
-     -30,   -30,   -93,   -93,   -30,   -30,    64,    39,   -93,   -93,
-     -93,   -93,    31,   -93,   -93,    28,    84,    85,    48,    49,
-      50,    53,    59,   -93,   -93,   112,   -93,   -93,   -30,    76,
-      78,   -93,    86,   117,   125,    95,   -93,    96,   -30,   -30,
-      95,    95,    95,   -19,    95,   -30,   -93,    95,    95,    95,
-      89,    96,   -93,   -93,   -12,   -93,    73,   -93,   -15,   -93,
-     125,    90,    91,    92,    93,    94,   -93,   -93,   -37,   -93,
-     116,   -16,   -93,    -7,    77,   -93,   120,    23,    95,   -93,
-      62,   -30,   -30,   138,   -93,   114,   115,   118,   119,   121,
-     -93,    95,   -93,    99,   -93,   -93,   -93,   -93,   -93,    95,
-     -93,   -93,   -93,   -93,   -93,   -93,     2,   -93,    96,   -93,
-     -93,   -93,   -93,   -93,   -93,    71,   -93,   -93,   -93,    77,
-     -93,   -93,   141,   -93,    95,    95,    95,    95,    95,   -93,
-     110,   -93,   -93,    77,   -93,   -93,   -93,   -93,   -93,    96,
-     -93,   -93,   -93,   -93,   -93,   105,   -93,    27,   -35,   -93,
-     -93,   -93,   -93,   -93,   113,    96,   -93,   -93
+      68,     9,     8,    13,   -48,    20,    25,   -48,   -12,   -16,
+    -106,  -106,  -106,  -106,  -106,  -106,    -5,  -106,    42,    -4,
+    -106,  -106,  -106,  -106,  -106,  -106,  -106,    44,   -48,   -48,
+     -48,   -48,  -106,  -106,   -48,   -48,    45,    24,  -106,  -106,
+    -106,  -106,     1,  -106,  -106,    46,    56,    57,    16,    27,
+      61,    62,    73,  -106,  -106,   120,  -106,  -106,   -48,    81,
+      82,  -106,    83,   131,   126,    94,  -106,    95,   -48,   -48,
+      94,    94,    94,   -21,    94,   -48,  -106,    94,    94,    94,
+      88,    95,  -106,  -106,   -10,  -106,    87,  -106,   -11,  -106,
+     126,    89,    90,    91,    92,    93,  -106,  -106,    -7,  -106,
+     102,    30,  -106,    31,    78,  -106,   125,    58,    94,  -106,
+      28,   -48,   -48,   139,  -106,   114,   115,   116,   117,   118,
+     110,    94,  -106,   103,   104,  -106,  -106,  -106,  -106,  -106,
+      94,  -106,  -106,  -106,  -106,  -106,  -106,    77,  -106,    95,
+    -106,  -106,  -106,  -106,  -106,  -106,    60,  -106,  -106,  -106,
+      78,  -106,  -106,   148,  -106,    94,    94,    94,    94,    94,
+     105,  -106,   113,   119,  -106,  -106,    78,  -106,  -106,  -106,
+    -106,  -106,    95,  -106,  -106,  -106,  -106,  -106,   121,   108,
+     109,  -106,    29,   -22,  -106,  -106,  -106,  -106,  -106,  -106,
+    -106,   122,    95,  -106,  -106
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_int8 yydefact[] =
 {
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        5,     4,    14,    15,    16,    17,     0,     6,     0,     0,
       11,     3,    10,     7,     8,     9,    18,     0,     0,     0,
-       0,     0,    92,    22,     0,     0,     0,     0,    79,    77,
-      78,    76,    93,    69,    54,    70,     0,     0,     0,     0,
-       0,     0,     0,    53,    94,     0,     1,     2,     0,     0,
-       0,    21,     0,     0,    48,     0,    13,     0,     0,     0,
+       0,     0,    94,    23,     0,     0,     0,     0,    81,    79,
+      80,    78,    95,    71,    56,    72,     0,     0,     0,     0,
+       0,     0,     0,    55,    96,     0,     1,     2,     0,     0,
+       0,    22,     0,     0,    50,     0,    13,     0,     0,     0,
        0,     0,     0,     0,     0,     0,    19,     0,     0,     0,
-       0,     0,    26,    93,    48,    64,     0,    55,    48,    80,
-      48,     0,     0,     0,     0,     0,    52,    12,     0,    30,
-       0,     0,    32,     0,     0,    50,    49,     0,     0,    27,
-       0,     0,     0,    85,    29,     0,     0,     0,     0,     0,
-      20,     0,    35,     0,    37,    38,    39,    34,    23,     0,
-      24,    44,    42,    43,    45,    46,     0,    40,     0,    60,
-      59,    61,    56,    57,    58,     0,    65,    67,    66,     0,
-      82,    81,     0,    28,     0,     0,     0,     0,     0,    31,
-       0,    33,    25,     0,    51,    62,    63,    47,    68,     0,
-      71,    72,    73,    74,    75,     0,    41,    91,    83,    86,
-      36,    90,    89,    88,     0,     0,    84,    87
+       0,     0,    27,    95,    50,    66,     0,    57,    50,    82,
+      50,     0,     0,     0,     0,     0,    54,    12,     0,    31,
+       0,     0,    33,     0,     0,    52,    51,     0,     0,    28,
+       0,     0,     0,    87,    30,     0,     0,     0,     0,     0,
+      20,     0,    36,     0,     0,    39,    40,    41,    35,    24,
+       0,    25,    46,    44,    45,    47,    48,     0,    42,     0,
+      62,    61,    63,    58,    59,    60,     0,    67,    69,    68,
+       0,    84,    83,     0,    29,     0,     0,     0,     0,     0,
+       0,    32,     0,     0,    34,    26,     0,    53,    64,    65,
+      49,    70,     0,    73,    74,    75,    76,    77,     0,     0,
+       0,    43,    93,    85,    88,    21,    37,    38,    92,    91,
+      90,     0,     0,    86,    89
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-     -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,
-      87,    43,   -93,   -93,   -92,    29,   -34,   -93,    -9,   -93,
-     -93,   -93,   -93,    60,   -93,   -93,   -93,   -93,   -93,   -93,
-     -93,   -93,   -93,   -93,   -14,   -93,    -3,   -62,   -93
+    -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,
+      97,    48,  -106,  -106,  -105,    34,   -28,  -106,    -9,  -106,
+    -106,  -106,  -106,    66,  -106,  -106,  -106,  -106,  -106,  -106,
+    -106,  -106,  -106,  -106,   -15,  -106,    -3,   -62,  -106
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
 {
-      -1,    18,    19,    20,    21,    22,    23,    24,    25,    98,
-     101,    99,   127,   136,   137,   105,    82,   106,   107,    45,
-     145,   167,    84,    85,   148,    46,    47,    48,    49,    50,
-      51,    88,   153,   178,   179,   183,    52,    53,    55
+       0,    18,    19,    20,    21,    22,    23,    24,    25,    98,
+     101,    99,   128,   137,   138,   105,    82,   106,   107,    45,
+     146,   170,    84,    85,   149,    46,    47,    48,    49,    50,
+      51,    88,   154,   183,   184,   190,    52,    53,    55
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      44,    33,    81,    86,    36,    81,   184,    26,    91,    92,
-      93,    95,    96,   111,    28,   100,   102,   102,   147,    32,
-      30,   120,   121,    34,   185,    59,    60,    61,    62,    27,
-      83,    63,    64,    35,    29,   181,    38,    39,    40,    41,
-      31,   182,   128,   129,   112,    94,    86,   108,   149,    42,
-     109,   130,   129,   165,   113,    76,   114,   168,    87,   100,
-     162,   163,    37,    54,    43,    89,    90,   161,   139,   140,
-     141,   176,    97,     1,    56,     2,    58,     3,     4,     5,
-      57,    66,     6,    65,   142,   143,   144,    67,     7,     8,
-       9,   -92,   170,   171,   172,   173,   174,    68,    69,    10,
-      11,    12,    13,    14,    15,    70,    71,    72,   150,   151,
-      73,    83,   131,    16,   132,   133,   134,   135,    17,    74,
-      42,   131,    75,   132,   133,   134,   135,   131,    80,   132,
-     133,   134,   135,    77,   110,    78,   166,   122,   123,   124,
-     125,   126,    81,    79,    83,    42,   104,   138,   115,   116,
-     117,   118,   119,   152,   154,   155,   160,   169,   156,   157,
-     177,   158,   175,   180,   159,   186,   103,   164,   146,     0,
-       0,   187,     0,     0,     0,     0,   177
+      44,    33,    32,    86,    36,   148,    81,    81,    91,    92,
+      93,    95,    96,    26,    28,   100,   102,   102,   111,    30,
+     191,    38,    39,    40,    41,    59,    60,    61,    62,    83,
+      34,    63,    64,    37,    42,    29,    27,   188,    35,   192,
+      31,   168,    56,   189,    94,   171,    86,    54,   150,    43,
+     112,   108,   120,    57,   121,    76,   109,    58,    87,   100,
+     113,   181,   114,   -94,    65,    89,    90,    66,   164,    68,
+      69,     1,    97,     2,    70,     3,     4,     5,    83,   132,
+       6,   133,   134,   135,   136,    71,     7,     8,     9,   129,
+     131,   130,   130,   173,   174,   175,   176,   177,    10,    11,
+      12,    13,    14,    15,   140,   141,   142,    67,   151,   152,
+      42,   132,    16,   133,   134,   135,   136,    17,   143,    72,
+      73,   144,   145,   122,   123,   124,   125,   126,   127,   132,
+      75,   133,   134,   135,   136,    74,   165,   169,   166,    77,
+      78,    79,    80,    81,    83,    42,   104,   110,   115,   116,
+     117,   118,   119,   139,   153,   155,   156,   157,   158,   159,
+     160,   162,   163,   182,   172,   178,   179,   186,   187,   161,
+       0,   185,   180,   167,   147,   193,   103,   194,     0,     0,
+       0,     0,     0,   182
 };
 
 static const yytype_int16 yycheck[] =
 {
-       9,     4,    17,    65,     7,    17,    41,     4,    70,    71,
-      72,    73,    74,    28,     6,    77,    78,    79,   110,    49,
-       6,    58,    59,    10,    59,    28,    29,    30,    31,    26,
-      49,    34,    35,    13,    26,     8,    36,    37,    38,    39,
-      26,    14,    58,    59,    59,    64,   108,    59,   110,    49,
-      84,    58,    59,   145,    88,    58,    90,   149,    67,   121,
-      58,    59,    44,    51,    64,    68,    69,   129,    45,    46,
-      47,   163,    75,     3,     0,     5,    13,     7,     8,     9,
-      56,    42,    12,    19,    61,    62,    63,    59,    18,    19,
-      20,    60,   154,   155,   156,   157,   158,    13,    13,    29,
-      30,    31,    32,    33,    34,    57,    57,    57,   111,   112,
-      57,    49,    50,    43,    52,    53,    54,    55,    48,    60,
-      49,    50,    10,    52,    53,    54,    55,    50,    11,    52,
-      53,    54,    55,    57,    61,    57,   145,    21,    22,    23,
-      24,    25,    17,    57,    49,    49,    57,    27,    58,    58,
-      58,    58,    58,    15,    40,    40,    57,    16,    40,    40,
-     169,    40,    52,    58,   121,    52,    79,   138,   108,    -1,
-      -1,   185,    -1,    -1,    -1,    -1,   185
+       9,     4,    50,    65,     7,   110,    17,    17,    70,    71,
+      72,    73,    74,     4,     6,    77,    78,    79,    29,     6,
+      42,    37,    38,    39,    40,    28,    29,    30,    31,    50,
+      10,    34,    35,    45,    50,    27,    27,     8,    13,    61,
+      27,   146,     0,    14,    65,   150,   108,    52,   110,    65,
+      61,    61,    59,    57,    61,    58,    84,    13,    67,   121,
+      88,   166,    90,    62,    19,    68,    69,    43,   130,    13,
+      13,     3,    75,     5,    58,     7,     8,     9,    50,    51,
+      12,    53,    54,    55,    56,    58,    18,    19,    20,    59,
+      59,    61,    61,   155,   156,   157,   158,   159,    30,    31,
+      32,    33,    34,    35,    46,    47,    48,    61,   111,   112,
+      50,    51,    44,    53,    54,    55,    56,    49,    60,    58,
+      58,    63,    64,    21,    22,    23,    24,    25,    26,    51,
+      10,    53,    54,    55,    56,    62,    59,   146,    61,    58,
+      58,    58,    11,    17,    50,    50,    58,    60,    59,    59,
+      59,    59,    59,    28,    15,    41,    41,    41,    41,    41,
+      50,    58,    58,   172,    16,    60,    53,    59,    59,   121,
+      -1,    50,    53,   139,   108,    53,    79,   192,    -1,    -1,
+      -1,    -1,    -1,   192
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
        0,     3,     5,     7,     8,     9,    12,    18,    19,    20,
-      29,    30,    31,    32,    33,    34,    43,    48,    66,    67,
-      68,    69,    70,    71,    72,    73,     4,    26,     6,    26,
-       6,    26,    49,   101,    10,    13,   101,    44,    36,    37,
-      38,    39,    49,    64,    83,    84,    90,    91,    92,    93,
-      94,    95,   101,   102,    51,   103,     0,    56,    13,   101,
-     101,   101,   101,   101,   101,    19,    42,    59,    13,    13,
-      57,    57,    57,    57,    60,    10,   101,    57,    57,    57,
-      11,    17,    81,    49,    87,    88,   102,    83,    96,   101,
-     101,   102,   102,   102,    64,   102,   102,   101,    74,    76,
-     102,    75,   102,    75,    57,    80,    82,    83,    59,    81,
-      61,    28,    59,    81,    81,    58,    58,    58,    58,    58,
-      58,    59,    21,    22,    23,    24,    25,    77,    58,    59,
-      58,    50,    52,    53,    54,    55,    78,    79,    27,    45,
-      46,    47,    61,    62,    63,    85,    88,    79,    89,   102,
-     101,   101,    15,    97,    40,    40,    40,    40,    40,    76,
-      57,   102,    58,    59,    80,    79,    83,    86,    79,    16,
-     102,   102,   102,   102,   102,    52,    79,    83,    98,    99,
-      58,     8,    14,   100,    41,    59,    52,    99
+      30,    31,    32,    33,    34,    35,    44,    49,    67,    68,
+      69,    70,    71,    72,    73,    74,     4,    27,     6,    27,
+       6,    27,    50,   102,    10,    13,   102,    45,    37,    38,
+      39,    40,    50,    65,    84,    85,    91,    92,    93,    94,
+      95,    96,   102,   103,    52,   104,     0,    57,    13,   102,
+     102,   102,   102,   102,   102,    19,    43,    61,    13,    13,
+      58,    58,    58,    58,    62,    10,   102,    58,    58,    58,
+      11,    17,    82,    50,    88,    89,   103,    84,    97,   102,
+     102,   103,   103,   103,    65,   103,   103,   102,    75,    77,
+     103,    76,   103,    76,    58,    81,    83,    84,    61,    82,
+      60,    29,    61,    82,    82,    59,    59,    59,    59,    59,
+      59,    61,    21,    22,    23,    24,    25,    26,    78,    59,
+      61,    59,    51,    53,    54,    55,    56,    79,    80,    28,
+      46,    47,    48,    60,    63,    64,    86,    89,    80,    90,
+     103,   102,   102,    15,    98,    41,    41,    41,    41,    41,
+      50,    77,    58,    58,   103,    59,    61,    81,    80,    84,
+      87,    80,    16,   103,   103,   103,   103,   103,    60,    53,
+      53,    80,    84,    99,   100,    50,    59,    59,     8,    14,
+     101,    42,    61,    53,   100
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
-       0,    65,    66,    66,    66,    66,    66,    67,    67,    67,
-      67,    67,    68,    69,    70,    70,    70,    70,    71,    71,
-      72,    72,    72,    72,    72,    73,    73,    73,    73,    73,
-      74,    74,    75,    75,    76,    77,    77,    77,    77,    77,
-      78,    78,    79,    79,    79,    79,    79,    80,    81,    81,
-      82,    82,    83,    83,    84,    84,    85,    85,    85,    85,
-      85,    85,    86,    86,    87,    87,    88,    89,    89,    90,
-      90,    91,    91,    91,    91,    91,    92,    93,    94,    95,
-      96,    96,    96,    97,    97,    97,    98,    98,    99,   100,
-     100,   100,   101,   102,   103
+       0,    66,    67,    67,    67,    67,    67,    68,    68,    68,
+      68,    68,    69,    70,    71,    71,    71,    71,    72,    72,
+      73,    73,    73,    73,    73,    73,    74,    74,    74,    74,
+      74,    75,    75,    76,    76,    77,    78,    78,    78,    78,
+      78,    78,    79,    79,    80,    80,    80,    80,    80,    81,
+      82,    82,    83,    83,    84,    84,    85,    85,    86,    86,
+      86,    86,    86,    86,    87,    87,    88,    88,    89,    90,
+      90,    91,    91,    92,    92,    92,    92,    92,    93,    94,
+      95,    96,    97,    97,    97,    98,    98,    98,    99,    99,
+     100,   101,   101,   101,   102,   103,   104
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
        0,     2,     2,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     4,     3,     1,     1,     1,     1,     2,     4,
-       6,     3,     2,     6,     6,     7,     4,     5,     6,     5,
-       1,     3,     1,     3,     2,     1,     4,     1,     1,     1,
-       1,     3,     1,     1,     1,     1,     1,     3,     0,     2,
-       1,     3,     3,     1,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     3,     3,     1,     2,     1,
-       1,     6,     6,     6,     6,     6,     1,     1,     1,     1,
-       1,     3,     3,     3,     5,     0,     1,     3,     2,     1,
-       1,     0,     1,     1,     1
+       6,     9,     3,     2,     6,     6,     7,     4,     5,     6,
+       5,     1,     3,     1,     3,     2,     1,     4,     4,     1,
+       1,     1,     1,     3,     1,     1,     1,     1,     1,     3,
+       0,     2,     1,     3,     3,     1,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     3,     3,     1,
+       2,     1,     1,     6,     6,     6,     6,     6,     1,     1,
+       1,     1,     1,     3,     3,     3,     5,     0,     1,     3,
+       2,     1,     1,     0,     1,     1,     1
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -893,10 +877,9 @@ static const yytype_int8 yyr2[] =
       }                                                           \
   while (0)
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -940,12 +923,19 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
@@ -973,24 +963,32 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location); \
+                  Kind, Value, Location); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -1001,19 +999,16 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
-  YYUSE (yylocationp);
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
@@ -1023,14 +1018,15 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YY
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyo, *yylocationp);
+  YYLOCATION_PRINT (yyo, yylocationp);
   YYFPRINTF (yyo, ": ");
-  yy_symbol_value_print (yyo, yytype, yyvaluep, yylocationp);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
   YYFPRINTF (yyo, ")");
 }
 
@@ -1063,7 +1059,8 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -1075,9 +1072,9 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[+yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1092,8 +1089,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1116,12 +1113,61 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+  YYLTYPE *yylloc;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
-#  else
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
 static YYPTRDIFF_T
 yystrlen (const char *yystr)
@@ -1131,13 +1177,13 @@ yystrlen (const char *yystr)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
 static char *
@@ -1151,10 +1197,10 @@ yystpcpy (char *yydest, const char *yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -1169,7 +1215,6 @@ yytnamerr (char *yyres, const char *yystr)
     {
       YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
         switch (*++yyp)
           {
@@ -1203,31 +1248,15 @@ yytnamerr (char *yyres, const char *yystr)
   else
     return yystrlen (yystr);
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                yy_state_t *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat: reported tokens (one for the "unexpected",
-     one per "expected"). */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
   /* Actual size of YYARG. */
   int yycount = 0;
-  /* Cumulated lengths of YYARG.  */
-  YYPTRDIFF_T yysize = 0;
-
   /* There are many possibilities here to consider:
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
@@ -1251,52 +1280,54 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[+*yyssp];
-      YYPTRDIFF_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-      yysize = yysize0;
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYPTRDIFF_T yysize1
-                    = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
     default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
@@ -1304,17 +1335,23 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
   {
-    /* Don't count the "%s"s in the final size, but reserve room for
-       the terminator.  */
-    YYPTRDIFF_T yysize1 = yysize + (yystrlen (yyformat) - 2 * yycount) + 1;
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
-    else
-      return 2;
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
   }
 
   if (*yymsg_alloc < yysize)
@@ -1323,7 +1360,7 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -1335,7 +1372,7 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
@@ -1346,29 +1383,32 @@ yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -1376,7 +1416,7 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocatio
 int
 yyparse (void)
 {
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 
@@ -1395,55 +1435,50 @@ static YYLTYPE yyloc_default
 YYLTYPE yylloc = yyloc_default;
 
     /* Number of syntax errors so far.  */
-    int yynerrs;
+    int yynerrs = 0;
 
-    yy_state_fast_t yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
     yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-    /* The location stack.  */
+    /* The location stack: array, bottom, top.  */
     YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
-
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
-
-    YYPTRDIFF_T yystacksize;
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
   YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
-#endif
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -1451,17 +1486,10 @@ YYLTYPE yylloc = yyloc_default;
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   yylsp[0] = yylloc;
   goto yysetstate;
 
@@ -1484,10 +1512,11 @@ yysetstate:
   YY_IGNORE_USELESS_CAST_BEGIN
   *yyssp = YY_CAST (yy_state_t, yystate);
   YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
@@ -1518,7 +1547,7 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
@@ -1529,11 +1558,11 @@ yysetstate:
           YY_CAST (union yyalloc *,
                    YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
-# undef YYSTACK_RELOCATE
+#  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
       }
@@ -1553,6 +1582,7 @@ yysetstate:
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
+
   if (yystate == YYFINAL)
     YYACCEPT;
 
@@ -1573,18 +1603,30 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex (&yylval, &yylloc);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1656,675 +1698,697 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 2:
-#line 65 "yacc.y"
+  case 2: /* start: stmt ';'  */
+#line 66 "/root/repo/src/parser/yacc.y"
     {
         parse_tree = (yyvsp[-1].sv_node);
         YYACCEPT;
     }
-#line 1666 "yacc.tab.cpp"
+#line 1708 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 3:
-#line 70 "yacc.y"
+  case 3: /* start: offStmt  */
+#line 71 "/root/repo/src/parser/yacc.y"
     {
        parse_tree = (yyvsp[0].sv_node);
        YYACCEPT;
     }
-#line 1675 "yacc.tab.cpp"
+#line 1717 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 4:
-#line 75 "yacc.y"
+  case 4: /* start: HELP  */
+#line 76 "/root/repo/src/parser/yacc.y"
     {
         parse_tree = std::make_shared<Help>();
         YYACCEPT;
     }
-#line 1684 "yacc.tab.cpp"
+#line 1726 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 5:
-#line 80 "yacc.y"
+  case 5: /* start: EXIT  */
+#line 81 "/root/repo/src/parser/yacc.y"
     {
         parse_tree = nullptr;
         YYACCEPT;
     }
-#line 1693 "yacc.tab.cpp"
+#line 1735 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 6:
-#line 85 "yacc.y"
+  case 6: /* start: T_EOF  */
+#line 86 "/root/repo/src/parser/yacc.y"
     {
         parse_tree = nullptr;
         YYACCEPT;
     }
-#line 1702 "yacc.tab.cpp"
+#line 1744 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 12:
-#line 101 "yacc.y"
+  case 12: /* loadStmt: LOAD fileName INTO tbName  */
+#line 102 "/root/repo/src/parser/yacc.y"
      {
         (yyval.sv_node) = std::make_shared<LoadStmt>( (yyvsp[-2].sv_str), (yyvsp[0].sv_str));
      }
-#line 1710 "yacc.tab.cpp"
+#line 1752 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 13:
-#line 108 "yacc.y"
+  case 13: /* offStmt: SET OUTPUT_FILE OFF  */
+#line 109 "/root/repo/src/parser/yacc.y"
      {
         (yyval.sv_node) = std::make_shared<SetOff>();
      }
-#line 1718 "yacc.tab.cpp"
+#line 1760 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 14:
-#line 115 "yacc.y"
+  case 14: /* txnStmt: TXN_BEGIN  */
+#line 116 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<TxnBegin>();
     }
-#line 1726 "yacc.tab.cpp"
+#line 1768 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 15:
-#line 119 "yacc.y"
+  case 15: /* txnStmt: TXN_COMMIT  */
+#line 120 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<TxnCommit>();
     }
-#line 1734 "yacc.tab.cpp"
+#line 1776 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 16:
-#line 123 "yacc.y"
+  case 16: /* txnStmt: TXN_ABORT  */
+#line 124 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<TxnAbort>();
     }
-#line 1742 "yacc.tab.cpp"
+#line 1784 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 17:
-#line 127 "yacc.y"
+  case 17: /* txnStmt: TXN_ROLLBACK  */
+#line 128 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<TxnRollback>();
     }
-#line 1750 "yacc.tab.cpp"
+#line 1792 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 18:
-#line 134 "yacc.y"
+  case 18: /* dbStmt: SHOW TABLES  */
+#line 135 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<ShowTables>();
     }
-#line 1758 "yacc.tab.cpp"
+#line 1800 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 19:
-#line 138 "yacc.y"
+  case 19: /* dbStmt: SHOW INDEX FROM tbName  */
+#line 139 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<ShowIndex>((yyvsp[0].sv_str));
     }
-#line 1766 "yacc.tab.cpp"
+#line 1808 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 20:
-#line 145 "yacc.y"
+  case 20: /* ddl: CREATE TABLE tbName '(' fieldList ')'  */
+#line 146 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<CreateTable>((yyvsp[-3].sv_str), (yyvsp[-1].sv_fields));
     }
-#line 1774 "yacc.tab.cpp"
+#line 1816 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 21:
-#line 149 "yacc.y"
+  case 21: /* ddl: CREATE TABLE tbName '(' fieldList ')' IDENTIFIER '=' IDENTIFIER  */
+#line 150 "/root/repo/src/parser/yacc.y"
+    {
+        // 表选项只支持storage = row | pax
+        bool is_pax = strcasecmp((yyvsp[0].sv_str).c_str(), "pax") == 0;
+        if (strcasecmp((yyvsp[-2].sv_str).c_str(), "storage") != 0 || (!is_pax && strcasecmp((yyvsp[0].sv_str).c_str(), "row") != 0)) {
+            yyerror(&(yylsp[-2]), "unknown table option");
+            YYERROR;
+        }
+        (yyval.sv_node) = std::make_shared<CreateTable>((yyvsp[-6].sv_str), (yyvsp[-4].sv_fields), is_pax ? STORAGE_PAX : STORAGE_ROW);
+    }
+#line 1830 "/root/repo/src/parser/yacc.tab.cpp"
+    break;
+
+  case 22: /* ddl: DROP TABLE tbName  */
+#line 160 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<DropTable>((yyvsp[0].sv_str));
     }
-#line 1782 "yacc.tab.cpp"
+#line 1838 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 22:
-#line 153 "yacc.y"
+  case 23: /* ddl: DESC tbName  */
+#line 164 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<DescTable>((yyvsp[0].sv_str));
     }
-#line 1790 "yacc.tab.cpp"
+#line 1846 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 23:
-#line 157 "yacc.y"
+  case 24: /* ddl: CREATE INDEX tbName '(' colNameList ')'  */
+#line 168 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<CreateIndex>((yyvsp[-3].sv_str), (yyvsp[-1].sv_strs));
     }
-#line 1798 "yacc.tab.cpp"
+#line 1854 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 24:
-#line 161 "yacc.y"
+  case 25: /* ddl: DROP INDEX tbName '(' colNameList ')'  */
+#line 172 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<DropIndex>((yyvsp[-3].sv_str), (yyvsp[-1].sv_strs));
     }
-#line 1806 "yacc.tab.cpp"
+#line 1862 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 25:
-#line 168 "yacc.y"
+  case 26: /* dml: INSERT INTO tbName VALUES '(' valueList ')'  */
+#line 179 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<InsertStmt>((yyvsp[-4].sv_str), (yyvsp[-1].sv_vals));
     }
-#line 1814 "yacc.tab.cpp"
+#line 1870 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 26:
-#line 172 "yacc.y"
+  case 27: /* dml: DELETE FROM tbName optWhereClause  */
+#line 183 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<DeleteStmt>((yyvsp[-1].sv_str), (yyvsp[0].sv_conds));
     }
-#line 1822 "yacc.tab.cpp"
+#line 1878 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 27:
-#line 176 "yacc.y"
+  case 28: /* dml: UPDATE tbName SET setClauses optWhereClause  */
+#line 187 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<UpdateStmt>((yyvsp[-3].sv_str), (yyvsp[-1].sv_set_clauses), (yyvsp[0].sv_conds));
     }
-#line 1830 "yacc.tab.cpp"
+#line 1886 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 28:
-#line 180 "yacc.y"
+  case 29: /* dml: SELECT selector FROM tableList optWhereClause opt_order_clause  */
+#line 191 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<SelectStmt>((yyvsp[-4].sv_cols), (yyvsp[-2].sv_strs), (yyvsp[-1].sv_conds), (yyvsp[0].sv_opt_orders));
     }
-#line 1838 "yacc.tab.cpp"
+#line 1894 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 29:
-#line 184 "yacc.y"
+  case 30: /* dml: SELECT aggregator FROM tbName optWhereClause  */
+#line 195 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_node) = std::make_shared<AggregateStmt>((yyvsp[-3].sv_aggregate), (yyvsp[-1].sv_str), (yyvsp[0].sv_conds));
     }
-#line 1846 "yacc.tab.cpp"
+#line 1902 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 30:
-#line 191 "yacc.y"
+  case 31: /* fieldList: field  */
+#line 202 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_fields) = std::vector<std::shared_ptr<Field>>{(yyvsp[0].sv_field)};
     }
-#line 1854 "yacc.tab.cpp"
+#line 1910 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 31:
-#line 195 "yacc.y"
+  case 32: /* fieldList: fieldList ',' field  */
+#line 206 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_fields).push_back((yyvsp[0].sv_field));
     }
-#line 1862 "yacc.tab.cpp"
+#line 1918 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 32:
-#line 202 "yacc.y"
+  case 33: /* colNameList: colName  */
+#line 213 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_strs) = std::vector<std::string>{(yyvsp[0].sv_str)};
     }
-#line 1870 "yacc.tab.cpp"
+#line 1926 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 33:
-#line 206 "yacc.y"
+  case 34: /* colNameList: colNameList ',' colName  */
+#line 217 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_strs).push_back((yyvsp[0].sv_str));
     }
-#line 1878 "yacc.tab.cpp"
+#line 1934 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 34:
-#line 213 "yacc.y"
+  case 35: /* field: colName type  */
+#line 224 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_field) = std::make_shared<ColDef>((yyvsp[-1].sv_str), (yyvsp[0].sv_type_len));
     }
-#line 1886 "yacc.tab.cpp"
+#line 1942 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 35:
-#line 220 "yacc.y"
+  case 36: /* type: INT  */
+#line 231 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_INT, sizeof(int));
     }
-#line 1894 "yacc.tab.cpp"
+#line 1950 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 36:
-#line 224 "yacc.y"
+  case 37: /* type: CHAR '(' VALUE_INT ')'  */
+#line 235 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_STRING, (yyvsp[-1].sv_int));
     }
-#line 1902 "yacc.tab.cpp"
+#line 1958 "/root/repo/src/parser/yacc.tab.cpp"
+    break;
+
+  case 38: /* type: VARCHAR '(' VALUE_INT ')'  */
+#line 239 "/root/repo/src/parser/yacc.y"
+    {
+        (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_VARCHAR, (yyvsp[-1].sv_int));
+    }
+#line 1966 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 37:
-#line 228 "yacc.y"
+  case 39: /* type: FLOAT  */
+#line 243 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_FLOAT, sizeof(float));
     }
-#line 1910 "yacc.tab.cpp"
+#line 1974 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 38:
-#line 232 "yacc.y"
+  case 40: /* type: BIGINT  */
+#line 247 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_BIGINT, sizeof(int64_t));
     }
-#line 1918 "yacc.tab.cpp"
+#line 1982 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 39:
-#line 236 "yacc.y"
+  case 41: /* type: DATETIME  */
+#line 251 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_type_len) = std::make_shared<TypeLen>(SV_TYPE_DATETIME, sizeof(int64_t));
     }
-#line 1926 "yacc.tab.cpp"
+#line 1990 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 40:
-#line 243 "yacc.y"
+  case 42: /* valueList: value  */
+#line 258 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_vals) = std::vector<std::shared_ptr<Value>>{(yyvsp[0].sv_val)};
     }
-#line 1934 "yacc.tab.cpp"
+#line 1998 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 41:
-#line 247 "yacc.y"
+  case 43: /* valueList: valueList ',' value  */
+#line 262 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_vals).push_back((yyvsp[0].sv_val));
     }
-#line 1942 "yacc.tab.cpp"
+#line 2006 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 42:
-#line 254 "yacc.y"
+  case 44: /* value: VALUE_INT  */
+#line 269 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_val) = std::make_shared<IntLit>((yyvsp[0].sv_int));
     }
-#line 1950 "yacc.tab.cpp"
+#line 2014 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 43:
-#line 258 "yacc.y"
+  case 45: /* value: VALUE_FLOAT  */
+#line 273 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_val) = std::make_shared<FloatLit>((yyvsp[0].sv_float));
     }
-#line 1958 "yacc.tab.cpp"
+#line 2022 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 44:
-#line 262 "yacc.y"
+  case 46: /* value: VALUE_STRING  */
+#line 277 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_val) = std::make_shared<StringLit>((yyvsp[0].sv_str));
     }
-#line 1966 "yacc.tab.cpp"
+#line 2030 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 45:
-#line 266 "yacc.y"
+  case 47: /* value: VALUE_BIGINT  */
+#line 281 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_val) = std::make_shared<BigintLit>((yyvsp[0].sv_str));
     }
-#line 1974 "yacc.tab.cpp"
+#line 2038 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 46:
-#line 270 "yacc.y"
+  case 48: /* value: VALUE_DATETIME  */
+#line 285 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_val) = std::make_shared<DateTimeLit>((yyvsp[0].sv_str));
     }
-#line 1982 "yacc.tab.cpp"
+#line 2046 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 47:
-#line 277 "yacc.y"
+  case 49: /* condition: col op expr  */
+#line 292 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_cond) = std::make_shared<BinaryExpr>((yyvsp[-2].sv_col), (yyvsp[-1].sv_comp_op), (yyvsp[0].sv_expr));
     }
-#line 1990 "yacc.tab.cpp"
+#line 2054 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 48:
-#line 283 "yacc.y"
+  case 50: /* optWhereClause: %empty  */
+#line 298 "/root/repo/src/parser/yacc.y"
                       { /* ignore*/ }
-#line 1996 "yacc.tab.cpp"
+#line 2060 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 49:
-#line 285 "yacc.y"
+  case 51: /* optWhereClause: WHERE whereClause  */
+#line 300 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_conds) = (yyvsp[0].sv_conds);
     }
-#line 2004 "yacc.tab.cpp"
+#line 2068 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 50:
-#line 292 "yacc.y"
+  case 52: /* whereClause: condition  */
+#line 307 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_conds) = std::vector<std::shared_ptr<BinaryExpr>>{(yyvsp[0].sv_cond)};
     }
-#line 2012 "yacc.tab.cpp"
+#line 2076 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 51:
-#line 296 "yacc.y"
+  case 53: /* whereClause: whereClause AND condition  */
+#line 311 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_conds).push_back((yyvsp[0].sv_cond));
     }
-#line 2020 "yacc.tab.cpp"
+#line 2084 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 52:
-#line 303 "yacc.y"
+  case 54: /* col: tbName '.' colName  */
+#line 318 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_col) = std::make_shared<Col>((yyvsp[-2].sv_str), (yyvsp[0].sv_str));
     }
-#line 2028 "yacc.tab.cpp"
+#line 2092 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 53:
-#line 307 "yacc.y"
+  case 55: /* col: colName  */
+#line 322 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_col) = std::make_shared<Col>("", (yyvsp[0].sv_str));
     }
-#line 2036 "yacc.tab.cpp"
+#line 2100 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 54:
-#line 314 "yacc.y"
+  case 56: /* colList: col  */
+#line 329 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_cols) = std::vector<std::shared_ptr<Col>>{(yyvsp[0].sv_col)};
     }
-#line 2044 "yacc.tab.cpp"
+#line 2108 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 55:
-#line 318 "yacc.y"
+  case 57: /* colList: colList ',' col  */
+#line 333 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_cols).push_back((yyvsp[0].sv_col));
     }
-#line 2052 "yacc.tab.cpp"
+#line 2116 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 56:
-#line 325 "yacc.y"
+  case 58: /* op: '='  */
+#line 340 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_EQ;
     }
-#line 2060 "yacc.tab.cpp"
+#line 2124 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 57:
-#line 329 "yacc.y"
+  case 59: /* op: '<'  */
+#line 344 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_LT;
     }
-#line 2068 "yacc.tab.cpp"
+#line 2132 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 58:
-#line 333 "yacc.y"
+  case 60: /* op: '>'  */
+#line 348 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_GT;
     }
-#line 2076 "yacc.tab.cpp"
+#line 2140 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 59:
-#line 337 "yacc.y"
+  case 61: /* op: NEQ  */
+#line 352 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_NE;
     }
-#line 2084 "yacc.tab.cpp"
+#line 2148 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 60:
-#line 341 "yacc.y"
+  case 62: /* op: LEQ  */
+#line 356 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_LE;
     }
-#line 2092 "yacc.tab.cpp"
+#line 2156 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 61:
-#line 345 "yacc.y"
+  case 63: /* op: GEQ  */
+#line 360 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_comp_op) = SV_OP_GE;
     }
-#line 2100 "yacc.tab.cpp"
+#line 2164 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 62:
-#line 352 "yacc.y"
+  case 64: /* expr: value  */
+#line 367 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_expr) = std::static_pointer_cast<Expr>((yyvsp[0].sv_val));
     }
-#line 2108 "yacc.tab.cpp"
+#line 2172 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 63:
-#line 356 "yacc.y"
+  case 65: /* expr: col  */
+#line 371 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_expr) = std::static_pointer_cast<Expr>((yyvsp[0].sv_col));
     }
-#line 2116 "yacc.tab.cpp"
+#line 2180 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 64:
-#line 363 "yacc.y"
+  case 66: /* setClauses: setClause  */
+#line 378 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_set_clauses) = std::vector<std::shared_ptr<SetClause>>{(yyvsp[0].sv_set_clause)};
     }
-#line 2124 "yacc.tab.cpp"
+#line 2188 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 65:
-#line 367 "yacc.y"
+  case 67: /* setClauses: setClauses ',' setClause  */
+#line 382 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_set_clauses).push_back((yyvsp[0].sv_set_clause));
     }
-#line 2132 "yacc.tab.cpp"
+#line 2196 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 66:
-#line 374 "yacc.y"
+  case 68: /* setClause: colName '=' setExpr  */
+#line 389 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_set_clause) = std::make_shared<SetClause>((yyvsp[-2].sv_str), (yyvsp[0].sv_set_expr));
     }
-#line 2140 "yacc.tab.cpp"
+#line 2204 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 67:
-#line 381 "yacc.y"
+  case 69: /* setExpr: value  */
+#line 396 "/root/repo/src/parser/yacc.y"
      {
         (yyval.sv_set_expr) = std::make_shared<SetExpr>(false, (yyvsp[0].sv_val));
      }
-#line 2148 "yacc.tab.cpp"
+#line 2212 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 68:
-#line 385 "yacc.y"
+  case 70: /* setExpr: colName value  */
+#line 400 "/root/repo/src/parser/yacc.y"
      {
         (yyval.sv_set_expr) = std::make_shared<SetExpr>(true,(yyvsp[0].sv_val));
      }
-#line 2156 "yacc.tab.cpp"
+#line 2220 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 69:
-#line 393 "yacc.y"
+  case 71: /* selector: '*'  */
+#line 408 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_cols) = {};
     }
-#line 2164 "yacc.tab.cpp"
+#line 2228 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 71:
-#line 401 "yacc.y"
+  case 73: /* aggregator: aggre_sum '(' colName ')' AS colName  */
+#line 416 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate) = std::make_shared<AggregateCol>((yyvsp[-5].sv_aggregate_type), (yyvsp[-3].sv_str), (yyvsp[0].sv_str));
     }
-#line 2172 "yacc.tab.cpp"
+#line 2236 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 72:
-#line 405 "yacc.y"
+  case 74: /* aggregator: aggre_max '(' colName ')' AS colName  */
+#line 420 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate) = std::make_shared<AggregateCol>((yyvsp[-5].sv_aggregate_type), (yyvsp[-3].sv_str), (yyvsp[0].sv_str));
     }
-#line 2180 "yacc.tab.cpp"
+#line 2244 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 73:
-#line 409 "yacc.y"
+  case 75: /* aggregator: aggre_min '(' colName ')' AS colName  */
+#line 424 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate) = std::make_shared<AggregateCol>((yyvsp[-5].sv_aggregate_type), (yyvsp[-3].sv_str), (yyvsp[0].sv_str));
     }
-#line 2188 "yacc.tab.cpp"
+#line 2252 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 74:
-#line 413 "yacc.y"
+  case 76: /* aggregator: aggre_count '(' '*' ')' AS colName  */
+#line 428 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate) = std::make_shared<AggregateCol>((yyvsp[-5].sv_aggregate_type), "*", (yyvsp[0].sv_str));
     }
-#line 2196 "yacc.tab.cpp"
+#line 2260 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 75:
-#line 417 "yacc.y"
+  case 77: /* aggregator: aggre_count '(' colName ')' AS colName  */
+#line 432 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate) = std::make_shared<AggregateCol>((yyvsp[-5].sv_aggregate_type), (yyvsp[-3].sv_str), (yyvsp[0].sv_str));
     }
-#line 2204 "yacc.tab.cpp"
+#line 2268 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 76:
-#line 424 "yacc.y"
+  case 78: /* aggre_sum: SUM  */
+#line 439 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate_type) = SV_SUM;
     }
-#line 2212 "yacc.tab.cpp"
+#line 2276 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 77:
-#line 431 "yacc.y"
+  case 79: /* aggre_max: MAX  */
+#line 446 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate_type) = SV_MAX;
     }
-#line 2220 "yacc.tab.cpp"
+#line 2284 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 78:
-#line 438 "yacc.y"
+  case 80: /* aggre_min: MIN  */
+#line 453 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate_type) = SV_MIN;
     }
-#line 2228 "yacc.tab.cpp"
+#line 2292 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 79:
-#line 445 "yacc.y"
+  case 81: /* aggre_count: COUNT  */
+#line 460 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_aggregate_type) = SV_COUNT;
     }
-#line 2236 "yacc.tab.cpp"
+#line 2300 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 80:
-#line 452 "yacc.y"
+  case 82: /* tableList: tbName  */
+#line 467 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_strs) = std::vector<std::string>{(yyvsp[0].sv_str)};
     }
-#line 2244 "yacc.tab.cpp"
+#line 2308 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 81:
-#line 456 "yacc.y"
+  case 83: /* tableList: tableList ',' tbName  */
+#line 471 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_strs).push_back((yyvsp[0].sv_str));
     }
-#line 2252 "yacc.tab.cpp"
+#line 2316 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 82:
-#line 460 "yacc.y"
+  case 84: /* tableList: tableList JOIN tbName  */
+#line 475 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_strs).push_back((yyvsp[0].sv_str));
     }
-#line 2260 "yacc.tab.cpp"
+#line 2324 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 83:
-#line 467 "yacc.y"
+  case 85: /* opt_order_clause: ORDER BY order_clauses  */
+#line 482 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_opt_orders) = std::pair<std::vector<std::shared_ptr<OrderBy>>, int>{(yyvsp[0].sv_orderbys), -1};
     }
-#line 2268 "yacc.tab.cpp"
+#line 2332 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 84:
-#line 471 "yacc.y"
+  case 86: /* opt_order_clause: ORDER BY order_clauses LIMIT VALUE_INT  */
+#line 486 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_opt_orders) = std::pair<std::vector<std::shared_ptr<OrderBy>>, int>{(yyvsp[-2].sv_orderbys), (yyvsp[0].sv_int)};
     }
-#line 2276 "yacc.tab.cpp"
+#line 2340 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 85:
-#line 474 "yacc.y"
+  case 87: /* opt_order_clause: %empty  */
+#line 489 "/root/repo/src/parser/yacc.y"
                       { /* ignore*/ }
-#line 2282 "yacc.tab.cpp"
+#line 2346 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 86:
-#line 479 "yacc.y"
+  case 88: /* order_clauses: order_clause  */
+#line 494 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_orderbys) = std::vector<std::shared_ptr<OrderBy>>{ (yyvsp[0].sv_orderby) };
     }
-#line 2290 "yacc.tab.cpp"
+#line 2354 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 87:
-#line 483 "yacc.y"
+  case 89: /* order_clauses: order_clauses ',' order_clause  */
+#line 498 "/root/repo/src/parser/yacc.y"
     {
         (yyval.sv_orderbys).push_back((yyvsp[0].sv_orderby));
     }
-#line 2298 "yacc.tab.cpp"
+#line 2362 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 88:
-#line 490 "yacc.y"
+  case 90: /* order_clause: col opt_asc_desc  */
+#line 505 "/root/repo/src/parser/yacc.y"
     { 
         (yyval.sv_orderby) = std::make_shared<OrderBy>((yyvsp[-1].sv_col), (yyvsp[0].sv_orderby_dir));
     }
-#line 2306 "yacc.tab.cpp"
+#line 2370 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 89:
-#line 496 "yacc.y"
+  case 91: /* opt_asc_desc: ASC  */
+#line 511 "/root/repo/src/parser/yacc.y"
                  { (yyval.sv_orderby_dir) = OrderBy_ASC;     }
-#line 2312 "yacc.tab.cpp"
+#line 2376 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 90:
-#line 497 "yacc.y"
+  case 92: /* opt_asc_desc: DESC  */
+#line 512 "/root/repo/src/parser/yacc.y"
                  { (yyval.sv_orderby_dir) = OrderBy_DESC;    }
-#line 2318 "yacc.tab.cpp"
+#line 2382 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
-  case 91:
-#line 498 "yacc.y"
+  case 93: /* opt_asc_desc: %empty  */
+#line 513 "/root/repo/src/parser/yacc.y"
             { (yyval.sv_orderby_dir) = OrderBy_DEFAULT; }
-#line 2324 "yacc.tab.cpp"
+#line 2388 "/root/repo/src/parser/yacc.tab.cpp"
     break;
 
 
-#line 2328 "yacc.tab.cpp"
+#line 2392 "/root/repo/src/parser/yacc.tab.cpp"
 
       default: break;
     }
@@ -2339,11 +2403,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -2368,50 +2431,45 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (&yylloc, YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyssp, yytoken, &yylloc};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = YY_CAST (char *, YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (&yylloc, yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2444,6 +2502,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -2460,13 +2519,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -2480,7 +2540,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2491,13 +2551,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2508,7 +2566,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -2516,24 +2574,22 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (&yylloc, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -2549,18 +2605,17 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[+*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
   return yyresult;
 }
-#line 506 "yacc.y"
+
+#line 521 "/root/repo/src/parser/yacc.y"
 
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -31,11 +31,12 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
-#ifndef YY_YY_YACC_TAB_H_INCLUDED
-# define YY_YY_YACC_TAB_H_INCLUDED
+#ifndef YY_YY_ROOT_REPO_SRC_PARSER_YACC_TAB_H_INCLUDED
+# define YY_YY_ROOT_REPO_SRC_PARSER_YACC_TAB_H_INCLUDED
 /* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
@@ -44,120 +45,72 @@
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    SHOW = 258,
-    TABLES = 259,
-    CREATE = 260,
-    TABLE = 261,
-    DROP = 262,
-    DESC = 263,
-    INSERT = 264,
-    INTO = 265,
-    VALUES = 266,
-    DELETE = 267,
-    FROM = 268,
-    ASC = 269,
-    ORDER = 270,
-    BY = 271,
-    WHERE = 272,
-    UPDATE = 273,
-    SET = 274,
-    SELECT = 275,
-    INT = 276,
-    CHAR = 277,
-    FLOAT = 278,
-    BIGINT = 279,
-    DATETIME = 280,
-    INDEX = 281,
-    AND = 282,
-    JOIN = 283,
-    EXIT = 284,
-    HELP = 285,
-    TXN_BEGIN = 286,
-    TXN_COMMIT = 287,
-    TXN_ABORT = 288,
-    TXN_ROLLBACK = 289,
-    ORDER_BY = 290,
-    COUNT = 291,
-    MAX = 292,
-    MIN = 293,
-    SUM = 294,
-    AS = 295,
-    LIMIT = 296,
-    OFF = 297,
-    LOAD = 298,
-    OUTPUT_FILE = 299,
-    LEQ = 300,
-    NEQ = 301,
-    GEQ = 302,
-    T_EOF = 303,
-    IDENTIFIER = 304,
-    VALUE_STRING = 305,
-    PATH = 306,
-    VALUE_INT = 307,
-    VALUE_FLOAT = 308,
-    VALUE_BIGINT = 309,
-    VALUE_DATETIME = 310
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SHOW = 258,                    /* SHOW  */
+    TABLES = 259,                  /* TABLES  */
+    CREATE = 260,                  /* CREATE  */
+    TABLE = 261,                   /* TABLE  */
+    DROP = 262,                    /* DROP  */
+    DESC = 263,                    /* DESC  */
+    INSERT = 264,                  /* INSERT  */
+    INTO = 265,                    /* INTO  */
+    VALUES = 266,                  /* VALUES  */
+    DELETE = 267,                  /* DELETE  */
+    FROM = 268,                    /* FROM  */
+    ASC = 269,                     /* ASC  */
+    ORDER = 270,                   /* ORDER  */
+    BY = 271,                      /* BY  */
+    WHERE = 272,                   /* WHERE  */
+    UPDATE = 273,                  /* UPDATE  */
+    SET = 274,                     /* SET  */
+    SELECT = 275,                  /* SELECT  */
+    INT = 276,                     /* INT  */
+    CHAR = 277,                    /* CHAR  */
+    VARCHAR = 278,                 /* VARCHAR  */
+    FLOAT = 279,                   /* FLOAT  */
+    BIGINT = 280,                  /* BIGINT  */
+    DATETIME = 281,                /* DATETIME  */
+    INDEX = 282,                   /* INDEX  */
+    AND = 283,                     /* AND  */
+    JOIN = 284,                    /* JOIN  */
+    EXIT = 285,                    /* EXIT  */
+    HELP = 286,                    /* HELP  */
+    TXN_BEGIN = 287,               /* TXN_BEGIN  */
+    TXN_COMMIT = 288,              /* TXN_COMMIT  */
+    TXN_ABORT = 289,               /* TXN_ABORT  */
+    TXN_ROLLBACK = 290,            /* TXN_ROLLBACK  */
+    ORDER_BY = 291,                /* ORDER_BY  */
+    COUNT = 292,                   /* COUNT  */
+    MAX = 293,                     /* MAX  */
+    MIN = 294,                     /* MIN  */
+    SUM = 295,                     /* SUM  */
+    AS = 296,                      /* AS  */
+    LIMIT = 297,                   /* LIMIT  */
+    OFF = 298,                     /* OFF  */
+    LOAD = 299,                    /* LOAD  */
+    OUTPUT_FILE = 300,             /* OUTPUT_FILE  */
+    LEQ = 301,                     /* LEQ  */
+    NEQ = 302,                     /* NEQ  */
+    GEQ = 303,                     /* GEQ  */
+    T_EOF = 304,                   /* T_EOF  */
+    IDENTIFIER = 305,              /* IDENTIFIER  */
+    VALUE_STRING = 306,            /* VALUE_STRING  */
+    PATH = 307,                    /* PATH  */
+    VALUE_INT = 308,               /* VALUE_INT  */
+    VALUE_FLOAT = 309,             /* VALUE_FLOAT  */
+    VALUE_BIGINT = 310,            /* VALUE_BIGINT  */
+    VALUE_DATETIME = 311           /* VALUE_DATETIME  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
-#define SHOW 258
-#define TABLES 259
-#define CREATE 260
-#define TABLE 261
-#define DROP 262
-#define DESC 263
-#define INSERT 264
-#define INTO 265
-#define VALUES 266
-#define DELETE 267
-#define FROM 268
-#define ASC 269
-#define ORDER 270
-#define BY 271
-#define WHERE 272
-#define UPDATE 273
-#define SET 274
-#define SELECT 275
-#define INT 276
-#define CHAR 277
-#define FLOAT 278
-#define BIGINT 279
-#define DATETIME 280
-#define INDEX 281
-#define AND 282
-#define JOIN 283
-#define EXIT 284
-#define HELP 285
-#define TXN_BEGIN 286
-#define TXN_COMMIT 287
-#define TXN_ABORT 288
-#define TXN_ROLLBACK 289
-#define ORDER_BY 290
-#define COUNT 291
-#define MAX 292
-#define MIN 293
-#define SUM 294
-#define AS 295
-#define LIMIT 296
-#define OFF 297
-#define LOAD 298
-#define OUTPUT_FILE 299
-#define LEQ 300
-#define NEQ 301
-#define GEQ 302
-#define T_EOF 303
-#define IDENTIFIER 304
-#define VALUE_STRING 305
-#define PATH 306
-#define VALUE_INT 307
-#define VALUE_FLOAT 308
-#define VALUE_BIGINT 309
-#define VALUE_DATETIME 310
 
 /* Value type.  */
 
@@ -177,6 +130,8 @@ struct YYLTYPE
 
 
 
+
 int yyparse (void);
 
-#endif /* !YY_YY_YACC_TAB_H_INCLUDED  */
+
+#endif /* !YY_YY_ROOT_REPO_SRC_PARSER_YACC_TAB_H_INCLUDED  */
@@ -3,6 +3,7 @@
 #include "yacc.tab.h"
 #include <iostream>
 #include <memory>
+#include <strings.h>
 
 int yylex(YYSTYPE *yylval, YYLTYPE *yylloc);
 
@@ -22,7 +23,7 @@ using namespace ast;
 
 // keywords
 %token SHOW TABLES CREATE TABLE DROP DESC INSERT INTO VALUES DELETE FROM ASC ORDER BY
-WHERE UPDATE SET SELECT INT CHAR FLOAT BIGINT DATETIME INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_COMMIT TXN_ABORT TXN_ROLLBACK ORDER_BY COUNT MAX MIN SUM AS LIMIT
+WHERE UPDATE SET SELECT INT CHAR VARCHAR FLOAT BIGINT DATETIME INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_COMMIT TXN_ABORT TXN_ROLLBACK ORDER_BY COUNT MAX MIN SUM AS LIMIT
 OFF LOAD OUTPUT_FILE
 // non-keywords
 %token LEQ NEQ GEQ T_EOF
@@ -145,6 +146,16 @@ ddl:
     {
         $$ = std::make_shared<CreateTable>($3, $5);
     }
+    |   CREATE TABLE tbName '(' fieldList ')' IDENTIFIER '=' IDENTIFIER
+    {
+        // 表选项只支持storage = row | pax
+        bool is_pax = strcasecmp($9.c_str(), "pax") == 0;
+        if (strcasecmp($7.c_str(), "storage") != 0 || (!is_pax && strcasecmp($9.c_str(), "row") != 0)) {
+            yyerror(&@7, "unknown table option");
+            YYERROR;
+        }
+        $$ = std::make_shared<CreateTable>($3, $5, is_pax ? STORAGE_PAX : STORAGE_ROW);
+    }
     |   DROP TABLE tbName
     {
         $$ = std::make_shared<DropTable>($3);
@@ -224,6 +235,10 @@ type:
     {
         $$ = std::make_shared<TypeLen>(SV_TYPE_STRING, $3);
     }
+    |   VARCHAR '(' VALUE_INT ')'
+    {
+        $$ = std::make_shared<TypeLen>(SV_TYPE_VARCHAR, $3);
+    }
     |   FLOAT
     {
         $$ = std::make_shared<TypeLen>(SV_TYPE_FLOAT, sizeof(float));
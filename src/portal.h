@@ -191,8 +191,12 @@ class Portal
     {
 
         if(auto x = std::dynamic_pointer_cast<ProjectionPlan>(plan)){
-            return std::make_unique<ProjectionExecutor>(convert_plan_executor(x->subplan_, context, dml_mode),
-                                                        x->sel_cols_);
+            auto prev = convert_plan_executor(x->subplan_, context, dml_mode);
+            if(auto scan = dynamic_cast<SeqScanExecutor *>(prev.get())) {
+                // 投影直接在顺序扫描之上时，扫描只需要输出投影的字段
+                scan->SetOutputColumns(x->sel_cols_);
+            }
+            return std::make_unique<ProjectionExecutor>(std::move(prev), x->sel_cols_);
         } else if(auto x = std::dynamic_pointer_cast<ScanPlan>(plan)) {
             if(context->txn_->get_isolation_level()==IsolationLevel::SERIALIZABLE&&!dml_mode) {
                 auto fd = sm_manager_->fhs_.at(x->tab_name_).get()->GetFd();
@@ -31,7 +31,7 @@ class Bitmap {
     static bool is_set(const char *bm, int pos) { return (bm[get_bucket(pos)] & get_bit(pos)) != 0; }
 
     /**
-     * @brief 找下一个为0 or 1的位
+     * @brief 找下一个为0 or 1的位，每次检查一个64位字
      * @param bit false表示要找下一个为0的位，true表示要找下一个为1的位
      * @param bm 要找的起始地址为bm
      * @param max_n 要找的从起始地址开始的偏移为[curr+1,max_n)
@@ -39,17 +39,61 @@ class Bitmap {
      * @return 找到了就返回偏移位置，没找到就返回max_n
      */
     static int next_bit(bool bit, const char *bm, int max_n, int curr) {
-        for (int i = curr + 1; i < max_n; i++) {
-            if (is_set(bm, i) == bit) {
-                return i;
+        int pos = curr + 1;
+        if (pos >= max_n) {
+            return max_n;
+        }
+        int word_no = pos / WORD_BITS;
+        int num_words = (max_n + WORD_BITS - 1) / WORD_BITS;
+        // 屏蔽当前字中pos之前的位
+        uint64_t word = (bit ? load_word(bm, word_no, max_n) : ~load_word(bm, word_no, max_n)) &
+                        (~0ULL >> (pos % WORD_BITS));
+        while (word == 0) {
+            if (++word_no >= num_words) {
+                return max_n;
             }
+            word = bit ? load_word(bm, word_no, max_n) : ~load_word(bm, word_no, max_n);
         }
-        return max_n;
+        int res = word_no * WORD_BITS + __builtin_clzll(word);
+        return res < max_n ? res : max_n;
     }
 
     // 找第一个为0 or 1的位
     static int first_bit(bool bit, const char *bm, int max_n) { return next_bit(bit, bm, max_n, -1); }
 
+    // 统计[0,max_n)中为1的位的个数，例如页面中有效记录的个数
+    static int count(const char *bm, int max_n) {
+        int num_words = (max_n + WORD_BITS - 1) / WORD_BITS;
+        int cnt = 0;
+        for (int i = 0; i < num_words; i++) {
+            cnt += __builtin_popcountll(load_word(bm, i, max_n) & get_valid_mask(i, max_n));
+        }
+        return cnt;
+    }
+
+    /**
+     * @brief 一次遍历得到[0,max_n)中所有为1的位，按从小到大的顺序写入positions
+     * @param positions 至少能容纳count(bm, max_n)个元素
+     * @param exclude 不为nullptr时跳过exclude中为1的位，例如被标记删除的记录
+     * @return 写入positions的位的个数
+     */
+    static int get_set_bits(const char *bm, int max_n, int *positions, const char *exclude = nullptr) {
+        int num_words = (max_n + WORD_BITS - 1) / WORD_BITS;
+        int cnt = 0;
+        for (int i = 0; i < num_words; i++) {
+            uint64_t word = load_word(bm, i, max_n) & get_valid_mask(i, max_n);
+            if (exclude != nullptr) {
+                word &= ~load_word(exclude, i, max_n);
+            }
+            while (word != 0) {
+                int lz = __builtin_clzll(word);
+                positions[cnt++] = i * WORD_BITS + lz;
+                word ^= HIGHEST_WORD_BIT >> lz;
+            }
+        }
+        return cnt;
+    }
+
     // for example:
     // rid_.slot_no = Bitmap::next_bit(true, page_handle.bitmap, file_handle_->file_hdr_.num_records_per_page,
     // rid_.slot_no); int slot_no = Bitmap::first_bit(false, page_handle.bitmap, file_hdr_.num_records_per_page);
@@ -58,4 +102,28 @@ class Bitmap {
     static int get_bucket(int pos) { return pos / BITMAP_WIDTH; }
 
     static char get_bit(int pos) { return BITMAP_HIGHEST_BIT >> static_cast<char>(pos % BITMAP_WIDTH); }
+
+    static constexpr int WORD_BITS = 64;
+    static constexpr uint64_t HIGHEST_WORD_BIT = 1ULL << 63;
+
+    /**
+     * @brief 读出第word_no个64位字。位图中编号小的位在字节的高位，按大端序装入后编号小的位在字的高位，
+     * 因此字中第一个为1的位就是前导0的个数。不读取[0,max_n)所在字节之后的内存，缺少的字节补0
+     */
+    static uint64_t load_word(const char *bm, int word_no, int max_n) {
+        int begin = word_no * (WORD_BITS / BITMAP_WIDTH);
+        int num_bytes = (max_n + BITMAP_WIDTH - 1) / BITMAP_WIDTH - begin;
+        uint64_t word = 0;
+        memcpy(&word, bm + begin, num_bytes < 8 ? num_bytes : 8);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        return word;
+    }
+
+    // 第word_no个字中属于[0,max_n)的位
+    static uint64_t get_valid_mask(int word_no, int max_n) {
+        int num_bits = max_n - word_no * WORD_BITS;
+        return num_bits >= WORD_BITS ? ~0ULL : ~(~0ULL >> num_bits);
+    }
 };
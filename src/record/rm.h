@@ -10,6 +10,7 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include "rm_bulk_loader.h"
 #include "rm_scan.h"
 #include "rm_manager.h"
 #include "rm_defs.h"
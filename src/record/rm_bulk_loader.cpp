@@ -0,0 +1,141 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "rm_bulk_loader.h"
+
+#include <vector>
+
+#include "rm_file_handle.h"
+
+/**
+ * @param {RmFileHandle*} file_handle 导入的表文件
+ * @param {Context*} context 导入所在的事务，bulk load日志挂在事务的日志链上
+ * @param {string} table_name 表名称，写入日志供恢复时找到表文件
+ */
+RmBulkLoader::RmBulkLoader(RmFileHandle *file_handle, Context *context, std::string table_name)
+    : file_handle_(file_handle), context_(context), table_name_(std::move(table_name)), extent_(RM_BULK_EXTENT_PAGES) {}
+
+/**
+ * @description: 把一条记录追加到正在填充的页面，页面满了之后换下一个页面
+ * @param {char*} buf 定长格式的记录
+ * @return {Rid} 记录的位置，在finish之前记录还不可见
+ */
+Rid RmBulkLoader::append(const char *buf) {
+    if (page_ == nullptr || file_handle_->is_page_full(RmPageHandle(&file_handle_->file_hdr_, page_.get()))) {
+        next_page();
+    }
+    RmPageHandle page_handle(&file_handle_->file_hdr_, page_.get());
+    // 新页面中没有删除过记录，slot依次使用
+    int slot_no = page_handle.page_hdr->num_records;
+    Bitmap::set(page_handle.bitmap, slot_no);
+    bool written = file_handle_->write_slot(page_handle, slot_no, buf);
+    assert(written);
+    page_handle.page_hdr->num_records++;
+    int page_no = page_->get_page_id().page_no;
+    file_handle_->zone_map_.update(page_no, buf);
+    return Rid{page_no, slot_no};
+}
+
+/**
+ * @description: 写出最后一个extent，没有填满的最后一个页面加入空闲页面链表。依次持久化页面、
+ * 写入并持久化日志、更新文件头，之后导入的记录才可见
+ */
+void RmBulkLoader::finish() {
+    if (page_ == nullptr) {
+        return;
+    }
+    RmFileHdr &file_hdr = file_handle_->file_hdr_;
+    int prev_first_free_page_no = file_hdr.first_free_page_no;
+    int first_free_page_no = prev_first_free_page_no;
+    RmPageHandle page_handle(&file_hdr, page_.get());
+    if (!file_handle_->is_page_full(page_handle)) {
+        page_handle.page_hdr->next_free_page_no = first_free_page_no;
+        if (page_handle.heap_hdr != nullptr) {
+            page_handle.heap_hdr->in_free_list = 1;
+        }
+        first_free_page_no = page_->get_page_id().page_no;
+    }
+    int num_pages = page_->get_page_id().page_no + 1;
+    flush_extent();
+    auto disk_manager = file_handle_->disk_manager_;
+    disk_manager->sync_file(file_handle_->fd_);
+
+    auto txn = context_->txn_;
+    auto log_mgr = context_->log_mgr_;
+    BulkLoadLogRecord log_record(txn->getTxnId(), table_name_, load_first_page_no_, num_pages - load_first_page_no_,
+                                 txn->get_prev_lsn(), prev_first_free_page_no, first_free_page_no, num_pages);
+    lsn_t lsn = log_mgr->add_log_to_buffer(&log_record);
+    txn->set_prev_lsn(lsn);
+    log_mgr->active_txn_table_[txn->getTxnId()] = lsn;
+    log_mgr->flush_log_to_disk();
+
+    file_hdr.num_pages = num_pages;
+    file_hdr.first_free_page_no = first_free_page_no;
+    disk_manager->write_page(file_handle_->fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr, sizeof(file_hdr));
+    page_.reset();
+    load_first_page_no_ = RM_NO_PAGE;
+}
+
+/**
+ * @description: 放弃导入，文件头没有更新过，只需要把分配的页号还给disk manager，之后分配的页面覆盖已经写出的页面
+ */
+void RmBulkLoader::abort() {
+    if (load_first_page_no_ == RM_NO_PAGE) {
+        return;
+    }
+    file_handle_->disk_manager_->set_fd2pageno(file_handle_->fd_, file_handle_->file_hdr_.num_pages);
+    num_pages_ = 0;
+    page_.reset();
+    load_first_page_no_ = RM_NO_PAGE;
+}
+
+/**
+ * @description: 在extent中开始一个新的页面，extent用完时先写出
+ */
+void RmBulkLoader::next_page() {
+    if (num_pages_ == RM_BULK_EXTENT_PAGES) {
+        flush_extent();
+    }
+    int fd = file_handle_->fd_;
+    int page_no = file_handle_->disk_manager_->allocate_page(fd);
+    if (load_first_page_no_ == RM_NO_PAGE) {
+        load_first_page_no_ = page_no;
+    }
+    if (num_pages_ == 0) {
+        first_page_no_ = page_no;
+    }
+    assert(page_no == first_page_no_ + num_pages_);
+    char *data = extent_.get_frame(num_pages_);
+    memset(data, 0, PAGE_SIZE);
+    num_pages_++;
+    page_ = std::make_unique<Page>(PageId{fd, page_no}, data);
+
+    RmPageHandle page_handle(&file_handle_->file_hdr_, page_.get());
+    page_handle.page_hdr->next_free_page_no = RM_NO_PAGE;
+    if (page_handle.heap_hdr != nullptr) {
+        *page_handle.heap_hdr = RmHeapHdr{0, PAGE_SIZE, 0, 0};
+    }
+    file_handle_->zone_map_.reset_page(page_no);
+}
+
+/**
+ * @description: 把extent中的页面一次写到文件末尾，页面在finish时才持久化
+ */
+void RmBulkLoader::flush_extent() {
+    if (num_pages_ == 0) {
+        return;
+    }
+    std::vector<char *> pages(num_pages_);
+    for (int i = 0; i < num_pages_; i++) {
+        pages[i] = extent_.get_frame(i);
+    }
+    file_handle_->disk_manager_->write_pages(file_handle_->fd_, first_page_no_, pages.data(), num_pages_);
+    num_pages_ = 0;
+}
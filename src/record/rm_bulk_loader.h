@@ -0,0 +1,55 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "common/context.h"
+#include "rm_defs.h"
+#include "storage/frame_arena.h"
+#include "storage/page.h"
+
+class RmFileHandle;
+
+constexpr int RM_BULK_EXTENT_PAGES = 256;   // 批量导入时每次追加到文件末尾的页面个数
+
+/**
+ * @description: 批量导入记录，不经过insert_record。记录依次填满私有缓冲区中的整页，每凑满一个extent
+ * 就绕过buffer pool一次写到文件末尾。finish时持久化所有页面，写一条BulkLoadLogRecord，最后更新文件头，
+ * 在此之前文件头不变，追加的页面不可见；abort放弃追加的页面。崩溃后导入的页面要么全部可见，要么都不在文件中。
+ * 导入的记录不进入事务的写集合，只能在单条语句的隐式事务中导入，崩溃恢复时未提交事务的导入由日志撤销；
+ * 调用者在导入期间持有表上的排他锁
+ */
+class RmBulkLoader {
+   public:
+    RmBulkLoader(RmFileHandle *file_handle, Context *context, std::string table_name);
+
+    Rid append(const char *buf);
+
+    void finish();
+
+    void abort();
+
+   private:
+    void next_page();
+
+    void flush_extent();
+
+    RmFileHandle *file_handle_;
+    Context *context_;
+    std::string table_name_;
+    FrameArena extent_;             // 正在填充的extent，每个帧是一个页面
+    int load_first_page_no_ = RM_NO_PAGE;   // 导入的第一个页面
+    int first_page_no_ = RM_NO_PAGE;    // extent中第一个页面的页号
+    int num_pages_ = 0;             // extent中已经使用的页面个数
+    std::unique_ptr<Page> page_;    // 正在填充的页面，指向extent_中的帧
+};
@@ -18,7 +18,12 @@ See the Mulan PSL v2 for more details. */
 constexpr int RM_NO_PAGE = -1;
 constexpr int RM_FILE_HDR_PAGE = 0;
 constexpr int RM_FIRST_RECORD_PAGE = 1;
-constexpr int RM_MAX_RECORD_SIZE = 512;
+constexpr int RM_MAX_RECORD_SIZE = 512;  // 默认页面大小下记录的最大长度，页面更大时按比例放宽
+
+/* 表数据文件的页面格式 */
+constexpr int RM_FORMAT_FIXED = 0;      // 每个slot的长度都是record_size
+constexpr int RM_FORMAT_SLOTTED = 1;    // 表中有VARCHAR字段，页面中记录变长存储，通过slot目录定位
+constexpr int RM_FORMAT_PAX = 2;        // 建表时指定，页面中每个字段的值集中存放在各自的minipage中
 
 /* 文件头，记录表数据文件的元信息，写入磁盘中文件的第0号页面 */
 struct RmFileHdr {
@@ -27,6 +32,24 @@ struct RmFileHdr {
     int num_records_per_page{};   // 每个页面最多能存储的元组个数
     int first_free_page_no{-1};     // 文件中当前第一个包含空闲空间的页面号（初始化为-1）
     int bitmap_size{};            // 每个页面bitmap大小
+    int format{RM_FORMAT_FIXED};  // 页面格式
+    int num_var_cols{};           // VARCHAR字段的个数，字段的位置(RmVarCol)依次存放在第0号页面中文件头之后
+    int num_minipages{};          // PAX格式中字段的个数，字段的位置(RmMinipage)依次存放在RmVarCol之后
+};
+
+/* VARCHAR字段在记录中的位置。记录在内存中仍然按定长格式存放，只有写入页面时才去掉字段末尾的填充 */
+struct RmVarCol {
+    int offset;
+    int len;
+};
+
+/**
+ * PAX格式中一个字段的minipage。页面中bitmap之后的记录区按字段依次划分，
+ * 字段的minipage起始于记录区首地址 + num_records_per_page * offset，其中第slot_no个值的长度为len
+ */
+struct RmMinipage {
+    int offset;     // 字段在记录中的偏移
+    int len;        // 字段的长度
 };
 
 /* 表数据文件中每个页面的页头，记录每个页面的元信息 */
@@ -35,6 +58,23 @@ struct RmPageHdr {
     int num_records{0};        // 当前页面中当前已经存储的记录个数（初始化为0）
 };
 
+/**
+ * 变长格式页面在RmPageHdr之后的页头。页面依次存放页头、两个bitmap和slot目录，记录从页面末尾向前存放。
+ * 全0的页面是合法的空页面，heap_begin为0时表示还没有存放过记录
+ */
+struct RmHeapHdr {
+    int num_slots;      // slot目录的长度
+    int heap_begin;     // 记录区的起始偏移
+    int used_bytes;     // 所有slot占用的记录区字节数
+    int in_free_list;   // 页面是否在空闲页面链表中
+};
+
+/* 变长格式页面的slot目录项。slot的容量只会变大，回滚更新时旧的记录一定能放回原位 */
+struct RmSlot {
+    uint16_t offset;    // 记录在页面中的偏移
+    uint16_t capacity;  // 为记录分配的字节数，为0表示没有分配
+};
+
 /* 表中的记录 */
 struct RmRecord {
     char* data;  // 记录的数据
@@ -68,7 +108,7 @@ struct RmRecord {
         allocated_ = true;
     }
 
-    RmRecord(int size_, char* data_) {
+    RmRecord(int size_, const char* data_) {
         size = size_;
         data = new char[size_];
         memcpy(data, data_, size_);
@@ -10,6 +10,45 @@ See the Mulan PSL v2 for more details. */
 
 #include "rm_file_handle.h"
 
+/**
+ * @description: 检查第0号页面中的页面格式和字段位置是否有效。format未知、字段个数与格式不符、
+ * 字段位置超出第0号页面或者字段超出记录时都视为无效
+ * @return {bool} 有效返回true
+ * @param {char*} hdr_page 第0号页面的内容，file_hdr_已经从中读出
+ */
+bool RmFileHandle::has_valid_layout(const char *hdr_page) const {
+    int num_cols;
+    if (file_hdr_.format == RM_FORMAT_FIXED) {
+        return file_hdr_.num_var_cols == 0 && file_hdr_.num_minipages == 0;
+    } else if (file_hdr_.format == RM_FORMAT_SLOTTED) {
+        num_cols = file_hdr_.num_var_cols;
+        if (file_hdr_.num_minipages != 0) {
+            return false;
+        }
+    } else if (file_hdr_.format == RM_FORMAT_PAX) {
+        num_cols = file_hdr_.num_minipages;
+        if (file_hdr_.num_var_cols != 0) {
+            return false;
+        }
+    } else {
+        return false;
+    }
+    // RmVarCol和RmMinipage都是(offset, len)
+    static_assert(sizeof(RmVarCol) == sizeof(RmMinipage));
+    int max_cols = (PAGE_SIZE - (int)sizeof(RmFileHdr)) / (int)sizeof(RmVarCol);
+    if (num_cols <= 0 || num_cols > max_cols || file_hdr_.record_size <= 0) {
+        return false;
+    }
+    for (int i = 0; i < num_cols; i++) {
+        RmVarCol col;
+        memcpy(&col, hdr_page + sizeof(RmFileHdr) + i * sizeof(RmVarCol), sizeof(col));
+        if (col.offset < 0 || col.len <= 0 || col.len > file_hdr_.record_size - col.offset) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  * @description: 获取当前表中记录号为rid的记录
  * @param {Rid&} rid 记录号，指定记录的位置
@@ -28,20 +67,112 @@ std::unique_ptr<RmRecord> RmFileHandle::get_record(const Rid& rid, Context* cont
     int size = pageHandle.file_hdr->record_size;
     std::unique_ptr<RmRecord> record = std::make_unique<RmRecord>(size);
     record->size = size;
-    memcpy(record->data, pageHandle.get_slot(rid.slot_no),size);
+    read_slot(pageHandle, rid.slot_no, record->data);
     pageHandle.page->RUnlock();
     buffer_pool_manager_->unpin_page(PageId{fd_,rid.page_no}, false); // check(AntiO2) 这里是否需要unpin
 
     return record;
 }
 
+/**
+ * @description: 获取指定位置记录的只读视图，不复制记录，调用者通过视图直接读取页面中的数据
+ * @return {RecordView} 持有页面pin和读锁的视图，析构时释放
+ * @param {Rid&} rid 记录所在的位置
+ */
+RecordView RmFileHandle::get_record_view(const Rid& rid) const {
+    RmPageHandle pageHandle = fetch_page_handle(rid.page_no);
+    pageHandle.page->RLock();
+    if (pageHandle.heap_hdr != nullptr || file_hdr_.format == RM_FORMAT_PAX) {
+        // 变长格式和PAX格式的记录拼出来之后就不再需要页面
+        std::vector<char> buffer(file_hdr_.record_size);
+        read_slot(pageHandle, rid.slot_no, buffer.data());
+        pageHandle.page->RUnlock();
+        buffer_pool_manager_->unpin_page(PageId{fd_, rid.page_no}, false);
+        return RecordView(std::move(buffer));
+    }
+    return RecordView(buffer_pool_manager_, pageHandle.page, pageHandle.get_slot(rid.slot_no),
+                      pageHandle.file_hdr->record_size);
+}
+
+/**
+ * @description: 一次读出页面中所有有效记录，整页只pin一次，之后通过batch直接读取页面中的数据
+ * @param {int} page_no 要读取的页面号
+ * @param {RecordBatch*} batch 保存结果的批次，原先持有的页面会先被释放
+ * @param {bool} skip_mark_deleted 是否跳过已经被标记删除的记录
+ * @param {BufferAccessStrategy*} strategy 缺页时使用的访问策略
+ * @param {vector<RmMinipage>*} scan_cols PAX格式中按列复制到批次中的字段，为nullptr时复制所有字段
+ * @param {vector<RmMinipage>*} output_cols PAX格式中materialize时补齐的字段，为nullptr时补齐所有字段
+ */
+void RmFileHandle::get_page_batch(int page_no, RecordBatch* batch, bool skip_mark_deleted,
+                                  BufferAccessStrategy* strategy, const std::vector<RmMinipage>* scan_cols,
+                                  const std::vector<RmMinipage>* output_cols) const {
+    batch->release();
+    RmPageHandle pageHandle = fetch_page_handle(page_no, strategy);
+    pageHandle.page->RLock();
+    int max_n = file_hdr_.num_records_per_page;
+    int record_size = file_hdr_.record_size;
+    batch->slots_.resize(max_n);
+    // 范围未知的页面按所有记录重新统计，被标记删除的记录也可能因为回滚而恢复
+    if (zone_map_.is_unknown(page_no)) {
+        int num_slots = Bitmap::get_set_bits(pageHandle.bitmap, max_n, batch->slots_.data());
+        if (pageHandle.heap_hdr != nullptr || file_hdr_.format == RM_FORMAT_PAX) {
+            std::vector<char> records(static_cast<size_t>(num_slots) * record_size);
+            for (int i = 0; i < num_slots; i++) {
+                read_slot(pageHandle, batch->slots_[i], records.data() + static_cast<size_t>(i) * record_size);
+            }
+            zone_map_.rebuild(page_no, records.data(), record_size, nullptr, num_slots);
+        } else {
+            zone_map_.rebuild(page_no, pageHandle.slots, record_size, batch->slots_.data(), num_slots);
+        }
+    }
+    int cnt = Bitmap::get_set_bits(pageHandle.bitmap, max_n, batch->slots_.data(),
+                                   skip_mark_deleted ? pageHandle.mark_delete : nullptr);
+    batch->slots_.resize(cnt);
+    batch->page_no_ = page_no;
+    batch->record_size_ = record_size;
+    if (pageHandle.heap_hdr != nullptr) {
+        // 变长格式的页面把记录依次解码后立即释放页面
+        batch->decoded_.resize(static_cast<size_t>(cnt) * record_size);
+        for (int i = 0; i < cnt; i++) {
+            read_slot(pageHandle, batch->slots_[i], batch->decoded_.data() + static_cast<size_t>(i) * record_size);
+        }
+        pageHandle.page->RUnlock();
+        buffer_pool_manager_->unpin_page(PageId{fd_, page_no}, false);
+        return;
+    }
+    batch->buffer_pool_manager_ = buffer_pool_manager_;
+    batch->page_ = pageHandle.page;
+    if (file_hdr_.format == RM_FORMAT_PAX) {
+        // 逐个字段顺序读取minipage，只访问扫描需要的字段
+        int num_per_page = file_hdr_.num_records_per_page;
+        batch->decoded_.assign(static_cast<size_t>(cnt) * record_size, 0);
+        for (auto &col : scan_cols != nullptr ? *scan_cols : minipages_) {
+            const char* minipage = pageHandle.slots + static_cast<size_t>(num_per_page) * col.offset;
+            char* out = batch->decoded_.data() + col.offset;
+            for (int i = 0; i < cnt; i++) {
+                memcpy(out + static_cast<size_t>(i) * record_size, minipage + static_cast<size_t>(batch->slots_[i]) * col.len,
+                       col.len);
+            }
+        }
+        batch->minipages_ = pageHandle.slots;
+        batch->num_records_per_page_ = num_per_page;
+        // 复制了所有字段时materialize不需要再读页面
+        if (scan_cols != nullptr) {
+            batch->output_cols_ = output_cols != nullptr ? output_cols : &minipages_;
+        }
+        return;
+    }
+    batch->slot_data_ = pageHandle.slots;
+}
+
 /**
  * @description: 在当前表中插入一条记录，不指定插入位置
  * @param {char*} buf 要插入的记录的数据
  * @param {Context*} context
  * @return {Rid} 插入的记录的记录号（位置）
  */
-Rid RmFileHandle::insert_record(char* buf, Context* context, std::string* table_name,  LogOperation log_op, lsn_t undo_next) {
+Rid RmFileHandle::insert_record(char* buf, Context* context, std::string* table_name,  LogOperation log_op, lsn_t undo_next,
+                                BufferAccessStrategy* strategy) {
     // 1. 获取当前未满的page handle
     // 2. 在page handle中找到空闲slot位置
     // 3. 将buf复制到空闲slot位置
@@ -49,8 +180,16 @@ Rid RmFileHandle::insert_record(char* buf, Context* context, std::string* table_
     // 注意考虑插入一条记录后页面已满的情况，需要更新file_hdr_.first_free_page_no
 
     // 1. 获取当前未满的page handle
-    RmPageHandle pageHandle = create_page_handle();
+    RmPageHandle pageHandle = create_page_handle(strategy);
     pageHandle.page->WLock();
+    // 变长格式的页面可能因为记录变长而放不下新的记录，从空闲页面链表中取下，换下一个页面
+    while (is_page_full(pageHandle)) {
+        unlink_free_page(pageHandle);
+        pageHandle.page->WUnlock();
+        buffer_pool_manager_->unpin_page(pageHandle.page->get_page_id(), true);
+        pageHandle = create_page_handle(strategy);
+        pageHandle.page->WLock();
+    }
     // 2. 在page handle中找到空闲slot位置,从位图找
     int slot_no = Bitmap::first_bit(false, pageHandle.bitmap, file_hdr_.num_records_per_page);
     if(slot_no >= file_hdr_.num_records_per_page) {
@@ -58,7 +197,6 @@ Rid RmFileHandle::insert_record(char* buf, Context* context, std::string* table_
         assert(false);
     }
     Bitmap::set(pageHandle.bitmap,slot_no);
-    char* addr_slot = pageHandle.get_slot(slot_no);
 
     RmRecord insert_value(file_hdr_.record_size, buf);
 
@@ -76,25 +214,23 @@ Rid RmFileHandle::insert_record(char* buf, Context* context, std::string* table_
     log_mgr->active_txn_table_[context->txn_->getTxnId()] = log_record->lsn_;
     auto page_id = PageId{fd_,rid.page_no};
 
-    // 3. 将buf复制到空闲slot位置
-    memcpy(addr_slot,buf,pageHandle.file_hdr->record_size);
+    // 3. 将buf复制到空闲slot位置，未满的页面一定能放下一条记录
+    bool written = write_slot(pageHandle, slot_no, buf);
+    assert(written);
+    zone_map_.update(rid.page_no, buf);
 
     // 4. 更新page_handle.page_hdr中的数据结构
     pageHandle.page_hdr->num_records++;
     //考虑插入一条记录后页面已满的情况，需要更新file_hdr_.first_free_page_no
 
-    if(pageHandle.page_hdr->num_records >= pageHandle.file_hdr->num_records_per_page)
+    if(is_page_full(pageHandle))
     {
         //next_free_page_no怎么更新? v不更新了，等create_page_handle()自己调
-        file_hdr_.first_free_page_no = pageHandle.page_hdr->next_free_page_no;
-        pageHandle.page_hdr->next_free_page_no=RM_NO_PAGE;
-        disk_manager_->write_page(fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
+        unlink_free_page(pageHandle);
     }
 
 
-    if(log_mgr->dirty_page_table_.find(PageId{fd_,rid.page_no})==log_mgr->dirty_page_table_.end()) {
-        log_mgr->dirty_page_table_.emplace(page_id, log_record->lsn_);
-    }
+    log_mgr->add_dirty_page(page_id, log_record->lsn_);
 
     pageHandle.page->set_page_lsn(log_record->lsn_);
     //该页面结束使用，取消对该页面的固定,并标记为dirty
@@ -119,15 +255,14 @@ void RmFileHandle::insert_record_recover(const Rid &rid, char *buf, lsn_t lsn, i
     assert(!Bitmap::is_set(pageHandle.bitmap,rid.slot_no));
     Bitmap::set(pageHandle.bitmap,rid.slot_no);
     pageHandle.page_hdr->num_records++;
-    //3. 复制数据
-    char* addr_slot = pageHandle.get_slot(rid.slot_no);
-    memcpy(addr_slot,buf,pageHandle.file_hdr->record_size);
-    if(pageHandle.page_hdr->num_records >= pageHandle.file_hdr->num_records_per_page)
+    //3. 复制数据，重做时页面状态与原来插入时相同，一定能放下
+    bool written = write_slot(pageHandle, rid.slot_no, buf);
+    assert(written);
+    zone_map_.update(rid.page_no, buf);
+    if(is_page_full(pageHandle))
     {
         //next_free_page_no怎么更新? v不更新了，等create_page_handle()自己调
-        file_hdr_.first_free_page_no = pageHandle.page_hdr->next_free_page_no;
-        pageHandle.page_hdr->next_free_page_no=RM_NO_PAGE;
-        disk_manager_->write_page(fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
+        unlink_free_page(pageHandle);
     }
     pageHandle.page->set_page_lsn(lsn);
     pageHandle.page->WUnlock();
@@ -151,8 +286,9 @@ void RmFileHandle::delete_record(const Rid& rid, Context* context, std::string*
     //位图判断及更新
     if(!Bitmap::is_set(pageHandle.bitmap,rid.slot_no))
         throw RecordNotFoundError(rid.page_no,rid.slot_no);
-    char* addr_slot = pageHandle.get_slot(rid.slot_no);
-    RmRecord delete_value(file_hdr_.record_size, addr_slot);
+    RmRecord delete_value(file_hdr_.record_size);
+    read_slot(pageHandle, rid.slot_no, delete_value.data);
+    bool was_full = is_page_full(pageHandle);
 
     auto txn = context->txn_;
     auto log_mgr = context->log_mgr_;
@@ -167,15 +303,14 @@ void RmFileHandle::delete_record(const Rid& rid, Context* context, std::string*
     log_mgr->add_log_to_buffer(log_record);
     txn->set_prev_lsn(log_record->lsn_);
     log_mgr->active_txn_table_[txn->getTxnId()] = log_record->lsn_;
-    if(log_mgr->dirty_page_table_.find(PageId{fd_,rid.page_no})==log_mgr->dirty_page_table_.end()) {
-        log_mgr->dirty_page_table_.emplace(page_id,log_record->lsn_);
-    }
+    log_mgr->add_dirty_page(page_id, log_record->lsn_);
     Bitmap::reset(pageHandle.mark_delete,rid.slot_no);
     Bitmap::reset(pageHandle.bitmap,rid.slot_no);
+    free_slot(pageHandle, rid.slot_no);
     // 2. 更新page_handle.page_hdr中的数据结构
     pageHandle.page_hdr->num_records--;
 
-    if(pageHandle.page_hdr->num_records == file_hdr_.num_records_per_page - 1) {
+    if(was_full && !is_page_full(pageHandle)) {
         // 当从无空位转化成有空位，进行release操作
         release_page_handle(pageHandle);
     }
@@ -198,15 +333,17 @@ void RmFileHandle::delete_record_recover(const Rid& rid,lsn_t lsn, int first_fre
     //位图判断及更新
     if(!Bitmap::is_set(pageHandle.bitmap,rid.slot_no))
         throw RecordNotFoundError(rid.page_no,rid.slot_no);
+    bool was_full = is_page_full(pageHandle);
 
     Bitmap::reset(pageHandle.mark_delete,rid.slot_no);
     Bitmap::reset(pageHandle.bitmap,rid.slot_no);
+    free_slot(pageHandle, rid.slot_no);
 
     // 2. 更新page_handle.page_hdr中的数据结构
     pageHandle.page_hdr->num_records--;
     pageHandle.page->set_page_lsn(lsn);
     pageHandle.page->WUnlock();
-    if(pageHandle.page_hdr->num_records == file_hdr_.num_records_per_page - 1) {
+    if(was_full && !is_page_full(pageHandle)) {
         // 当从无空位转化成有空位，进行release操作
         release_page_handle(pageHandle);
     }
@@ -234,10 +371,16 @@ void RmFileHandle::update_record(const Rid& rid, char* buf, Context* context, st
     }
     // 2. 更新记录
 
-    char* addr_slot = pageHandle.get_slot(rid.slot_no);
     auto size = pageHandle.file_hdr->record_size;
-    RmRecord before_value(size, addr_slot);
+    RmRecord before_value(size);
+    read_slot(pageHandle, rid.slot_no, before_value.data);
     RmRecord after_value(size, buf);
+    // 变长的记录在页面中放不下时由调用者把记录移到其他页面，此时还没有写日志
+    if (pageHandle.heap_hdr != nullptr && !reserve_heap(pageHandle, rid.slot_no, get_encoded_size(buf), true)) {
+        pageHandle.page->WUnlock();
+        buffer_pool_manager_->unpin_page(PageId{fd_, rid.page_no}, false);
+        throw PageFullError(rid.page_no, rid.slot_no);
+    }
 
     auto tid = context->txn_->getTxnId();
     LogRecord* log_record= nullptr;
@@ -252,13 +395,12 @@ void RmFileHandle::update_record(const Rid& rid, char* buf, Context* context, st
     context->txn_->set_prev_lsn(log_record->lsn_);
     log_mgr->active_txn_table_[tid] = log_record->lsn_; // 维护att中的last lsn
     auto page_id = PageId{fd_,rid.page_no};
-    auto table_iter = log_mgr->dirty_page_table_.find(page_id);
-    if(table_iter==log_mgr->dirty_page_table_.end()) {
-        // 维护rec lsn
-        log_mgr->dirty_page_table_.emplace(page_id, log_record->lsn_);
-    }
+    // 维护rec lsn
+    log_mgr->add_dirty_page(page_id, log_record->lsn_);
 
-    memcpy(addr_slot,buf,size);
+    bool written = write_slot(pageHandle, rid.slot_no, buf);
+    assert(written);
+    zone_map_.update(rid.page_no, buf);
     pageHandle.page->set_page_lsn(log_record->lsn_);
     pageHandle.page->WUnlock();
     buffer_pool_manager_->unpin_page(PageId{fd_,rid.page_no}, true);
@@ -285,8 +427,9 @@ void RmFileHandle::update_record_recover(const Rid& rid, char* buf,lsn_t lsn, in
         throw RecordNotFoundError(rid.page_no, rid.slot_no);
     }
     // 2. 更新记录
-    char* addr_slot = pageHandle.get_slot(rid.slot_no);
-    memcpy(addr_slot,buf,pageHandle.file_hdr->record_size);
+    bool written = write_slot(pageHandle, rid.slot_no, buf);
+    assert(written);
+    zone_map_.update(rid.page_no, buf);
     pageHandle.page->set_page_lsn(lsn);
     pageHandle.page->WUnlock();
 
@@ -300,7 +443,7 @@ void RmFileHandle::update_record_recover(const Rid& rid, char* buf,lsn_t lsn, in
  * @param {int} page_no 页面号
  * @return {RmPageHandle} 指定页面的句柄
  */
-RmPageHandle RmFileHandle::fetch_page_handle(int page_no) const {
+RmPageHandle RmFileHandle::fetch_page_handle(int page_no, BufferAccessStrategy* strategy) const {
     // Todo: v
     // 使用缓冲池获取指定页面，并生成page_handle返回给上层
     // if page_no is invalid, throw PageNotExistError exception
@@ -310,7 +453,7 @@ RmPageHandle RmFileHandle::fetch_page_handle(int page_no) const {
         throw PageNotExistError("",page_no);
 
     //使用缓冲池获取指定页面
-    Page* page = buffer_pool_manager_->fetch_page(PageId{fd_,page_no});
+    Page* page = buffer_pool_manager_->fetch_page(PageId{fd_,page_no}, strategy);
     //如果page是null
     if(page == nullptr)
         throw PageNotExistError("",page_no);
@@ -323,7 +466,7 @@ RmPageHandle RmFileHandle::fetch_page_handle(int page_no) const {
  * @description: 创建一个新的page handle
  * @return {RmPageHandle} 新的PageHandle
  */
-RmPageHandle RmFileHandle::create_new_page_handle() {
+RmPageHandle RmFileHandle::create_new_page_handle(BufferAccessStrategy* strategy) {
     // Todo: v
     // 1.使用缓冲池来创建一个新page
     // 2.更新page handle中的相关信息
@@ -332,7 +475,7 @@ RmPageHandle RmFileHandle::create_new_page_handle() {
     // 1.使用缓冲池来创建一个新page
     auto *pageId = new PageId;
     pageId->fd = fd_;
-    Page* page = buffer_pool_manager_->new_page(pageId);
+    Page* page = buffer_pool_manager_->new_page(pageId, strategy);
     if(page == nullptr)
         return {&file_hdr_, nullptr};
 
@@ -341,6 +484,10 @@ RmPageHandle RmFileHandle::create_new_page_handle() {
     pageHandle.page_hdr->num_records = 0;
     pageHandle.page_hdr->next_free_page_no = RM_NO_PAGE;
     Bitmap::init(pageHandle.bitmap,pageHandle.file_hdr->bitmap_size);
+    if (pageHandle.heap_hdr != nullptr) {
+        *pageHandle.heap_hdr = RmHeapHdr{0, PAGE_SIZE, 0, 1};
+    }
+    zone_map_.reset_page(pageHandle.page->get_page_id().page_no);
 
     // 3.更新file_hdr_
     file_hdr_.num_pages++;
@@ -355,7 +502,7 @@ RmPageHandle RmFileHandle::create_new_page_handle() {
  * @return RmPageHandle 返回生成的空闲page handle
  * @note pin the page, remember to unpin it outside!
  */
-RmPageHandle RmFileHandle::create_page_handle() {
+RmPageHandle RmFileHandle::create_page_handle(BufferAccessStrategy* strategy) {
     // Todo: v
     // 1. 判断file_hdr_中是否还有空闲页
     //     1.1 没有空闲页：使用缓冲池来创建一个新page；可直接调用create_new_page_handle()
@@ -363,11 +510,11 @@ RmPageHandle RmFileHandle::create_page_handle() {
     // 2. 生成page handle并返回给上层
 
     if(file_hdr_.first_free_page_no == RM_NO_PAGE)
-        return create_new_page_handle();
+        return create_new_page_handle(strategy);
     else
     {
         int page_no = file_hdr_.first_free_page_no;
-        return fetch_page_handle(page_no);
+        return fetch_page_handle(page_no, strategy);
     }
 }
 
@@ -385,6 +532,13 @@ void RmFileHandle::release_page_handle(RmPageHandle&page_handle) {
         // 如何判断已经在链表中的情况？
         return;
     }
+    if(page_handle.heap_hdr != nullptr) {
+        // 变长格式的页面满了之后可能仍在链表中，由页头记录
+        if(page_handle.heap_hdr->in_free_list) {
+            return;
+        }
+        page_handle.heap_hdr->in_free_list = 1;
+    }
     page_handle.page_hdr->next_free_page_no = file_hdr_.first_free_page_no;
     file_hdr_.first_free_page_no = page_handle.page->get_page_id().page_no;
     disk_manager_->write_page(fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_)); // 更新之后，需要立即写回磁盘
@@ -407,16 +561,13 @@ void RmFileHandle::mark_delete_record(const Rid &rid, Context *context, std::str
     log_mgr->add_log_to_buffer(log_record);
     txn->set_prev_lsn(log_record->lsn_);
     log_mgr->active_txn_table_[txn->getTxnId()] = log_record->lsn_;
-    if(log_mgr->dirty_page_table_.find(PageId{fd_,rid.page_no})==log_mgr->dirty_page_table_.end()) {
-        log_mgr->dirty_page_table_.emplace(page_id,log_record->lsn_);
-    }
+    log_mgr->add_dirty_page(page_id, log_record->lsn_);
 
     if(log_op==LogOperation::REDO) {
         Bitmap::set(pageHandle.mark_delete,rid.slot_no);
     } else {
         Bitmap::reset(pageHandle.mark_delete,rid.slot_no);
     }
-    buffer_pool_manager_->unpin_page(PageId{fd_, rid.page_no}, true);
 
     pageHandle.page->set_page_lsn(log_record->lsn_);
     pageHandle.page->WUnlock();
@@ -428,6 +579,7 @@ bool RmFileHandle::is_mark_delete(const Rid &rid, Context *context) const {
     pageHandle.page->RLock();
     auto res = Bitmap::is_set(pageHandle.mark_delete, rid.slot_no);
     pageHandle.page->RUnlock();
+    buffer_pool_manager_->unpin_page(PageId{fd_, rid.page_no}, false);
     return res;
 
 }
@@ -453,6 +605,238 @@ RmFileHandle::mark_delete_record_recover(const Rid &rid, lsn_t lsn, int first_fr
     buffer_pool_manager_->unpin_page(PageId{fd_,rid.page_no}, true);
 }
 
+/**
+ * @description: 重做批量导入，追加的页面已经持久化，只需要恢复文件头
+ * @param {int} first_free_page 追加页面之后的first_free_page_no
+ * @param {int} num_pages 追加页面之后的num_pages
+ */
+void RmFileHandle::bulk_load_recover(int first_free_page, int num_pages) {
+    file_hdr_.first_free_page_no = first_free_page;
+    file_hdr_.num_pages = num_pages;
+    if (disk_manager_->get_fd2pageno(fd_) < num_pages) {
+        disk_manager_->set_fd2pageno(fd_, num_pages);
+    }
+    disk_manager_->write_page(fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
+}
 
+/**
+ * @description: 撤销批量导入，把文件头恢复成追加页面之前的内容，之后分配的页面覆盖导入的页面
+ * @param {int} first_free_page 追加页面之前的first_free_page_no
+ * @param {int} num_pages 追加页面之前的num_pages
+ */
+void RmFileHandle::bulk_load_undo(int first_free_page, int num_pages) {
+    file_hdr_.first_free_page_no = first_free_page;
+    file_hdr_.num_pages = num_pages;
+    disk_manager_->set_fd2pageno(fd_, num_pages);
+    disk_manager_->write_page(fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
+}
+
+/**
+ * 以下函数处理三种页面格式的差异。定长格式页面中记录直接存放在slot中；
+ * 变长格式页面中记录编码后存放在页面末尾的记录区，slot目录记录每条记录的位置和容量；
+ * PAX格式页面中记录按字段拆开，分别存放在各字段的minipage中
+ */
+
+// 全0的页面中heap_begin为0，表示记录区为空
+static int get_heap_begin(const RmHeapHdr *heap_hdr) {
+    return heap_hdr->heap_begin == 0 ? PAGE_SIZE : heap_hdr->heap_begin;
+}
 
+// slot目录有num_slots项时目录末尾在页面中的偏移
+static int get_dir_end(const RmPageHandle &page_handle, int num_slots) {
+    return static_cast<int>(page_handle.slots - page_handle.page->get_data()) + num_slots * static_cast<int>(sizeof(RmSlot));
+}
 
+/**
+ * @description: 把页面从空闲页面链表中取下，调用者保证页面是链表的第一个页面
+ */
+void RmFileHandle::unlink_free_page(RmPageHandle &page_handle) {
+    file_hdr_.first_free_page_no = page_handle.page_hdr->next_free_page_no;
+    page_handle.page_hdr->next_free_page_no = RM_NO_PAGE;
+    if (page_handle.heap_hdr != nullptr) {
+        page_handle.heap_hdr->in_free_list = 0;
+    }
+    disk_manager_->write_page(fd_, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
+}
+
+/**
+ * @description: 判断页面是否还能插入一条记录。变长格式的页面在slot用完之前，
+ *               也可能因为剩余空间放不下一条最长的记录而被视为已满
+ */
+bool RmFileHandle::is_page_full(const RmPageHandle &page_handle) const {
+    if (page_handle.page_hdr->num_records >= file_hdr_.num_records_per_page) {
+        return true;
+    }
+    if (page_handle.heap_hdr == nullptr) {
+        return false;
+    }
+    int slot_no = Bitmap::first_bit(false, page_handle.bitmap, file_hdr_.num_records_per_page);
+    int num_slots = std::max(page_handle.heap_hdr->num_slots, slot_no + 1);
+    int free_bytes = PAGE_SIZE - get_dir_end(page_handle, num_slots) - page_handle.heap_hdr->used_bytes;
+    return free_bytes < get_max_encoded_size();
+}
+
+/**
+ * @description: 把slot中的记录按定长格式读到buf中
+ * @param {char*} buf 长度为record_size的缓冲区
+ */
+void RmFileHandle::read_slot(const RmPageHandle &page_handle, int slot_no, char *buf) const {
+    if (file_hdr_.format == RM_FORMAT_PAX) {
+        for (auto &col : minipages_) {
+            memcpy(buf + col.offset, get_minipage_value(page_handle, col, slot_no), col.len);
+        }
+        return;
+    }
+    if (page_handle.heap_hdr == nullptr) {
+        memcpy(buf, page_handle.get_slot(slot_no), file_hdr_.record_size);
+        return;
+    }
+    decode_record(page_handle.get_slot(slot_no), buf);
+}
+
+/**
+ * @description: 把定长格式的记录写入slot，调用者已经设置好位图
+ * @return {bool} 变长格式的页面中放不下编码后的记录时返回false，页面不变
+ */
+bool RmFileHandle::write_slot(RmPageHandle &page_handle, int slot_no, const char *buf) {
+    if (file_hdr_.format == RM_FORMAT_PAX) {
+        for (auto &col : minipages_) {
+            memcpy(get_minipage_value(page_handle, col, slot_no), buf + col.offset, col.len);
+        }
+        return true;
+    }
+    if (page_handle.heap_hdr == nullptr) {
+        memcpy(page_handle.get_slot(slot_no), buf, file_hdr_.record_size);
+        return true;
+    }
+    if (!reserve_heap(page_handle, slot_no, get_encoded_size(buf), false)) {
+        return false;
+    }
+    encode_record(buf, page_handle.get_slot(slot_no));
+    return true;
+}
+
+/**
+ * @description: PAX格式页面中第slot_no条记录在字段col的minipage中的位置
+ */
+char *RmFileHandle::get_minipage_value(const RmPageHandle &page_handle, const RmMinipage &col, int slot_no) const {
+    return page_handle.slots + static_cast<size_t>(file_hdr_.num_records_per_page) * col.offset +
+           static_cast<size_t>(slot_no) * col.len;
+}
+
+/**
+ * @description: 删除记录后回收变长格式页面中slot占用的记录区
+ */
+void RmFileHandle::free_slot(RmPageHandle &page_handle, int slot_no) {
+    RmHeapHdr *heap_hdr = page_handle.heap_hdr;
+    if (heap_hdr == nullptr || slot_no >= heap_hdr->num_slots) {
+        return;
+    }
+    RmSlot &slot = page_handle.get_dir()[slot_no];
+    if (slot.capacity == 0) {
+        return;
+    }
+    heap_hdr->used_bytes -= slot.capacity;
+    if (slot.offset == get_heap_begin(heap_hdr)) {
+        heap_hdr->heap_begin = slot.offset + slot.capacity;
+    }
+    slot = RmSlot{0, 0};
+}
+
+/**
+ * @description: 为slot分配至少size字节的记录区。容量已经足够时不做任何事；
+ *               否则释放原来的空间重新分配，连续的空闲空间不够时先整理页面
+ * @param {bool} dry_run 为true时只判断能否放下，不修改页面
+ * @return {bool} 页面的剩余空间放不下时返回false
+ */
+bool RmFileHandle::reserve_heap(RmPageHandle &page_handle, int slot_no, int size, bool dry_run) {
+    RmHeapHdr *heap_hdr = page_handle.heap_hdr;
+    int capacity = slot_no < heap_hdr->num_slots ? page_handle.get_dir()[slot_no].capacity : 0;
+    if (capacity >= size) {
+        return true;
+    }
+    int num_slots = std::max(heap_hdr->num_slots, slot_no + 1);
+    int dir_end = get_dir_end(page_handle, num_slots);
+    if (PAGE_SIZE - dir_end - (heap_hdr->used_bytes - capacity) < size) {
+        return false;
+    }
+    if (dry_run) {
+        return true;
+    }
+    RmSlot *dir = page_handle.get_dir();
+    // slot目录变长的部分可能与记录区重叠，整理页面之后再写入
+    int old_num_slots = heap_hdr->num_slots;
+    heap_hdr->num_slots = num_slots;
+    heap_hdr->heap_begin = get_heap_begin(heap_hdr);
+    if (slot_no < old_num_slots) {
+        free_slot(page_handle, slot_no);
+    }
+    if (heap_hdr->heap_begin - dir_end < size) {
+        // 把所有记录紧凑地移到页面末尾
+        char *data = page_handle.page->get_data();
+        std::vector<char> copy(data, data + PAGE_SIZE);
+        int heap_begin = PAGE_SIZE;
+        for (int i = 0; i < old_num_slots; i++) {
+            if (dir[i].capacity == 0) {
+                continue;
+            }
+            heap_begin -= dir[i].capacity;
+            memcpy(data + heap_begin, copy.data() + dir[i].offset, dir[i].capacity);
+            dir[i].offset = static_cast<uint16_t>(heap_begin);
+        }
+        heap_hdr->heap_begin = heap_begin;
+    }
+    for (int i = old_num_slots; i < num_slots; i++) {
+        dir[i] = RmSlot{0, 0};
+    }
+    heap_hdr->heap_begin -= size;
+    heap_hdr->used_bytes += size;
+    dir[slot_no] = RmSlot{static_cast<uint16_t>(heap_hdr->heap_begin), static_cast<uint16_t>(size)};
+    return true;
+}
+
+/**
+ * @description: 计算定长格式的记录编码后的长度
+ */
+int RmFileHandle::get_encoded_size(const char *buf) const {
+    int size = file_hdr_.record_size;
+    for (auto &col : var_cols_) {
+        size += static_cast<int>(sizeof(uint16_t) + strnlen(buf + col.offset, col.len)) - col.len;
+    }
+    return size;
+}
+
+/**
+ * @description: 把定长格式的记录编码写入out。VARCHAR字段写成两字节的长度加上去掉末尾填充的内容，其他字段原样复制
+ */
+void RmFileHandle::encode_record(const char *buf, char *out) const {
+    int pos = 0;
+    for (auto &col : var_cols_) {
+        memcpy(out, buf + pos, col.offset - pos);
+        out += col.offset - pos;
+        auto len = static_cast<uint16_t>(strnlen(buf + col.offset, col.len));
+        memcpy(out, &len, sizeof(len));
+        memcpy(out + sizeof(len), buf + col.offset, len);
+        out += sizeof(len) + len;
+        pos = col.offset + col.len;
+    }
+    memcpy(out, buf + pos, file_hdr_.record_size - pos);
+}
+
+/**
+ * @description: 把编码后的记录还原成定长格式，VARCHAR字段末尾补0
+ */
+void RmFileHandle::decode_record(const char *in, char *buf) const {
+    int pos = 0;
+    for (auto &col : var_cols_) {
+        memcpy(buf + pos, in, col.offset - pos);
+        in += col.offset - pos;
+        uint16_t len;
+        memcpy(&len, in, sizeof(len));
+        memcpy(buf + col.offset, in + sizeof(len), len);
+        memset(buf + col.offset + len, 0, col.len - len);
+        in += sizeof(len) + len;
+        pos = col.offset + col.len;
+    }
+    memcpy(buf + pos, in, file_hdr_.record_size - pos);
+}
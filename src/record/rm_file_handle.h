@@ -13,10 +13,13 @@ See the Mulan PSL v2 for more details. */
 #include <assert.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "bitmap.h"
 #include "common/context.h"
 #include "rm_defs.h"
+#include "rm_zone_map.h"
 #include "storage/buffer_pool_manager.h"
 
 class RmManager;
@@ -26,31 +29,209 @@ struct RmPageHandle {
     const RmFileHdr *file_hdr;  // 当前页面所在文件的文件头指针
     Page *page;                 // 页面的实际数据，包括页面存储的数据、元信息等
     RmPageHdr *page_hdr;        // page->data的第一部分，存储页面元信息，指针指向首地址，长度为sizeof(RmPageHdr)
+    RmHeapHdr *heap_hdr;        // 变长格式页面紧跟在page_hdr之后的页头，定长格式页面为nullptr
     char *bitmap;               // page->data的第二部分，存储页面的bitmap，指针指向首地址，长度为file_hdr->bitmap_size
     char *mark_delete;
     char *slots;                // page->data的第三部分，存储表的记录，指针指向首地址，每个slot的长度为file_hdr->record_size
+                                // 变长格式页面中为slot目录的首地址，每一项为RmSlot；PAX格式页面中为第一个minipage的首地址
     RmPageHandle(const RmFileHdr *fhdr_, Page *page_) : file_hdr(fhdr_), page(page_) {
         page_hdr = reinterpret_cast<RmPageHdr *>(page->get_data() + page->OFFSET_PAGE_HDR);
+        heap_hdr = nullptr;
         bitmap = page->get_data() + sizeof(RmPageHdr) + page->OFFSET_PAGE_HDR;
-        mark_delete = page->get_data() + sizeof(RmPageHdr) + page->OFFSET_PAGE_HDR + file_hdr->bitmap_size;
+        if (file_hdr->format == RM_FORMAT_SLOTTED) {
+            heap_hdr = reinterpret_cast<RmHeapHdr *>(bitmap);
+            bitmap += sizeof(RmHeapHdr);
+        }
+        mark_delete = bitmap + file_hdr->bitmap_size;
         slots = bitmap + 2 * file_hdr->bitmap_size;
     }
-    // 返回指定slot_no的slot存储收地址
+    // 返回指定slot_no的slot存储收地址，变长格式页面中为记录编码后的首地址
     char* get_slot(int slot_no) const {
+        if (heap_hdr != nullptr) {
+            return page->get_data() + get_dir()[slot_no].offset;
+        }
         return slots + slot_no * file_hdr->record_size;  // slots的首地址 + slot个数 * 每个slot的大小(每个record的大小)
     }
+
+    RmSlot *get_dir() const { return reinterpret_cast<RmSlot *>(slots); }
+};
+
+/**
+ * @description: 直接指向buffer pool中一条记录的只读视图，不复制记录的数据。
+ * 视图存在期间持有记录所在页面的pin和读锁，析构或者release时释放，因此视图应当在判断完条件后尽快释放，
+ * 不能在持有视图时申请记录锁等可能阻塞的资源。需要保留记录时调用materialize复制出一个RmRecord。
+ * 变长格式的记录需要解码，视图持有解码后的副本，不再占用页面
+ */
+class RecordView {
+   public:
+    RecordView() = default;
+
+    RecordView(BufferPoolManager *buffer_pool_manager, Page *page, const char *data, int size)
+        : buffer_pool_manager_(buffer_pool_manager), page_(page), data_(data), size_(size) {}
+
+    explicit RecordView(std::vector<char> buffer)
+        : data_(buffer.data()), size_(static_cast<int>(buffer.size())), buffer_(std::move(buffer)) {}
+
+    RecordView(const RecordView &) = delete;
+    RecordView &operator=(const RecordView &) = delete;
+
+    RecordView(RecordView &&other) noexcept { *this = std::move(other); }
+
+    RecordView &operator=(RecordView &&other) noexcept {
+        if (this != &other) {
+            release();
+            buffer_pool_manager_ = std::exchange(other.buffer_pool_manager_, nullptr);
+            page_ = std::exchange(other.page_, nullptr);
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            buffer_ = std::move(other.buffer_);
+        }
+        return *this;
+    }
+
+    ~RecordView() { release(); }
+
+    const char *data() const { return data_; }
+
+    int size() const { return size_; }
+
+    bool is_valid() const { return data_ != nullptr; }
+
+    // 把记录复制出来，之后不再依赖页面
+    std::unique_ptr<RmRecord> materialize() const { return std::make_unique<RmRecord>(size_, data_); }
+
+    // 释放页面的读锁和pin，视图随之失效
+    void release() {
+        data_ = nullptr;
+        buffer_.clear();
+        if (page_ == nullptr) {
+            return;
+        }
+        page_->RUnlock();
+        buffer_pool_manager_->unpin_page(page_->get_page_id(), false);
+        page_ = nullptr;
+    }
+
+   private:
+    BufferPoolManager *buffer_pool_manager_ = nullptr;
+    Page *page_ = nullptr;
+    const char *data_ = nullptr;
+    int size_ = 0;
+    std::vector<char> buffer_;  // 解码后的记录，指向页面时为空
+};
+
+/**
+ * @description: 一个页面中所有有效记录的只读批次，与RecordView一样直接指向buffer pool中的页面。
+ * 批次存在期间持有页面的pin和读锁，扫描时一次pin就能处理整页记录，用完后应当尽快release。
+ * 变长格式的页面在读取时就把记录依次解码到decoded_中，随即释放页面。
+ * PAX格式的页面只把扫描需要的字段按列复制到decoded_中，其余字段为0，页面保持pin和读锁，materialize时再补齐输出的字段
+ */
+class RecordBatch {
+    friend class RmFileHandle;
+
+   public:
+    RecordBatch() = default;
+
+    RecordBatch(const RecordBatch &) = delete;
+    RecordBatch &operator=(const RecordBatch &) = delete;
+
+    // 移动之后页面的pin和读锁归新的批次所有，原批次为空
+    RecordBatch(RecordBatch &&other) noexcept { take(other); }
+
+    RecordBatch &operator=(RecordBatch &&other) noexcept {
+        if (this != &other) {
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~RecordBatch() { release(); }
+
+    size_t size() const { return slots_.size(); }
+
+    bool empty() const { return slots_.empty(); }
+
+    Rid rid(size_t i) const { return Rid{page_no_, slots_[i]}; }
+
+    const char *data(size_t i) const {
+        if (slot_data_ == nullptr) {
+            return decoded_.data() + i * record_size_;
+        }
+        return slot_data_ + static_cast<size_t>(slots_[i]) * record_size_;
+    }
+
+    int record_size() const { return record_size_; }
+
+    // 把第i条记录复制出来，之后不再依赖页面
+    std::unique_ptr<RmRecord> materialize(size_t i) const {
+        auto record = std::make_unique<RmRecord>(record_size_, data(i));
+        if (output_cols_ != nullptr) {
+            for (auto &col : *output_cols_) {
+                memcpy(record->data + col.offset, minipages_ + static_cast<size_t>(num_records_per_page_) * col.offset +
+                                                      static_cast<size_t>(slots_[i]) * col.len, col.len);
+            }
+        }
+        return record;
+    }
+
+    // 释放页面的读锁和pin，批次清空，slots_和decoded_的空间留给下一页复用
+    void release() {
+        slots_.clear();
+        slot_data_ = nullptr;
+        minipages_ = nullptr;
+        output_cols_ = nullptr;
+        if (page_ == nullptr) {
+            return;
+        }
+        page_->RUnlock();
+        buffer_pool_manager_->unpin_page(page_->get_page_id(), false);
+        page_ = nullptr;
+    }
+
+   private:
+    void take(RecordBatch &other) {
+        buffer_pool_manager_ = other.buffer_pool_manager_;
+        page_ = std::exchange(other.page_, nullptr);
+        page_no_ = other.page_no_;
+        slot_data_ = std::exchange(other.slot_data_, nullptr);
+        record_size_ = other.record_size_;
+        slots_ = std::move(other.slots_);
+        other.slots_.clear();
+        decoded_ = std::move(other.decoded_);
+        other.decoded_.clear();
+        minipages_ = std::exchange(other.minipages_, nullptr);
+        num_records_per_page_ = other.num_records_per_page_;
+        output_cols_ = std::exchange(other.output_cols_, nullptr);
+    }
+
+    BufferPoolManager *buffer_pool_manager_ = nullptr;
+    Page *page_ = nullptr;
+    int page_no_ = RM_NO_PAGE;
+    const char *slot_data_ = nullptr;   // 定长格式页面中slot的首地址
+    int record_size_ = 0;
+    std::vector<int> slots_;    // 批次中记录的slot_no，从小到大
+    std::vector<char> decoded_; // 变长格式页面中解码后的记录，PAX格式页面中扫描需要的字段
+    const char *minipages_ = nullptr;   // PAX格式页面中第一个minipage的首地址
+    int num_records_per_page_ = 0;
+    const std::vector<RmMinipage> *output_cols_ = nullptr;  // PAX格式中materialize时从页面中补齐的字段
 };
 
 /* 每个RmFileHandle对应一个表的数据文件，里面有多个page，每个page的数据封装在RmPageHandle中 */
 class RmFileHandle {      
     friend class RmScan;    
+    friend class RmPageScan;
     friend class RmManager;
+    friend class RmBulkLoader;
 
    private:
     DiskManager *disk_manager_;
     BufferPoolManager *buffer_pool_manager_;
     int fd_;        // 打开文件后产生的文件句柄
     RmFileHdr file_hdr_;    // 文件头，维护当前表文件的元数据
+    mutable RmZoneMap zone_map_;    // 每个页面中字段的取值范围，由SmManager根据表的字段打开
+    std::vector<RmVarCol> var_cols_;    // VARCHAR字段，按offset从小到大排列
+    std::vector<RmMinipage> minipages_; // PAX格式中所有字段的minipage，按offset从小到大排列
 
    public:
     RmFileHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd)
@@ -58,7 +239,20 @@ class RmFileHandle {
         // 注意：这里从磁盘中读出文件描述符为fd的文件的file_hdr，读到内存中
         // 这里实际就是初始化file_hdr，只不过是从磁盘中读出进行初始化
         // init file_hdr_
-        disk_manager_->read_page(fd, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
+        std::vector<char> hdr_page(PAGE_SIZE);
+        disk_manager_->read_page(fd, RM_FILE_HDR_PAGE, hdr_page.data(), PAGE_SIZE);
+        memcpy(&file_hdr_, hdr_page.data(), sizeof(file_hdr_));
+        if (!has_valid_layout(hdr_page.data())) {
+            // 加入页面格式之前创建的表文件，文件头之后的内容没有初始化，按定长格式打开
+            file_hdr_.format = RM_FORMAT_FIXED;
+            file_hdr_.num_var_cols = 0;
+            file_hdr_.num_minipages = 0;
+        }
+        var_cols_.resize(file_hdr_.num_var_cols);
+        memcpy(var_cols_.data(), hdr_page.data() + sizeof(file_hdr_), var_cols_.size() * sizeof(RmVarCol));
+        minipages_.resize(file_hdr_.num_minipages);
+        memcpy(minipages_.data(), hdr_page.data() + sizeof(file_hdr_) + var_cols_.size() * sizeof(RmVarCol),
+               minipages_.size() * sizeof(RmMinipage));
         // disk_manager管理的fd对应的文件中，设置从file_hdr_.num_pages开始分配page_no
         disk_manager_->set_fd2pageno(fd, file_hdr_.num_pages);
     }
@@ -78,16 +272,29 @@ class RmFileHandle {
         return file_hdr_;
     }
 
+    RmZoneMap &get_zone_map() { return zone_map_; }
+
+    const std::vector<RmMinipage> &get_minipages() const { return minipages_; }
+
     /* 判断指定位置上是否已经存在一条记录，通过Bitmap来判断 */
     bool is_record(const Rid &rid) const {
         RmPageHandle page_handle = fetch_page_handle(rid.page_no);
-        return Bitmap::is_set(page_handle.bitmap, rid.slot_no);  // page的slot_no位置上是否有record
+        bool res = Bitmap::is_set(page_handle.bitmap, rid.slot_no);  // page的slot_no位置上是否有record
+        buffer_pool_manager_->unpin_page(PageId{fd_, rid.page_no}, false);
+        return res;
     }
 
     std::unique_ptr<RmRecord> get_record(const Rid &rid, Context *context) const;
 
+    RecordView get_record_view(const Rid &rid) const;
+
+    void get_page_batch(int page_no, RecordBatch *batch, bool skip_mark_deleted,
+                        BufferAccessStrategy *strategy = nullptr, const std::vector<RmMinipage> *scan_cols = nullptr,
+                        const std::vector<RmMinipage> *output_cols = nullptr) const;
+
     Rid insert_record(char *buf, Context *context, std::string* table_name= nullptr,
-                      LogOperation log_op = LogOperation::REDO, lsn_t undo_next = INVALID_LSN);
+                      LogOperation log_op = LogOperation::REDO, lsn_t undo_next = INVALID_LSN,
+                      BufferAccessStrategy *strategy = nullptr);
     void mark_delete_record(const Rid &rid, Context *context, std::string* table_name,
                             LogOperation log_op = LogOperation::REDO, lsn_t undo_next = INVALID_LSN);
     bool is_mark_delete(const Rid &rid, Context *context) const;
@@ -109,12 +316,38 @@ class RmFileHandle {
     void delete_record_recover(const Rid &rid, lsn_t lsn, int first_free_page, int num_pages);
     void update_record_recover(const Rid &rid, char *buf, lsn_t lsn, int first_free_page, int num_pages);
     void mark_delete_record_recover(const Rid &rid, lsn_t lsn, int first_free_page, int num_pages, bool mark);
-    RmPageHandle create_new_page_handle();
+    void bulk_load_recover(int first_free_page, int num_pages);
+    void bulk_load_undo(int first_free_page, int num_pages);
+    RmPageHandle create_new_page_handle(BufferAccessStrategy *strategy = nullptr);
 
-    RmPageHandle fetch_page_handle(int page_no) const;
+    RmPageHandle fetch_page_handle(int page_no, BufferAccessStrategy *strategy = nullptr) const;
 
    private:
-    RmPageHandle create_page_handle();
+    bool has_valid_layout(const char *hdr_page) const;
+
+    RmPageHandle create_page_handle(BufferAccessStrategy *strategy = nullptr);
 
     void release_page_handle(RmPageHandle &page_handle);
+
+    void unlink_free_page(RmPageHandle &page_handle);
+
+    bool is_page_full(const RmPageHandle &page_handle) const;
+
+    void read_slot(const RmPageHandle &page_handle, int slot_no, char *buf) const;
+
+    bool write_slot(RmPageHandle &page_handle, int slot_no, const char *buf);
+
+    char *get_minipage_value(const RmPageHandle &page_handle, const RmMinipage &col, int slot_no) const;
+
+    void free_slot(RmPageHandle &page_handle, int slot_no);
+
+    int get_encoded_size(const char *buf) const;
+
+    int get_max_encoded_size() const { return file_hdr_.record_size + static_cast<int>(var_cols_.size() * sizeof(uint16_t)); }
+
+    void encode_record(const char *buf, char *out) const;
+
+    void decode_record(const char *in, char *buf) const;
+
+    bool reserve_heap(RmPageHandle &page_handle, int slot_no, int size, bool dry_run);
 };
\ No newline at end of file
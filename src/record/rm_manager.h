@@ -30,9 +30,12 @@ class RmManager {
      * @description: 创建表的数据文件并初始化相关信息
      * @param {string&} filename 要创建的文件名称
      * @param {int} record_size 表中记录的大小
+     * @param {vector<RmVarCol>&} var_cols 表中的VARCHAR字段，不为空时使用变长格式的页面
+     * @param {vector<RmMinipage>&} minipages 表中的所有字段，不为空时使用PAX格式的页面，此时VARCHAR字段按定长存放
      */ 
-    void create_file(const std::string& filename, int record_size) {
-        if (record_size < 1 || record_size > RM_MAX_RECORD_SIZE) {
+    void create_file(const std::string& filename, int record_size, const std::vector<RmVarCol>& var_cols = {},
+                     const std::vector<RmMinipage>& minipages = {}) {
+        if (record_size < 1 || record_size > RM_MAX_RECORD_SIZE * (PAGE_SIZE / DEFAULT_PAGE_SIZE)) {
             throw InvalidRecordSizeError(record_size);
         }
         disk_manager_->create_file(filename);
@@ -50,9 +53,31 @@ class RmManager {
 
         file_hdr.num_records_per_page =
                 (BITMAP_WIDTH * (PAGE_SIZE - 1 - (int)sizeof(RmFileHdr)) + 1) / (2 + record_size * BITMAP_WIDTH);
+        if (!minipages.empty()) {
+            // 每个minipage按slot个数存放字段的值，页面的容量与定长格式相同
+            file_hdr.format = RM_FORMAT_PAX;
+            file_hdr.num_minipages = (int)minipages.size();
+        } else if (!var_cols.empty()) {
+            // 变长格式按VARCHAR字段都为空串时的最短记录计算slot个数，每个slot还需要一项slot目录
+            int min_size = record_size;
+            for (auto &col : var_cols) {
+                min_size += (int)sizeof(uint16_t) - col.len;
+            }
+            int avail = PAGE_SIZE - Page::OFFSET_PAGE_HDR - (int)sizeof(RmPageHdr) - (int)sizeof(RmHeapHdr);
+            file_hdr.format = RM_FORMAT_SLOTTED;
+            file_hdr.num_var_cols = (int)var_cols.size();
+            file_hdr.num_records_per_page =
+                BITMAP_WIDTH * avail / (2 + BITMAP_WIDTH * ((int)sizeof(RmSlot) + min_size));
+            file_hdr.bitmap_size = (file_hdr.num_records_per_page + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+        }
         // 将file header写入磁盘文件（名为file name，文件描述符为fd）中的第0页
         // head page直接写入磁盘，没有经过缓冲区的NewPage，那么也就不需要FlushPage
-        disk_manager_->write_page(fd, RM_FILE_HDR_PAGE, (char *)&file_hdr, PAGE_SIZE);
+        std::vector<char> page_buf(PAGE_SIZE);
+        memcpy(page_buf.data(), &file_hdr, sizeof(file_hdr));
+        memcpy(page_buf.data() + sizeof(file_hdr), var_cols.data(), file_hdr.num_var_cols * sizeof(RmVarCol));
+        memcpy(page_buf.data() + sizeof(file_hdr) + file_hdr.num_var_cols * sizeof(RmVarCol), minipages.data(),
+               minipages.size() * sizeof(RmMinipage));
+        disk_manager_->write_page(fd, RM_FILE_HDR_PAGE, page_buf.data(), PAGE_SIZE);
         disk_manager_->close_file(fd);
     }
 
@@ -9,13 +9,18 @@ MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
 See the Mulan PSL v2 for more details. */
 
 #include "rm_scan.h"
+
+#include <algorithm>
+
 #include "rm_file_handle.h"
 
 /**
  * @brief 初始化file_handle和rid
  * @param file_handle
+ * @param strategy 批量读的访问策略，扫描缺页时只在其环形缓冲区中换页
  */
-RmScan::RmScan(const RmFileHandle *file_handle) : file_handle_(file_handle) {
+RmScan::RmScan(const RmFileHandle *file_handle, BufferAccessStrategy *strategy)
+    : file_handle_(file_handle), strategy_(strategy) {
     // 初始化file_handle和rid（指向第一个存放了记录的位置）
 
     //初始化
@@ -35,7 +40,10 @@ void RmScan::next() {
     //遍历页
     for(int page_no = rid_.page_no; page_no < file_handle_->file_hdr_.num_pages;page_no++)
     {
-        RmPageHandle pageHandle = file_handle_->fetch_page_handle(page_no);
+        // 在游标前方预读，之后的fetch_page_handle通常不会缺页
+        file_handle_->buffer_pool_manager_->read_ahead(&read_ahead_, PageId{file_handle_->fd_, page_no},
+                                                       file_handle_->file_hdr_.num_pages, strategy_);
+        RmPageHandle pageHandle = file_handle_->fetch_page_handle(page_no, strategy_);
         int ret = Bitmap::next_bit(true, pageHandle.bitmap, file_handle_->file_hdr_.num_records_per_page,rid_.slot_no);
         if(ret != file_handle_->file_hdr_.num_records_per_page)
         {
@@ -65,4 +73,79 @@ bool RmScan::is_end() const {
  */
 Rid RmScan::rid() const {
     return rid_;
-}
\ No newline at end of file
+}
+/**
+ * @brief 从第一个存放记录的页面开始按页扫描
+ * @param file_handle
+ * @param strategy 批量读的访问策略，扫描缺页时只在其环形缓冲区中换页
+ */
+RmPageScan::RmPageScan(const RmFileHandle *file_handle, BufferAccessStrategy *strategy)
+    : file_handle_(file_handle), page_no_(RM_FIRST_RECORD_PAGE), run_end_(RM_FIRST_RECORD_PAGE), strategy_(strategy) {}
+
+/**
+ * @brief 指定扫描需要读取的字段。PAX格式的表只读取这些字段的minipage，其他格式的表仍然读取整条记录
+ * @param scan_offsets 判断条件需要的字段在记录中的偏移，批次的data中只有这些字段
+ * @param output_offsets 满足条件的记录materialize时还需要的字段，其余字段为0
+ */
+void RmPageScan::set_columns(const std::vector<int> &scan_offsets, const std::vector<int> &output_offsets) {
+    auto &minipages = file_handle_->minipages_;
+    auto pick = [&minipages](const std::vector<int> &offsets, std::vector<RmMinipage> *cols) {
+        cols->clear();
+        for (auto &col : minipages) {
+            if (std::find(offsets.begin(), offsets.end(), col.offset) != offsets.end()) {
+                cols->push_back(col);
+            }
+        }
+    };
+    pick(scan_offsets, &scan_cols_);
+    pick(output_offsets, &output_cols_);
+    project_ = !minipages.empty();
+}
+
+/**
+ * @brief 读出下一个含有记录的页面，空页面直接跳过。设置了条件时，zone map表明不可能满足条件的页面不会被读取
+ * @param batch 保存页面中的记录，调用者用完后应尽快release
+ * @param skip_mark_deleted 是否跳过已经被标记删除的记录
+ * @return 到达文件末尾时返回false，此时batch为空
+ */
+bool RmPageScan::next_batch(RecordBatch *batch, bool skip_mark_deleted) {
+    int num_pages = file_handle_->file_hdr_.num_pages;
+    while (page_no_ < num_pages) {
+        if (page_no_ >= run_end_) {
+            // 找到下一段可能满足条件的连续页面，预读只在这一段内进行
+            auto &zone_map = file_handle_->zone_map_;
+            run_end_ = num_pages;
+            if (!preds_.empty()) {
+                while (page_no_ < num_pages && !zone_map.may_match(page_no_, preds_)) {
+                    page_no_++;
+                }
+                if (page_no_ >= num_pages) {
+                    break;
+                }
+                run_end_ = page_no_ + 1;
+                while (run_end_ < num_pages && zone_map.may_match(run_end_, preds_)) {
+                    run_end_++;
+                }
+            }
+        }
+        file_handle_->buffer_pool_manager_->read_ahead(&read_ahead_, PageId{file_handle_->fd_, page_no_},
+                                                       run_end_, strategy_);
+        if (project_) {
+            file_handle_->get_page_batch(page_no_++, batch, skip_mark_deleted, strategy_, &scan_cols_, &output_cols_);
+        } else {
+            file_handle_->get_page_batch(page_no_++, batch, skip_mark_deleted, strategy_);
+        }
+        if (!batch->empty()) {
+            return true;
+        }
+    }
+    batch->release();
+    return false;
+}
+
+/**
+ * @brief 判断是否已经扫描完所有页面
+ */
+bool RmPageScan::is_end() const {
+    return page_no_ >= file_handle_->file_hdr_.num_pages;
+}
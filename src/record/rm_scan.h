@@ -10,15 +10,23 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <vector>
+
 #include "rm_defs.h"
+#include "rm_zone_map.h"
+#include "storage/buffer_access_strategy.h"
+#include "storage/read_ahead.h"
 
 class RmFileHandle;
+class RecordBatch;
 
 class RmScan : public RecScan {
     const RmFileHandle *file_handle_;
     Rid rid_;
+    BufferAccessStrategy *strategy_;    // 批量读的访问策略，为nullptr时直接使用共享的buffer pool
+    ReadAheadState read_ahead_{true};   // 顺序扫描按页号递增访问，直接开启预读
 public:
-    RmScan(const RmFileHandle *file_handle);
+    RmScan(const RmFileHandle *file_handle, BufferAccessStrategy *strategy = nullptr);
 
     void next() override;
 
@@ -26,3 +34,26 @@ public:
 
     Rid rid() const override;
 };
+
+/* 按页面扫描表，每次返回一个页面中的所有有效记录，整页记录只需要pin一次页面 */
+class RmPageScan {
+    const RmFileHandle *file_handle_;
+    int page_no_;                       // 下一个要读取的页面号
+    int run_end_;                       // [page_no_, run_end_)中的页面都可能满足条件，预读不超过run_end_
+    BufferAccessStrategy *strategy_;
+    ReadAheadState read_ahead_{true};
+    std::vector<ZonePredicate> preds_;  // 用zone map跳过页面的条件
+    bool project_{false};               // 是否只读取部分字段，只对PAX格式的表有效
+    std::vector<RmMinipage> scan_cols_;     // 判断条件需要的字段
+    std::vector<RmMinipage> output_cols_;   // 输出的记录中需要的字段
+public:
+    RmPageScan(const RmFileHandle *file_handle, BufferAccessStrategy *strategy = nullptr);
+
+    void set_predicates(std::vector<ZonePredicate> preds) { preds_ = std::move(preds); }
+
+    void set_columns(const std::vector<int> &scan_offsets, const std::vector<int> &output_offsets);
+
+    bool next_batch(RecordBatch *batch, bool skip_mark_deleted = true);
+
+    bool is_end() const;
+};
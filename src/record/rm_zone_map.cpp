@@ -0,0 +1,222 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "rm_zone_map.h"
+
+#include <cstdio>
+#include <fstream>
+
+static constexpr uint32_t ZONE_MAP_MAGIC = 0x4d5a5852;  // "RXZM"
+
+/**
+ * @description: 根据表的字段初始化zone map，并读入上次关闭时保存的旁路文件。
+ *               文件读入后立即删除，之后崩溃时不会读到过时的范围
+ * @param {vector<ColMeta>&} cols 表的字段，只为INT、FLOAT、BIGINT和DATETIME字段维护范围
+ * @param {int} num_pages 数据文件当前的页面数
+ * @param {string&} path 旁路文件的路径
+ */
+void RmZoneMap::open(const std::vector<ColMeta> &cols, int num_pages, const std::string &path) {
+    std::scoped_lock lock(latch_);
+    cols_.clear();
+    bound_offsets_.clear();
+    page_bytes_ = 0;
+    for (auto &col : cols) {
+        if (col.type == TYPE_STRING) {
+            continue;
+        }
+        cols_.push_back(ZoneCol{col.offset, col.len, col.type});
+        bound_offsets_.push_back(page_bytes_);
+        page_bytes_ += 2 * col.len;
+    }
+    states_.assign(num_pages, ZONE_UNKNOWN);
+    bounds_.assign(static_cast<size_t>(num_pages) * page_bytes_, 0);
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return;
+    }
+    auto read_u32 = [&](uint32_t *value) {
+        return static_cast<bool>(in.read(reinterpret_cast<char *>(value), sizeof(*value)));
+    };
+    uint32_t magic, num_cols, saved_pages;
+    bool valid = read_u32(&magic) && magic == ZONE_MAP_MAGIC && read_u32(&num_cols) && num_cols == cols_.size();
+    for (size_t i = 0; valid && i < cols_.size(); i++) {
+        uint32_t offset, len, type;
+        valid = read_u32(&offset) && read_u32(&len) && read_u32(&type) &&
+                static_cast<int>(offset) == cols_[i].offset && static_cast<int>(len) == cols_[i].len &&
+                static_cast<ColType>(type) == cols_[i].type;
+    }
+    // 页面数不一致说明文件与数据文件不匹配，全部按未知处理
+    valid = valid && read_u32(&saved_pages) && static_cast<int>(saved_pages) == num_pages &&
+            in.read(states_.data(), static_cast<std::streamsize>(states_.size())) &&
+            in.read(bounds_.data(), static_cast<std::streamsize>(bounds_.size()));
+    if (!valid) {
+        std::fill(states_.begin(), states_.end(), ZONE_UNKNOWN);
+    }
+    in.close();
+    std::remove(path.c_str());
+}
+
+/**
+ * @description: 把zone map写入旁路文件，关闭数据库时调用。先写临时文件再改名，避免留下不完整的文件
+ * @param {string&} path 旁路文件的路径
+ */
+void RmZoneMap::save(const std::string &path) {
+    std::scoped_lock lock(latch_);
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        auto write_u32 = [&](uint32_t value) { out.write(reinterpret_cast<const char *>(&value), sizeof(value)); };
+        write_u32(ZONE_MAP_MAGIC);
+        write_u32(static_cast<uint32_t>(cols_.size()));
+        for (auto &col : cols_) {
+            write_u32(static_cast<uint32_t>(col.offset));
+            write_u32(static_cast<uint32_t>(col.len));
+            write_u32(static_cast<uint32_t>(col.type));
+        }
+        write_u32(static_cast<uint32_t>(states_.size()));
+        out.write(states_.data(), static_cast<std::streamsize>(states_.size()));
+        out.write(bounds_.data(), static_cast<std::streamsize>(bounds_.size()));
+        if (!out) {
+            throw InternalError("RmZoneMap::save Error");
+        }
+    }
+    if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+        throw UnixError();
+    }
+}
+
+/**
+ * @description: 查找偏移为offset的字段在zone map中的下标
+ * @return {int} 字段没有维护范围时返回-1
+ */
+int RmZoneMap::find_col(int offset) const {
+    for (size_t i = 0; i < cols_.size(); i++) {
+        if (cols_[i].offset == offset) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+/**
+ * @description: 新分配的页面中没有记录，范围置为空
+ */
+void RmZoneMap::reset_page(int page_no) {
+    std::scoped_lock lock(latch_);
+    ensure_page(page_no);
+    states_[page_no] = ZONE_EMPTY;
+}
+
+/**
+ * @description: 向页面写入一条记录后扩大页面的范围，调用者持有页面的写锁
+ * @param {int} page_no 记录所在的页面
+ * @param {char*} rec 写入的记录
+ */
+void RmZoneMap::update(int page_no, const char *rec) {
+    if (cols_.empty()) {
+        return;
+    }
+    std::scoped_lock lock(latch_);
+    ensure_page(page_no);
+    // 范围未知的页面只能在读到整个页面时重新统计
+    if (states_[page_no] != ZONE_UNKNOWN) {
+        widen(page_no, rec);
+    }
+}
+
+bool RmZoneMap::is_unknown(int page_no) {
+    std::scoped_lock lock(latch_);
+    return !cols_.empty() && (page_no >= static_cast<int>(states_.size()) || states_[page_no] == ZONE_UNKNOWN);
+}
+
+/**
+ * @description: 根据页面中所有的记录重新统计范围，调用者持有页面的读锁
+ * @param {char*} slots 页面中存放记录的区域
+ * @param {int} record_size 记录的大小
+ * @param {int*} slot_nos 页面中所有记录的slot_no，包括被标记删除的记录；为nullptr时记录在slots中依次存放
+ * @param {int} num_slots 记录的个数
+ */
+void RmZoneMap::rebuild(int page_no, const char *slots, int record_size, const int *slot_nos, int num_slots) {
+    std::scoped_lock lock(latch_);
+    ensure_page(page_no);
+    states_[page_no] = ZONE_EMPTY;
+    for (int i = 0; i < num_slots; i++) {
+        int pos = slot_nos == nullptr ? i : slot_nos[i];
+        widen(page_no, slots + static_cast<size_t>(pos) * record_size);
+    }
+}
+
+/**
+ * @description: 判断页面中是否可能有满足所有条件的记录
+ * @return {bool} 范围未知时返回true；页面中从未有过记录或者某个条件与范围不相交时返回false
+ */
+bool RmZoneMap::may_match(int page_no, const std::vector<ZonePredicate> &preds) {
+    std::scoped_lock lock(latch_);
+    if (page_no >= static_cast<int>(states_.size()) || states_[page_no] == ZONE_UNKNOWN) {
+        return true;
+    }
+    if (states_[page_no] == ZONE_EMPTY) {
+        return false;
+    }
+    for (auto &pred : preds) {
+        auto &col = cols_[pred.col];
+        int cmp_min = value_compare(get_min(page_no, pred.col), pred.value, col.type, col.len);
+        int cmp_max = value_compare(get_max(page_no, pred.col), pred.value, col.type, col.len);
+        bool match = true;
+        switch (pred.op) {
+            case OP_EQ:
+                match = cmp_min <= 0 && cmp_max >= 0;
+                break;
+            case OP_LT:
+                match = cmp_min < 0;
+                break;
+            case OP_LE:
+                match = cmp_min <= 0;
+                break;
+            case OP_GT:
+                match = cmp_max > 0;
+                break;
+            case OP_GE:
+                match = cmp_max >= 0;
+                break;
+            case OP_NE:
+                break;
+        }
+        if (!match) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void RmZoneMap::ensure_page(int page_no) {
+    if (page_no >= static_cast<int>(states_.size())) {
+        states_.resize(page_no + 1, ZONE_UNKNOWN);
+        bounds_.resize(static_cast<size_t>(page_no + 1) * page_bytes_, 0);
+    }
+}
+
+void RmZoneMap::widen(int page_no, const char *rec) {
+    bool first = states_[page_no] == ZONE_EMPTY;
+    for (size_t i = 0; i < cols_.size(); i++) {
+        auto &col = cols_[i];
+        const char *value = rec + col.offset;
+        char *min = get_min(page_no, i);
+        char *max = get_max(page_no, i);
+        if (first || value_compare(value, min, col.type, col.len) < 0) {
+            memcpy(min, value, col.len);
+        }
+        if (first || value_compare(value, max, col.type, col.len) > 0) {
+            memcpy(max, value, col.len);
+        }
+    }
+    states_[page_no] = ZONE_SET;
+}
@@ -0,0 +1,79 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/common.h"
+#include "system/sm_meta.h"
+
+/* 可以用zone map过滤页面的条件：字段 op 常量 */
+struct ZonePredicate {
+    int col;             // 字段在zone map中的下标，由RmZoneMap::find_col得到
+    CompOp op;
+    const char *value;   // 常量的数据，类型与字段相同
+};
+
+/**
+ * @description: 表数据文件的zone map，为每个页面记录数值和日期字段的最小值和最大值，
+ * 顺序扫描时不需要读取就能跳过不可能满足条件的页面。
+ * 插入和更新时只会扩大范围，删除时不缩小，因此范围总是包含页面中所有的记录（包括被标记删除的记录）。
+ * zone map只保存在内存中，关闭数据库时写入旁路文件，打开时读入后立即删除该文件，
+ * 崩溃后找不到文件的页面状态为未知，扫描读到这些页面时重新统计
+ */
+class RmZoneMap {
+   public:
+    RmZoneMap() = default;
+
+    static std::string get_file_name(const std::string &tab_name) { return tab_name + ZONE_MAP_FILE_SUFFIX; }
+
+    void open(const std::vector<ColMeta> &cols, int num_pages, const std::string &path);
+
+    void save(const std::string &path);
+
+    int find_col(int offset) const;
+
+    void reset_page(int page_no);
+
+    void update(int page_no, const char *rec);
+
+    bool is_unknown(int page_no);
+
+    void rebuild(int page_no, const char *slots, int record_size, const int *slot_nos, int num_slots);
+
+    bool may_match(int page_no, const std::vector<ZonePredicate> &preds);
+
+   private:
+    enum ZoneState : char { ZONE_UNKNOWN = 0, ZONE_EMPTY, ZONE_SET };
+
+    struct ZoneCol {
+        int offset;
+        int len;
+        ColType type;
+    };
+
+    void ensure_page(int page_no);
+
+    char *get_min(int page_no, int col) { return bounds_.data() + static_cast<size_t>(page_no) * page_bytes_ + bound_offsets_[col]; }
+
+    char *get_max(int page_no, int col) { return get_min(page_no, col) + cols_[col].len; }
+
+    void widen(int page_no, const char *rec);
+
+    std::mutex latch_;
+    std::vector<ZoneCol> cols_;          // 维护范围的字段
+    std::vector<int> bound_offsets_;     // 每个字段的最小值在页面范围中的偏移，最大值紧随其后
+    int page_bytes_ = 0;                 // 每个页面的范围所占的字节数
+    std::vector<char> states_;           // 每个页面的ZoneState
+    std::vector<char> bounds_;           // 每个页面所有字段的最小值和最大值
+};
@@ -49,12 +49,14 @@ lsn_t LogManager::add_log_to_buffer(LogRecord* log_record) {
 void LogManager::flush_log_to_disk() {
     std::unique_lock<std::mutex> latch(latch_);
     if(log_buffer_.offset_==0) {
+        // 缓冲区为空时已分配的日志都已经持久化
+        flushed_lsn_ = global_lsn_.load();
         return;
     }
     // 将日志缓冲区中的内容写入磁盘中
     disk_manager_->write_log(log_buffer_.buffer_, log_buffer_.offset_);
     // 更新 flushed_lsn_
-    flushed_lsn_ = global_lsn_;
+    flushed_lsn_ = global_lsn_.load();
     // 重置日志缓冲区
     log_buffer_.offset_ = 0;
     memset(log_buffer_.buffer_, 0, sizeof(log_buffer_.buffer_));
@@ -173,6 +175,13 @@ std::list<std::unique_ptr<LogRecord>> LogManager::get_records() {
                     records.emplace_back(std::make_unique<CkptEndLogRecord>(record));
                     break;
                 }
+                case BULK_LOAD:{
+                    BulkLoadLogRecord record(log_buffer_.buffer_+current_offset);
+                    record.format_print();
+                    current_offset += record.log_tot_len_;
+                    records.emplace_back(std::make_unique<BulkLoadLogRecord>(record));
+                    break;
+                }
             }
         }
         current_offset_ = prev_offset_ + current_offset;
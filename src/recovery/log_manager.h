@@ -34,7 +34,8 @@ enum LogType: int {
     CKPT_BEGIN,
     CKPT_END, // fuzzy checkpoint end
     Mark_Delete,
-    CLR_MARK_DELETE
+    CLR_MARK_DELETE,
+    BULK_LOAD   // 批量导入追加的一段页面
 };
 static std::string LogTypeStr[] = {
     "UPDATE",
@@ -49,7 +50,8 @@ static std::string LogTypeStr[] = {
     "CKPT_BEGIN",
     "CKPT_END",
     "Mark Delete",
-    "CLR Mark Delete"
+    "CLR Mark Delete",
+    "Bulk Load"
 };
 enum LogOperation {
     REDO,
@@ -793,6 +795,105 @@ public:
         }
     }
 };
+/**
+ * 批量导入时追加到表文件末尾的一段页面。页面在日志写入之前已经持久化，日志中不包含页面的内容，
+ * 重做时只需要恢复文件头；回滚时把文件头恢复成追加之前的内容，追加的页面不再可见
+ */
+class BulkLoadLogRecord: public LogRecord {
+public:
+    BulkLoadLogRecord() {
+        log_type_ = LogType::BULK_LOAD;
+        lsn_ = INVALID_LSN;
+        log_tot_len_ = LOG_HEADER_SIZE;
+        log_tid_ = INVALID_TXN_ID;
+        prev_lsn_ = INVALID_LSN;
+        table_name_ = nullptr;
+    }
+    BulkLoadLogRecord(char *src) {
+        deserialize(src);
+    }
+    BulkLoadLogRecord(txn_id_t txn_id, const std::string& table_name, int first_page_no, int page_count, lsn_t prev_lsn,
+                      int prev_first_free_page_no, int first_free_page_no, int num_page)
+            : BulkLoadLogRecord() {
+        log_tid_ = txn_id;
+        prev_lsn_ = prev_lsn;
+        table_name_size_ = table_name.length();
+        table_name_ = new char[table_name_size_];
+        memcpy(table_name_, table_name.c_str(), table_name_size_);
+        log_tot_len_ += sizeof(size_t) + table_name_size_;
+        first_page_no_ = first_page_no;
+        log_tot_len_ += sizeof(first_page_no);
+        page_count_ = page_count;
+        log_tot_len_ += sizeof(page_count);
+        prev_first_free_page_no_ = prev_first_free_page_no;
+        log_tot_len_ += sizeof(prev_first_free_page_no);
+
+        first_free_page_no_ = first_free_page_no;
+        log_tot_len_+= sizeof(first_free_page_no);
+        num_pages_ = num_page;
+        log_tot_len_ += sizeof(num_page);
+    }
+    // 把bulk load日志记录序列化到dest中
+    void serialize(char* dest) const override {
+        LogRecord::serialize(dest);
+        int offset = OFFSET_LOG_DATA;
+        memcpy(dest + offset, &table_name_size_, sizeof(size_t));
+        offset += sizeof(size_t);
+        memcpy(dest + offset, table_name_, table_name_size_);
+        offset += table_name_size_;
+        memcpy(dest + offset, &first_page_no_, sizeof(int));
+        offset += sizeof(int);
+        memcpy(dest + offset, &page_count_, sizeof(int));
+        offset += sizeof(int);
+        memcpy(dest + offset, &prev_first_free_page_no_, sizeof(int));
+        offset += sizeof(int);
+        memcpy(dest + offset, &first_free_page_no_, sizeof(int));
+        offset += sizeof(int);
+        memcpy(dest + offset, &num_pages_, sizeof(int));
+    }
+    // 从src中反序列化出一条bulk load日志记录
+    void deserialize(const char* src) override {
+        LogRecord::deserialize(src);
+        int offset = OFFSET_LOG_DATA;
+        table_name_size_ = *reinterpret_cast<const size_t*>(src + offset);
+        offset += sizeof(size_t);
+        table_name_ = new char[table_name_size_];
+        memcpy(table_name_, src + offset, table_name_size_);
+        offset += table_name_size_;
+        first_page_no_ = *reinterpret_cast<const int*>(src + offset);
+        offset += sizeof(int);
+        page_count_ = *reinterpret_cast<const int*>(src + offset);
+        offset += sizeof(int);
+        prev_first_free_page_no_ = *reinterpret_cast<const int*>(src + offset);
+        offset += sizeof(int);
+        first_free_page_no_ = *reinterpret_cast<const int*>(src + offset);
+        offset += sizeof(int);
+        num_pages_ = *reinterpret_cast<const int*>(src + offset);
+    }
+    void format_print() override {
+        if(ARIES_DEBUG_MODE) {
+            LogRecord::format_print();
+            LOG_DEBUG("%s", fmt::format("table name: {}\n"
+                                        "pages: {} +{}\n"
+                                        "prev_first_free_page: {}\n"
+                                        "first_free_page: {}\n"
+                                        "num_pages:{}", std::string(table_name_, table_name_size_), first_page_no_, page_count_,
+                                        prev_first_free_page_no_, first_free_page_no_, num_pages_).c_str());
+        }
+    }
+
+    char* table_name_;          // 导入记录的表名称
+    size_t table_name_size_;    // 表名称的大小
+    int first_page_no_;         // 追加的第一个页面
+    int page_count_;            // 追加的页面个数
+    int prev_first_free_page_no_;   // 追加页面之前的first_free_page_no，回滚时与first_page_no_一起恢复文件头
+
+    /**
+     * 追加页面之后file_hdr的内容
+     */
+    int first_free_page_no_;
+    int num_pages_;
+};
 /* 日志缓冲区，只有一个buffer，因此需要阻塞地去把日志写入缓冲区中 */
 
 class LogBuffer {
@@ -829,9 +930,27 @@ public:
         global_lsn_ = lsn;
     }
     std::list<std::unique_ptr<LogRecord>> get_records();
+    /**
+     * @description: 在脏页表中记录page的rec lsn，若page已在脏页表中则保留原有的rec lsn
+     * @param {PageId&} page_id 变脏的页面
+     * @param {lsn_t} rec_lsn 第一个使该页面变脏的日志的lsn
+     */
+    void add_dirty_page(const PageId& page_id, lsn_t rec_lsn) {
+        std::scoped_lock lock(dpt_latch_);
+        dirty_page_table_.emplace(page_id, rec_lsn);
+    }
+    /**
+     * @description: 页面刷盘后将其移出脏页表，buffer pool的各个分片会并发调用
+     * @param {PageId&} page_id 已经写回磁盘的页面
+     */
+    void remove_dirty_page(const PageId& page_id) {
+        std::scoped_lock lock(dpt_latch_);
+        dirty_page_table_.erase(page_id);
+    }
 private:    
     std::atomic<lsn_t> global_lsn_{0};  // 全局lsn，递增，用于为每条记录分发lsn
     std::mutex latch_;                  // 用于对log_buffer_的互斥访问
+    std::mutex dpt_latch_;              // 用于对dirty_page_table_的互斥访问
     LogBuffer log_buffer_;              // 日志缓冲区
     DiskManager* disk_manager_;
     int current_offset_; // 当前在log文件中的偏移量
@@ -839,5 +958,5 @@ private:
 public:
     dirty_page_table_t dirty_page_table_;
     active_txn_table_t active_txn_table_;
-    lsn_t flushed_lsn_;                 // 记录已经持久化到磁盘中的最后一条日志的日志号
+    std::atomic<lsn_t> flushed_lsn_{INVALID_LSN};    // 记录已经持久化到磁盘中的最后一条日志的日志号
 };
@@ -152,6 +152,18 @@ void RecoveryManager::analyze() {
                 log_manager_->active_txn_table_[txn_id] = lsn;  // 更新该事务的last lsn
                 break;
             }
+            case BULK_LOAD: {
+                // 导入的页面已经持久化，只有文件头可能没有写回，用文件头页面的reclsn保证redo从这里开始
+                auto bulk_record = dynamic_cast<BulkLoadLogRecord *>(log_record->get());
+                std::string table_name(bulk_record->table_name_, bulk_record->table_name_size_);
+                auto table = sm_manager_->fhs_[table_name].get();
+                auto page_id = PageId{.fd = table->GetFd(), .page_no = RM_FILE_HDR_PAGE};
+                if ( log_manager_->dirty_page_table_.find(page_id) ==  log_manager_->dirty_page_table_.end()) {
+                    log_manager_->dirty_page_table_[page_id] = lsn;
+                }
+                log_manager_->active_txn_table_[txn_id] = lsn;  // 更新该事务的last lsn
+                break;
+            }
         }
     }
     log_manager_->set_global_lsn(idx-log_offset_); // 设置global lsn
@@ -341,6 +353,13 @@ void RecoveryManager::redo() {
                 buffer_pool_manager_->unpin_page(page_id, true);
                 break;
             }
+            case BULK_LOAD: {
+                auto bulk_log = dynamic_cast<BulkLoadLogRecord*>(log);
+                std::string table_name(bulk_log->table_name_, bulk_log->table_name_size_);
+                auto fh = sm_manager_->fhs_.at(table_name).get();
+                fh->bulk_load_recover(bulk_log->first_free_page_no_, bulk_log->num_pages_);
+                break;
+            }
 //            case CKPT_BEGIN:
 //                break;
 //            case CKPT_END:
@@ -457,6 +476,16 @@ void RecoveryManager::undo() {
                 undo_list.emplace(clr_log->undo_next_, context);
                 break;
             }
+            case BULK_LOAD: {
+                // 导入期间持有表上的排他锁，之后没有其他事务修改过追加的页面，直接恢复文件头
+                auto bulk_log = dynamic_cast<BulkLoadLogRecord *>(log);
+                std::string table_name(bulk_log->table_name_, bulk_log->table_name_size_);
+                auto fh = sm_manager_->fhs_.at(table_name).get();
+                fh->bulk_load_undo(bulk_log->prev_first_free_page_no_, bulk_log->first_page_no_);
+                undo_list.pop();
+                undo_list.emplace(log->prev_lsn_, context);
+                break;
+            }
             case BEGIN: {
                 delete context;
                 undo_list.pop();
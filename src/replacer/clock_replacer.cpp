@@ -0,0 +1,100 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "clock_replacer.h"
+
+ClockReplacer::ClockReplacer(size_t num_pages)
+    : max_size_(num_pages), states_(new std::atomic<uint8_t>[num_pages]) {
+    for (size_t i = 0; i < max_size_; ++i) {
+        states_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+ClockReplacer::~ClockReplacer() = default;
+
+/**
+ * @description: 使用CLOCK策略选择一个victim frame，并返回该frame的id
+ * @param {frame_id_t*} frame_id 被移除的frame的id
+ * @return {bool} 如果成功淘汰了一个页面则返回true，否则返回false
+ */
+bool ClockReplacer::victim(frame_id_t* frame_id) {
+    if (size_.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    // 第一圈清除引用位，第二圈一定能找到一个可淘汰的frame；
+    // 由于并发的pin可能使frame变为不可淘汰，这里多扫一圈后放弃
+    for (size_t step = 0; step < 3 * max_size_; ++step) {
+        size_t pos = hand_.fetch_add(1, std::memory_order_relaxed) % max_size_;
+        auto &state = states_[pos];
+        uint8_t cur = state.load(std::memory_order_acquire);
+        if (!(cur & EVICTABLE)) {
+            continue;
+        }
+        if (cur & REFERENCED) {
+            // 给第二次机会，清除引用位
+            state.compare_exchange_strong(cur, cur & ~REFERENCED, std::memory_order_acq_rel);
+            continue;
+        }
+        // 引用位为0，尝试占有该frame；失败说明期间被pin/unpin过，继续扫描
+        if (state.compare_exchange_strong(cur, 0, std::memory_order_acq_rel)) {
+            size_.fetch_sub(1, std::memory_order_acq_rel);
+            *frame_id = static_cast<frame_id_t>(pos);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @description: 固定指定的frame，即该页面无法被淘汰
+ * @param {frame_id_t} 需要固定的frame的id
+ */
+void ClockReplacer::pin(frame_id_t frame_id) {
+    uint8_t prev = states_[frame_id].exchange(0, std::memory_order_acq_rel);
+    if (prev & EVICTABLE) {
+        size_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+/**
+ * @description: 取消固定一个frame，代表该页面可以被淘汰，同时设置引用位
+ * @param {frame_id_t} frame_id 取消固定的frame的id
+ */
+void ClockReplacer::unpin(frame_id_t frame_id) {
+    uint8_t prev = states_[frame_id].fetch_or(EVICTABLE | REFERENCED, std::memory_order_acq_rel);
+    if (!(prev & EVICTABLE)) {
+        size_.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+/**
+ * @description: 从时钟指针处开始收集即将被淘汰的frame，不移动指针也不修改引用位。
+ *               引用位为0的frame会先被淘汰，因此先收集它们，不够时再收集引用位为1的frame
+ * @param {vector<frame_id_t>*} frames 存放收集到的frame
+ * @param {size_t} max_count 最多收集的frame个数
+ */
+void ClockReplacer::get_victim_candidates(std::vector<frame_id_t>* frames, size_t max_count) {
+    size_t start = hand_.load(std::memory_order_relaxed);
+    for (uint8_t wanted : {EVICTABLE, static_cast<uint8_t>(EVICTABLE | REFERENCED)}) {
+        for (size_t step = 0; step < max_size_ && frames->size() < max_count; ++step) {
+            size_t pos = (start + step) % max_size_;
+            if (states_[pos].load(std::memory_order_relaxed) == wanted) {
+                frames->emplace_back(static_cast<frame_id_t>(pos));
+            }
+        }
+    }
+}
+
+/**
+ * @description: 获取当前replacer中可以被淘汰的页面数量
+ */
+size_t ClockReplacer::Size() {
+    return size_.load(std::memory_order_acquire);
+}
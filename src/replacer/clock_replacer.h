@@ -0,0 +1,52 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "common/config.h"
+#include "replacer/replacer.h"
+
+/*
+ClockReplacer实现了CLOCK(second chance)替换策略
+每个frame的状态保存在一个原子字节中，时钟指针也是原子变量，pin/unpin/victim都不需要加锁，也不会申请内存
+*/
+class ClockReplacer : public Replacer {
+   public:
+    /**
+     * @description: 创建一个新的ClockReplacer
+     * @param {size_t} num_pages ClockReplacer最多需要存储的page数量
+     */
+    explicit ClockReplacer(size_t num_pages);
+
+    ~ClockReplacer();
+
+    bool victim(frame_id_t *frame_id);
+
+    void pin(frame_id_t frame_id);
+
+    void unpin(frame_id_t frame_id);
+
+    void get_victim_candidates(std::vector<frame_id_t> *frames, size_t max_count);
+
+    size_t Size();
+
+   private:
+    static constexpr uint8_t EVICTABLE = 0x1;   // frame可以被淘汰
+    static constexpr uint8_t REFERENCED = 0x2;  // 引用位，时钟指针扫过时先清除，再次扫到才淘汰
+
+    size_t max_size_;                               // 最大容量（与缓冲池的容量相同）
+    std::unique_ptr<std::atomic<uint8_t>[]> states_; // 每个frame的EVICTABLE/REFERENCED位
+    std::atomic<size_t> hand_{0};                   // 时钟指针，取模后得到当前扫描的frame
+    std::atomic<size_t> size_{0};                   // 可以被淘汰的frame个数
+};
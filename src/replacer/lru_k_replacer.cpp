@@ -0,0 +1,133 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "lru_k_replacer.h"
+
+LRUKReplacer::LRUKReplacer(size_t num_pages, size_t k, size_t correlated_period)
+    : max_size_(num_pages),
+      k_(k),
+      correlated_period_(correlated_period),
+      history_(num_pages * k, 0),
+      num_refs_(num_pages, 0),
+      last_access_(num_pages, 0),
+      evictable_(num_pages, false) {}
+
+LRUKReplacer::~LRUKReplacer() = default;
+
+LRUKReplacer::Entry LRUKReplacer::get_entry(frame_id_t frame_id) const {
+    if (num_refs_[frame_id] < k_) {
+        return {last_access_[frame_id], frame_id};
+    }
+    return {history_[frame_id * k_ + k_ - 1], frame_id};
+}
+
+void LRUKReplacer::reset_history(frame_id_t frame_id) {
+    num_refs_[frame_id] = 0;
+    last_access_[frame_id] = 0;
+    evictable_[frame_id] = false;
+}
+
+/**
+ * @description: 使用LRU-K策略删除一个victim frame，并返回该frame的id
+ * @param {frame_id_t*} frame_id 被移除的frame的id
+ * @return {bool} 如果成功淘汰了一个页面则返回true，否则返回false
+ */
+bool LRUKReplacer::victim(frame_id_t* frame_id) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    // 优先淘汰访问不足K次的frame
+    std::set<Entry>* list = !history_list_.empty() ? &history_list_ : &cache_list_;
+    if (list->empty()) {
+        return false;
+    }
+    auto victim_frame_id = list->begin()->second;
+    list->erase(list->begin());
+    // 帧上将换入新的页面，历史访问记录不再有意义
+    reset_history(victim_frame_id);
+    *frame_id = victim_frame_id;
+    return true;
+}
+
+/**
+ * @description: 固定指定的frame并记录一次访问
+ * @param {frame_id_t} 需要固定的frame的id
+ */
+void LRUKReplacer::pin(frame_id_t frame_id) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    if (evictable_[frame_id]) {
+        auto& list = num_refs_[frame_id] < k_ ? history_list_ : cache_list_;
+        list.erase(get_entry(frame_id));
+        evictable_[frame_id] = false;
+    }
+    size_t now = ++current_tick_;
+    size_t* history = &history_[frame_id * k_];
+    if (num_refs_[frame_id] == 0 || now - last_access_[frame_id] > correlated_period_) {
+        // 非相关访问，加入访问历史
+        for (size_t i = std::min(num_refs_[frame_id], k_ - 1); i > 0; --i) {
+            history[i] = history[i - 1];
+        }
+        history[0] = now;
+        num_refs_[frame_id] = std::min(num_refs_[frame_id] + 1, k_);
+    }
+    last_access_[frame_id] = now;
+}
+
+/**
+ * @description: 取消固定一个frame，代表该页面可以被淘汰
+ * @param {frame_id_t} frame_id 取消固定的frame的id
+ */
+void LRUKReplacer::unpin(frame_id_t frame_id) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    if (evictable_[frame_id]) {
+        return;
+    }
+    if (num_refs_[frame_id] == 0) {
+        // 没有通过pin访问过的frame，视为刚刚访问过一次
+        history_[frame_id * k_] = last_access_[frame_id] = ++current_tick_;
+        num_refs_[frame_id] = 1;
+    }
+    evictable_[frame_id] = true;
+    auto& list = num_refs_[frame_id] < k_ ? history_list_ : cache_list_;
+    list.insert(get_entry(frame_id));
+}
+
+/**
+ * @description: 将frame移出replacer并清除其访问历史
+ * @param {frame_id_t} frame_id 需要移除的frame的id
+ */
+void LRUKReplacer::remove(frame_id_t frame_id) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    if (evictable_[frame_id]) {
+        auto& list = num_refs_[frame_id] < k_ ? history_list_ : cache_list_;
+        list.erase(get_entry(frame_id));
+    }
+    reset_history(frame_id);
+}
+
+/**
+ * @description: 按照淘汰顺序收集即将被淘汰的frame，不会将它们移出replacer
+ * @param {vector<frame_id_t>*} frames 存放收集到的frame
+ * @param {size_t} max_count 最多收集的frame个数
+ */
+void LRUKReplacer::get_victim_candidates(std::vector<frame_id_t>* frames, size_t max_count) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    for (auto* list : {&history_list_, &cache_list_}) {
+        for (auto it = list->begin(); it != list->end() && frames->size() < max_count; ++it) {
+            frames->emplace_back(it->second);
+        }
+    }
+}
+
+/**
+ * @description: 获取当前replacer中可以被淘汰的页面数量
+ */
+size_t LRUKReplacer::Size() {
+    std::scoped_lock<std::mutex> lock(latch_);
+    return history_list_.size() + cache_list_.size();
+}
@@ -0,0 +1,75 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+#include "replacer/replacer.h"
+
+/*
+LRUKReplacer实现了LRU-K替换策略
+buffer pool每次访问frame都会调用pin，因此pin同时记录一次访问。
+访问次数不足K次的frame的backward K-distance为无穷大，优先被淘汰（它们之间按最近一次访问的LRU顺序），
+其余frame按第K近的一次访问时间淘汰，这样只被顺序扫描访问过一次的页面会先于反复访问的热点页面被淘汰。
+距离上一次访问不超过correlated_period个时钟的访问视为相关访问(例如扫描对同一页面的逐条读取)，不计入访问历史。
+*/
+class LRUKReplacer : public Replacer {
+   public:
+    /**
+     * @description: 创建一个新的LRUKReplacer
+     * @param {size_t} num_pages LRUKReplacer最多需要存储的page数量
+     * @param {size_t} k 计算backward K-distance时使用的K
+     * @param {size_t} correlated_period 相关访问的时间窗口，以逻辑时钟计
+     */
+    explicit LRUKReplacer(size_t num_pages, size_t k = LRUK_REPLACER_K,
+                          size_t correlated_period = LRUK_CORRELATED_PERIOD);
+
+    ~LRUKReplacer();
+
+    bool victim(frame_id_t *frame_id);
+
+    void pin(frame_id_t frame_id);
+
+    void unpin(frame_id_t frame_id);
+
+    void remove(frame_id_t frame_id);
+
+    void get_victim_candidates(std::vector<frame_id_t> *frames, size_t max_count);
+
+    size_t Size();
+
+   private:
+    using Entry = std::pair<size_t, frame_id_t>;  // <排序用的时间戳, frame id>
+
+    // 获取frame在淘汰队列中的排序键，访问不足K次时为最近一次访问时间，否则为第K近的访问时间
+    Entry get_entry(frame_id_t frame_id) const;
+
+    void reset_history(frame_id_t frame_id);
+
+    std::mutex latch_;                  // 互斥锁
+    size_t max_size_;                   // 最大容量（与缓冲池的容量相同）
+    size_t k_;
+    size_t correlated_period_;
+    size_t current_tick_{0};            // 逻辑时钟，每次访问加一
+
+    std::vector<size_t> history_;       // 每个frame最近K次非相关访问的时间，history_[frame * k_]为最近一次
+    std::vector<size_t> num_refs_;      // 每个frame记录的访问次数，最多为K
+    std::vector<size_t> last_access_;   // 每个frame最近一次访问(包括相关访问)的时间
+    std::vector<bool> evictable_;       // frame是否可以被淘汰
+
+    std::set<Entry> history_list_;      // 访问不足K次的可淘汰frame
+    std::set<Entry> cache_list_;        // 访问达到K次的可淘汰frame
+};
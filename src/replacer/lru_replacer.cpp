@@ -73,6 +73,18 @@ void LRUReplacer::unpin(frame_id_t frame_id) {
     // CHECK(AntiO2) 考虑用满报错的情况？
 }
 
+/**
+ * @description: 按照淘汰顺序收集即将被淘汰的frame，不会将它们移出replacer
+ * @param {vector<frame_id_t>*} frames 存放收集到的frame
+ * @param {size_t} max_count 最多收集的frame个数
+ */
+void LRUReplacer::get_victim_candidates(std::vector<frame_id_t>* frames, size_t max_count) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    for (auto it = LRUlist_.rbegin(); it != LRUlist_.rend() && frames->size() < max_count; ++it) {
+        frames->emplace_back(*it);
+    }
+}
+
 /**
  * @description: 获取当前replacer中可以被淘汰的页面数量
  */
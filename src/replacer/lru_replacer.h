@@ -38,6 +38,8 @@ class LRUReplacer : public Replacer {
 
     void unpin(frame_id_t frame_id);
 
+    void get_victim_candidates(std::vector<frame_id_t> *frames, size_t max_count);
+
     size_t Size();
 
    private:
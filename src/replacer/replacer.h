@@ -10,6 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <vector>
+
 #include "common/config.h"
 
 /**
@@ -39,6 +41,21 @@ class Replacer {
      */
     virtual void unpin(frame_id_t frame_id) = 0;
 
+    /**
+     * Forgets a frame entirely, e.g. when its page is deleted and the frame goes back to the free list.
+     * The frame must not be victimized afterwards and any access history kept for it is dropped.
+     * @param frame_id the id of the frame to remove
+     */
+    virtual void remove(frame_id_t frame_id) { pin(frame_id); }
+
+    /**
+     * Collects the frames that would be victimized next, in eviction order, without removing them.
+     * The background writer uses this to clean dirty pages before eviction reaches them.
+     * @param[out] frames receives at most max_count frame ids
+     * @param max_count the maximum number of frames to collect
+     */
+    virtual void get_victim_candidates(std::vector<frame_id_t> *frames, size_t max_count) = 0;
+
     /** @return the number of elements in the replacer that can be victimized */
     virtual size_t Size() = 0;
 };
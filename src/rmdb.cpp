@@ -257,17 +257,91 @@ void start_server() {
     int ret = shutdown(sockfd_server, SHUT_WR);  // shut down the all or part of a full-duplex connection.
     if(ret == -1) { printf("%s\n", strerror(errno)); }
 //    assert(ret != -1);
+    // 后台写线程不能再访问即将关闭的文件
+    buffer_pool_manager->stop_background_writer();
     sm_manager->close_db();
     std::cout << " DB has been closed.\n";
     std::cout << "Server shuts down." << std::endl;
 }
 
+/**
+ * @description: 解析buffer pool的大小，带K/M/G后缀时表示字节数，否则表示页面个数
+ * @return {size_t} buffer pool的页面个数，格式错误时返回0
+ * @param {char*} arg 命令行参数，例如 "65536"、"256M"、"2G"
+ */
+static size_t parse_buffer_pool_size(const char *arg) {
+    char *end = nullptr;
+    errno = 0;
+    unsigned long long value = strtoull(arg, &end, 10);
+    if (errno != 0 || end == arg || arg[0] == '-') {
+        return 0;
+    }
+    size_t unit = 0;
+    switch (toupper(static_cast<unsigned char>(*end))) {
+        case '\0': return static_cast<size_t>(value);
+        case 'K': unit = 1ULL << 10; break;
+        case 'M': unit = 1ULL << 20; break;
+        case 'G': unit = 1ULL << 30; break;
+        default: return 0;
+    }
+    // 允许 256M 或 256MB 两种写法
+    if (end[1] != '\0' && !(toupper(static_cast<unsigned char>(end[1])) == 'B' && end[2] == '\0')) {
+        return 0;
+    }
+    return static_cast<size_t>(value * unit / PAGE_SIZE);
+}
+
+/**
+ * @description: 解析新建数据库的页面大小，可以写字节数或者带K后缀
+ * @return {int} 页面大小，格式错误或者不是合法的页面大小时返回0
+ * @param {char*} arg 命令行参数，例如 "16384"、"16K"
+ */
+static int parse_page_size(const char *arg) {
+    char *end = nullptr;
+    errno = 0;
+    unsigned long long value = strtoull(arg, &end, 10);
+    if (errno != 0 || end == arg || arg[0] == '-') {
+        return 0;
+    }
+    if (toupper(static_cast<unsigned char>(*end)) == 'K') {
+        value <<= 10;
+        end += toupper(static_cast<unsigned char>(end[1])) == 'B' ? 2 : 1;
+    }
+    if (*end != '\0' || value > MAX_PAGE_SIZE || !BufferPoolManager::is_valid_page_size(static_cast<int>(value))) {
+        return 0;
+    }
+    return static_cast<int>(value);
+}
+
 int main(int argc, char **argv) {
-    if (argc != 2) {
+    size_t pool_size = BUFFER_POOL_SIZE;
+    int page_size = DEFAULT_PAGE_SIZE;
+    int opt;
+    while ((opt = getopt(argc, argv, "b:dp:")) != -1) {
+        if (opt == 'b' && (pool_size = parse_buffer_pool_size(optarg)) != 0) {
+            continue;
+        }
+        if (opt == 'p' && (page_size = parse_page_size(optarg)) != 0) {
+            // 只在新建数据库时生效，已有的数据库使用db.meta中记录的页面大小
+            continue;
+        }
+        if (opt == 'd') {
+            // 数据文件使用O_DIRECT，页面只缓存在buffer pool中，buffer pool可以占用大部分内存
+            disk_manager->set_direct_io(true);
+            continue;
+        }
+        optind = argc + 1;
+        break;
+    }
+    if (optind != argc - 1) {
         // 需要指定数据库名称
-        std::cerr << "Usage: " << argv[0] << " <database>" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " [-b <buffer pool size, pages or K/M/G bytes>] [-d (direct I/O)]"
+                  << " [-p <page size of a new database, 4K/8K/16K/32K>] <database>" << std::endl;
         exit(1);
     }
+    if (pool_size != buffer_pool_manager->get_pool_size()) {
+        buffer_pool_manager->resize(pool_size);
+    }
     signal(SIGINT, sigint_handler);
     try {
         std::cout << "\n"
@@ -282,10 +356,10 @@ int main(int argc, char **argv) {
                      "Type 'help;' for help.\n"
                      "\n";
         // Database name is passed by args
-        std::string db_name = argv[1];
+        std::string db_name = argv[optind];
         if (!sm_manager->is_dir(db_name)) {
             // Database not found, create a new one
-            sm_manager->create_db(db_name);
+            sm_manager->create_db(db_name, page_size);
         }
         // Open database
         sm_manager->open_db(db_name);
@@ -295,6 +369,7 @@ int main(int argc, char **argv) {
         recovery->redo();
         recovery->undo();
         recovery->rebuild();
+        buffer_pool_manager->start_background_writer();
 
         // 开启服务端，开始接受客户端连接
         start_server();
@@ -0,0 +1,65 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "common/config.h"
+#include "storage/page.h"
+
+/* 批量访问的类型，决定环形缓冲区的大小 */
+enum class BufferAccessType { BULKREAD, BULKWRITE };
+
+/**
+ * @description: 缓冲区访问策略。顺序扫描、load_csv、索引重建等批量操作持有一个策略，
+ * 它们缺页时优先复用自己环形缓冲区中已经用完的帧，而不是从replacer中淘汰其他查询的工作集。
+ * buffer pool的每个分片各有一个环，只在该分片的latch保护下访问，因此同一个策略可以跨线程传递。
+ */
+class BufferAccessStrategy {
+    friend class BufferPoolInstance;
+
+   public:
+    BufferAccessStrategy(BufferAccessType type, size_t num_instances) : type_(type) {
+        size_t ring_size = type == BufferAccessType::BULKREAD ? BULKREAD_RING_SIZE : BULKWRITE_RING_SIZE;
+        rings_.resize(num_instances);
+        for (auto &ring : rings_) {
+            ring.slots.resize(std::max<size_t>(1, ring_size / num_instances));
+        }
+    }
+
+    BufferAccessType get_type() const { return type_; }
+
+   private:
+    /* 环中的一个位置，记录该位置占用的帧以及装入该帧时的页面 */
+    struct Slot {
+        frame_id_t frame_id = INVALID_FRAME_ID;
+        PageId page_id;
+    };
+
+    struct Ring {
+        std::vector<Slot> slots;
+        size_t current = 0;
+    };
+
+    /**
+     * @description: 环前进一格，返回该分片环中当前的位置
+     * @param {size_t} instance_index 分片下标
+     */
+    Slot &next_slot(size_t instance_index) {
+        auto &ring = rings_[instance_index];
+        ring.current = (ring.current + 1) % ring.slots.size();
+        return ring.slots[ring.current];
+    }
+
+    BufferAccessType type_;
+    std::vector<Ring> rings_;
+};
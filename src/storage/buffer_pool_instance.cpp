@@ -0,0 +1,697 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "buffer_pool_instance.h"
+
+#include <algorithm>
+#include <cstring>
+
+/**
+ * @description: 根据REPLACER_TYPE创建置换策略，未知的类型使用LRU
+ * @param {size_t} num_pages 置换策略需要管理的帧数
+ */
+static Replacer *create_replacer(size_t num_pages) {
+    if (REPLACER_TYPE == "CLOCK") {
+        return new ClockReplacer(num_pages);
+    } else if (REPLACER_TYPE == "LRUK") {
+        return new LRUKReplacer(num_pages);
+    }
+    return new LRUReplacer(num_pages);
+}
+
+BufferPoolInstance::BufferPoolInstance(size_t pool_size, size_t num_instances, size_t instance_index,
+                                       DiskManager *disk_manager, LogManager *log_manager)
+    : pool_size_(pool_size),
+      num_instances_(num_instances),
+      instance_index_(instance_index),
+      page_table_(pool_size),
+      disk_manager_(disk_manager),
+      log_manager_(log_manager) {
+    // 为分片分配一块连续的内存空间
+    grow_frames(pool_size_);
+    replacer_ = create_replacer(pool_size_);
+    // 初始化时，所有的page都在free_list_中
+    for (size_t i = 0; i < pool_size_; ++i) {
+        free_list_.emplace_back(static_cast<frame_id_t>(i));  // static_cast转换数据类型
+    }
+}
+
+BufferPoolInstance::~BufferPoolInstance() {
+    delete replacer_;
+}
+
+/**
+ * @description: 在frames_的末尾追加一块新的帧
+ * @param {size_t} num_frames 新申请的帧数
+ */
+void BufferPoolInstance::grow_frames(size_t num_frames) {
+    if (num_frames == 0) {
+        return;
+    }
+    FrameChunk chunk{frames_.size(), std::unique_ptr<Page[]>(new Page[num_frames]), FrameArena(num_frames)};
+    for (size_t i = 0; i < num_frames; ++i) {
+        chunk.pages[i].data_ = chunk.arena.get_frame(i);
+        frames_.emplace_back(&chunk.pages[i]);
+    }
+    chunks_.emplace_back(std::move(chunk));
+    fd_links_.resize(frames_.size());
+}
+
+/**
+ * @description: 把帧加入其页面所属文件的驻留帧链表，临时页不属于任何文件
+ * @param {frame_id_t} frame_id 帧号，帧中的页面id已经设置好
+ */
+void BufferPoolInstance::link_frame(frame_id_t frame_id) {
+    int fd = frames_[frame_id]->get_page_id().fd;
+    auto &link = fd_links_[frame_id];
+    if (link.linked || fd == TMP_FD) {
+        return;
+    }
+    auto it = fd_heads_.find(fd);
+    link.prev = INVALID_FRAME_ID;
+    link.next = it == fd_heads_.end() ? INVALID_FRAME_ID : it->second;
+    link.linked = true;
+    if (link.next != INVALID_FRAME_ID) {
+        fd_links_[link.next].prev = frame_id;
+    }
+    fd_heads_[fd] = frame_id;
+}
+
+/**
+ * @description: 把帧从其页面所属文件的驻留帧链表中移除，必须在修改帧中的页面id之前调用
+ * @param {frame_id_t} frame_id 帧号
+ */
+void BufferPoolInstance::unlink_frame(frame_id_t frame_id) {
+    auto &link = fd_links_[frame_id];
+    if (!link.linked) {
+        return;
+    }
+    int fd = frames_[frame_id]->get_page_id().fd;
+    if (link.prev != INVALID_FRAME_ID) {
+        fd_links_[link.prev].next = link.next;
+    } else if (link.next != INVALID_FRAME_ID) {
+        fd_heads_[fd] = link.next;
+    } else {
+        fd_heads_.erase(fd);
+    }
+    if (link.next != INVALID_FRAME_ID) {
+        fd_links_[link.next].prev = link.prev;
+    }
+    link = FrameLink{};
+}
+
+/**
+ * @description: 帧数改变后，按照当前的帧重建页表和置换策略。
+ *               置换策略中的访问历史不会保留，所有未被固定的页面重新以相同的优先级进入置换策略
+ */
+void BufferPoolInstance::rebuild_index() {
+    std::vector<bool> is_free(pool_size_, false);
+    for (auto frame_id : free_list_) {
+        is_free[frame_id] = true;
+    }
+    page_table_.reset(pool_size_);
+    fd_heads_.clear();
+    fd_links_.assign(frames_.size(), FrameLink{});
+    delete replacer_;
+    replacer_ = create_replacer(pool_size_);
+    for (size_t i = 0; i < pool_size_; ++i) {
+        Page *page = frames_[i];
+        // 空闲帧中可能残留着已经释放的临时页，不再放回页表
+        if (is_free[i] || page->get_page_id().page_no == INVALID_PAGE_ID) {
+            continue;
+        }
+        auto frame_id = static_cast<frame_id_t>(i);
+        page_table_.insert(page->get_page_id(), frame_id);
+        link_frame(frame_id);
+        if (page->pin_count_ == 0) {
+            replacer_->unpin(frame_id);
+        }
+    }
+}
+
+/**
+ * @description: 在线调整分片的帧数，整个过程持有分片的latch
+ * @return {bool} 调整成功返回true，缩容时被移除的帧中有页面被固定则返回false
+ * @param {size_t} new_pool_size 新的帧数
+ */
+bool BufferPoolInstance::resize(size_t new_pool_size) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    new_pool_size = std::max<size_t>(1, new_pool_size);
+    if (new_pool_size == pool_size_) {
+        return true;
+    }
+    if (new_pool_size > pool_size_) {
+        // 先复用缩容时没有释放的帧，不够时再申请新的块
+        if (frames_.size() < new_pool_size) {
+            grow_frames(new_pool_size - frames_.size());
+        }
+        for (size_t i = pool_size_; i < new_pool_size; ++i) {
+            frames_[i]->pin_count_ = 0;
+            frames_[i]->is_dirty_ = false;
+            free_list_.emplace_back(static_cast<frame_id_t>(i));
+        }
+        pool_size_ = new_pool_size;
+        rebuild_index();
+        return true;
+    }
+
+    // 1 被移除的帧中有页面被固定时，调用者还持有Page*，不能缩容
+    for (size_t i = new_pool_size; i < pool_size_; ++i) {
+        if (frames_[i]->pin_count_ > 0) {
+            return false;
+        }
+    }
+    // 2 被移除的帧不能再从free_list_中分配出去
+    free_list_.remove_if([&](frame_id_t frame_id) { return static_cast<size_t>(frame_id) >= new_pool_size; });
+    // 3 被移除的帧中的页面优先迁移到保留区间的空闲帧中，没有空闲帧时写回磁盘后淘汰
+    for (size_t i = new_pool_size; i < pool_size_; ++i) {
+        Page *page = frames_[i];
+        PageId page_id = page->get_page_id();
+        frame_id_t frame_id;
+        bool resident = page_id.page_no != INVALID_PAGE_ID && page_id.fd != TMP_FD &&
+                        page_table_.find(page_id, &frame_id) && static_cast<size_t>(frame_id) == i;
+        if (resident && !free_list_.empty()) {
+            frame_id_t target_id = free_list_.front();
+            free_list_.pop_front();
+            Page *target = frames_[target_id];
+            unlink_frame(static_cast<frame_id_t>(i));
+            update_page(target, page_id, target_id);
+            memcpy(target->data_, page->data_, PAGE_SIZE);
+            target->is_dirty_ = page->is_dirty_;
+            page->is_dirty_ = false;
+        } else if (resident) {
+            update_page(page, PageId{page_id.fd, INVALID_PAGE_ID}, static_cast<frame_id_t>(i));
+        } else if (page_id.fd == TMP_FD) {
+            page_table_.erase(page_id);
+        }
+        page->id_.page_no = INVALID_PAGE_ID;
+    }
+    // 4 释放完全位于新帧数之后的块，跨越边界的块保留下来，扩容时优先复用，只归还其中被移除的帧的物理内存
+    while (!chunks_.empty() && chunks_.back().begin >= new_pool_size) {
+        frames_.resize(chunks_.back().begin);
+        chunks_.pop_back();
+    }
+    if (!chunks_.empty()) {
+        auto &chunk = chunks_.back();
+        chunk.arena.release(new_pool_size - chunk.begin, frames_.size() - chunk.begin);
+    }
+    pool_size_ = new_pool_size;
+    rebuild_index();
+    return true;
+}
+
+/**
+ * @description: 分片中没有任何页面，即所有帧都在free_list_中
+ */
+bool BufferPoolInstance::is_empty() {
+    std::scoped_lock<std::mutex> lock(latch_);
+    return free_list_.size() == pool_size_;
+}
+
+/**
+ * @description: 把replacer中即将被淘汰的脏页提前写回磁盘，页面仍然留在buffer pool中
+ * @return {size_t} 本次写回的页面数
+ * @param {size_t} lookahead 最多检查的淘汰候选帧数
+ */
+size_t BufferPoolInstance::clean_victim_candidates(size_t lookahead) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    candidates_.clear();
+    replacer_->get_victim_candidates(&candidates_, lookahead);
+    lsn_t flushed_lsn = log_manager_->flushed_lsn_;
+    std::vector<char *> pages;
+    std::vector<DiskManager::PageWrite> writes;
+    pages.reserve(candidates_.size());
+    auto it = std::remove_if(candidates_.begin(), candidates_.end(), [&](frame_id_t frame_id) {
+        Page *page = frames_[frame_id];
+        PageId page_id = page->get_page_id();
+        // 根据WAL规则，日志还没有刷盘的页面留给淘汰路径处理，后台写线程不触发日志刷盘
+        return !page->is_dirty() || page->pin_count_ > 0 || page_id.fd == TMP_FD ||
+               page_id.page_no == INVALID_PAGE_ID || page->get_page_lsn() > flushed_lsn;
+    });
+    candidates_.erase(it, candidates_.end());
+    if (candidates_.empty()) {
+        return 0;
+    }
+    // 候选页面分散在不同的位置，一起提交给IoEngine并发写入
+    for (auto frame_id : candidates_) {
+        Page *page = frames_[frame_id];
+        pages.emplace_back(page->get_data());
+        writes.push_back(DiskManager::PageWrite{page->get_page_id().fd, page->get_page_id().page_no, &pages.back(), 1});
+    }
+    write_epoch_++;
+    disk_manager_->write_pages_batch(writes);
+    for (auto frame_id : candidates_) {
+        Page *page = frames_[frame_id];
+        page->is_dirty_ = false;
+        log_manager_->remove_dirty_page(page->get_page_id());
+    }
+    return candidates_.size();
+}
+
+/**
+ * @description: 从free_list或replacer中得到可淘汰帧页的 *frame_id
+ * @return {bool} true: 可替换帧查找成功 , false: 可替换帧查找失败
+ * @param {frame_id_t*} frame_id 帧页id指针,返回成功找到的可替换帧id
+ *
+ */
+bool BufferPoolInstance::find_victim_page(frame_id_t* frame_id) {
+    // 1 使用free_list_判断分片是否已满需要淘汰页面
+    // 1.1 未满获得frame
+    // 1.2 已满使用replacer中的方法选择淘汰页面
+    bool find_victim{false};
+    if(free_list_.empty()) {
+    // 分片已满，需要从replacer中选择淘汰页面。
+    find_victim = replacer_->victim(frame_id);
+        if(find_victim) {
+            // 记录淘汰时遇到脏页的频率，后台写线程据此调整写回的速度
+            num_victims_.fetch_add(1, std::memory_order_relaxed);
+            if(frames_[*frame_id]->is_dirty()) {
+                num_dirty_victims_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    } else {
+        *frame_id = free_list_.front();
+        free_list_.pop_front();
+        find_victim = true;
+    }
+    return find_victim;
+}
+
+/**
+ * @description: 为批量操作获取一个帧。优先复用策略环中当前位置的帧，
+ *               只有该帧已被其他页面占用或仍被固定时，才从free_list或replacer中获取新的帧并放入环中
+ * @return {bool} true: 可替换帧查找成功 , false: 可替换帧查找失败
+ * @param {frame_id_t*} frame_id 帧页id指针,返回成功找到的可替换帧id
+ * @param {PageId} new_page_id 将要装入该帧的页面
+ * @param {BufferAccessStrategy*} strategy 访问策略，为nullptr时等价于find_victim_page(frame_id)
+ */
+bool BufferPoolInstance::find_victim_page(frame_id_t* frame_id, PageId new_page_id, BufferAccessStrategy* strategy) {
+    if(strategy == nullptr) {
+        return find_victim_page(frame_id);
+    }
+    auto& slot = strategy->next_slot(instance_index_);
+    // 分片缩容后，环中可能还记录着已经被移除的帧
+    if(slot.frame_id != INVALID_FRAME_ID && static_cast<size_t>(slot.frame_id) < pool_size_) {
+        auto page = frames_[slot.frame_id];
+        // 帧中仍是环上次装入的页面，并且已经没有人在使用，可以直接复用
+        if(page->pin_count_ == 0 && page->get_page_id() == slot.page_id) {
+            replacer_->remove(slot.frame_id);
+            *frame_id = slot.frame_id;
+            slot.page_id = new_page_id;
+            return true;
+        }
+    }
+    if(!find_victim_page(frame_id)) {
+        return false;
+    }
+    slot.frame_id = *frame_id;
+    slot.page_id = new_page_id;
+    return true;
+}
+
+/**
+ * @description: 更新页面数据, 如果为脏页则需写入磁盘，再更新为新页面，更新page元数据(data, is_dirty, page_id)和page table
+ * @param {Page*} page 写回页指针
+ * @param {PageId} new_page_id 新的page_id
+ * @param {frame_id_t} new_frame_id 新的帧frame_id
+ */
+void BufferPoolInstance::update_page(Page *page, PageId new_page_id, frame_id_t new_frame_id) {
+    // 1 如果是脏页，写回磁盘，并且把dirty置为false
+    // 2 更新page table
+    // 3 重置page的data，更新page id
+    // 根据WAL规则，刷盘前必须先写入LOG
+    if(page->get_page_lsn() > log_manager_->flushed_lsn_) {
+        LOG_DEBUG("Trigger WAL");
+        log_manager_->flush_log_to_disk();
+    }
+    // 首先检查该页上是否是有页面。
+    if(page->is_dirty()&&page->get_page_id().fd!=TMP_FD){
+        page->is_dirty_ = false;
+        write_epoch_++;
+        disk_manager_->write_page(page->get_page_id().fd, page->get_page_id().page_no, page->get_data(), PAGE_SIZE);
+        log_manager_->remove_dirty_page(page->get_page_id());
+    }
+    unlink_frame(new_frame_id);
+    page_table_.erase(page->get_page_id()); //update page table
+    if(new_page_id.page_no != INVALID_PAGE_ID) {
+        page_table_.insert(new_page_id, new_frame_id);
+        // 该页面正在被预读时，这里装入的副本之后可能被修改并写回，预读到的数据就过时了
+        if(!reading_pages_.empty()) {
+            reading_pages_.erase(new_page_id);
+        }
+    }
+    page->reset_memory();
+    page->id_ = new_page_id;
+    if(new_page_id.page_no != INVALID_PAGE_ID) {
+        link_frame(new_frame_id);
+    }
+}
+
+/**
+ * @description: 从分片获取需要的页。
+ *              如果页表中存在page_id（说明该page在缓冲池中），并且pin_count++。
+ *              如果页表不存在page_id（说明该page在磁盘中），则找缓冲池victim page，将其替换为磁盘中读取的page，pin_count置1。
+ * @return {Page*} 若获得了需要的页则将其返回，否则返回nullptr
+ * @param {PageId} page_id 需要获取的页的PageId
+ * @param {BufferAccessStrategy*} strategy 批量操作的访问策略，缺页时在其环形缓冲区中换页
+ */
+Page* BufferPoolInstance::fetch_page(PageId page_id, BufferAccessStrategy* strategy) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    frame_id_t frame_id;
+    if(!page_table_.find(page_id, &frame_id)) {
+        // not find
+        if(!find_victim_page(&frame_id, page_id, strategy)) {
+            return nullptr;
+        }
+        auto p  = frames_[frame_id];
+        update_page(p,page_id,frame_id); // 调用update_page将page写回到磁盘
+        disk_manager_->read_page(page_id.fd,page_id.page_no,p->get_data(),PAGE_SIZE); // 调用disk_manager_的read_page读取目标页到frame
+        p->pin_count_ = 1;
+        replacer_->pin(frame_id);
+        return p;
+    } else {
+        frames_[frame_id]->pin_count_++;
+        replacer_->pin(frame_id);
+        return frames_[frame_id];
+    }
+}
+
+/**
+ * @description: 取消固定pin_count>0的在缓冲池中的page
+ * @return {bool} 如果目标页的pin_count<=0则返回false，否则返回true
+ * @param {PageId} page_id 目标page的page_id
+ * @param {bool} is_dirty 若目标page应该被标记为dirty则为true，否则为false
+ */
+bool BufferPoolInstance::unpin_page(PageId page_id, bool is_dirty) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    frame_id_t frame_id;
+    if(!page_table_.find(page_id, &frame_id)) {
+        return false;
+    }
+    auto page = frames_[frame_id];
+    auto& pin_count = page->pin_count_;
+    if(pin_count <= 0) {
+        return false;
+    }
+    pin_count--;
+    if(pin_count==0) {
+        replacer_->unpin(frame_id);
+    }
+    page->is_dirty_|=is_dirty;
+    return true;
+}
+
+/**
+ * @description: 将目标页写回磁盘，不考虑当前页面是否正在被使用
+ * @return {bool} 成功则返回true，否则返回false(只有page_table_中没有目标页时)
+ * @param {PageId} page_id 目标页的page_id，不能为INVALID_PAGE_ID
+ */
+bool BufferPoolInstance::flush_page(PageId page_id) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    frame_id_t frame_id;
+    if(!page_table_.find(page_id, &frame_id)) {
+        return false;
+    }
+    // 无论P是否为脏都将其写回磁盘。
+    auto page = frames_[frame_id];
+    log_manager_->remove_dirty_page(page_id);
+    write_epoch_++;
+    disk_manager_->write_page(page->get_page_id().fd, page->get_page_id().page_no, page->get_data(), PAGE_SIZE);
+    page->is_dirty_ = false;
+    return true;
+}
+
+/**
+ * @description: 为一个新建的page申请帧
+ * @return {Page*} 返回新创建的page，若分片中没有可用的帧则返回nullptr
+ * @param {PageId} page_id 新page的page_id，page_no已经由disk_manager分配
+ * @param {BufferAccessStrategy*} strategy 批量操作的访问策略
+ */
+Page* BufferPoolInstance::new_page(PageId page_id, BufferAccessStrategy* strategy) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    // 1.   获得一个可用的frame，若无法获得则返回nullptr
+    frame_id_t frame_id;
+    if(!find_victim_page(&frame_id, page_id, strategy)) {
+        return nullptr;
+    }
+    auto page = frames_[frame_id];
+    // 2.   将frame的数据写回磁盘
+    update_page(page, page_id, frame_id);
+    // 3.   固定frame，更新pin_count_
+    page->pin_count_++;
+    replacer_->pin(frame_id);
+    // 页面在文件中已经预留(全0)，标记为脏页，被淘汰或者刷盘时再写回
+    page->is_dirty_ = true;
+    return page;
+}
+
+/**
+ * @description: 从分片删除目标页
+ * @return {bool} 如果目标页不存在于分片或者成功被删除则返回true，若其存在于分片但无法删除则返回false
+ * @param {PageId} page_id 目标页
+ */
+bool BufferPoolInstance::delete_page(PageId page_id) {
+    std::scoped_lock<std::mutex> lock(latch_);
+    frame_id_t frame_id;
+    if(!page_table_.find(page_id, &frame_id)) {
+        return true;
+    }
+    auto page = frames_[frame_id];
+    if(page->pin_count_>0) {
+        return false;
+    }
+    // 将目标页数据写回磁盘，从页表中删除目标页，重置其元数据，将其加入free_list_
+    auto new_page_id = page->get_page_id();
+    new_page_id.page_no=INVALID_PAGE_ID;
+    update_page(page,new_page_id,frame_id);
+    // 帧已经回到free_list_，不能再被replacer选为victim
+    replacer_->remove(frame_id);
+    free_list_.emplace_back(frame_id);
+    return true;
+}
+
+/**
+ * @description: 把frame_ids中的脏页写回磁盘。脏页按页号排序，页号连续的页面合并为一次pwritev
+ * @param {int} fd 文件句柄
+ * @param {vector<frame_id_t>&} frame_ids 属于fd的帧，函数中会被重新排序
+ */
+void BufferPoolInstance::flush_frames(int fd, std::vector<frame_id_t> &frame_ids) {
+    auto it = std::remove_if(frame_ids.begin(), frame_ids.end(),
+                             [&](frame_id_t frame_id) { return !frames_[frame_id]->is_dirty(); });
+    frame_ids.erase(it, frame_ids.end());
+    if (frame_ids.empty()) {
+        return;
+    }
+    std::sort(frame_ids.begin(), frame_ids.end(), [&](frame_id_t a, frame_id_t b) {
+        return frames_[a]->get_page_id().page_no < frames_[b]->get_page_id().page_no;
+    });
+    // 根据WAL规则，刷盘前必须先写入LOG
+    lsn_t max_lsn = INVALID_LSN;
+    for (auto frame_id : frame_ids) {
+        max_lsn = std::max(max_lsn, frames_[frame_id]->get_page_lsn());
+    }
+    if (max_lsn > log_manager_->flushed_lsn_) {
+        log_manager_->flush_log_to_disk();
+    }
+    write_epoch_++;
+    // 编号连续的页面合并为一段，所有段一起提交，由IoEngine并发写入
+    std::vector<char *> pages;
+    pages.reserve(frame_ids.size());
+    std::vector<DiskManager::PageWrite> writes;
+    size_t run_begin = 0;
+    for (size_t i = 0; i < frame_ids.size(); i++) {
+        Page *page = frames_[frame_ids[i]];
+        pages.emplace_back(page->get_data());
+        bool run_end = i + 1 == frame_ids.size() ||
+                       frames_[frame_ids[i + 1]]->get_page_id().page_no != page->get_page_id().page_no + 1;
+        if (run_end) {
+            writes.push_back(DiskManager::PageWrite{fd, frames_[frame_ids[run_begin]]->get_page_id().page_no,
+                                                    pages.data() + run_begin, static_cast<int>(i + 1 - run_begin)});
+            run_begin = i + 1;
+        }
+    }
+    disk_manager_->write_pages_batch(writes);
+    for (auto frame_id : frame_ids) {
+        Page *page = frames_[frame_id];
+        page->is_dirty_ = false;
+        log_manager_->remove_dirty_page(page->get_page_id());
+    }
+}
+
+/**
+ * @description: 将分片中属于fd的所有脏页写回到磁盘，只遍历该文件的驻留帧
+ * @param {int} fd 文件句柄
+ */
+void BufferPoolInstance::flush_all_pages(int fd) {
+    std::scoped_lock lock(latch_);
+    auto head = fd_heads_.find(fd);
+    if (head == fd_heads_.end()) {
+        return;
+    }
+    std::vector<frame_id_t> frame_ids;
+    for (frame_id_t frame_id = head->second; frame_id != INVALID_FRAME_ID; frame_id = fd_links_[frame_id].next) {
+        frame_ids.emplace_back(frame_id);
+    }
+    flush_frames(fd, frame_ids);
+}
+
+/**
+ * @description: 删除分片中属于fd的所有页，脏页先批量写回磁盘
+ * @param {int} fd 文件句柄
+ */
+void BufferPoolInstance::delete_all_pages(int fd) {
+    std::scoped_lock lock(latch_);
+    auto head = fd_heads_.find(fd);
+    if (head == fd_heads_.end()) {
+        return;
+    }
+    std::vector<frame_id_t> frame_ids;
+    for (frame_id_t frame_id = head->second; frame_id != INVALID_FRAME_ID; frame_id = fd_links_[frame_id].next) {
+        frame_ids.emplace_back(frame_id);
+    }
+    std::vector<frame_id_t> dirty_frame_ids = frame_ids;
+    flush_frames(fd, dirty_frame_ids);
+    for (auto frame_id : frame_ids) {
+        Page *page = frames_[frame_id];
+        auto new_page_id = page->get_page_id();
+        new_page_id.page_no=INVALID_PAGE_ID;
+        update_page(page,new_page_id,frame_id);
+        replacer_->remove(frame_id);
+        free_list_.emplace_back(frame_id);
+    }
+}
+
+/**
+ * @description: 按照从热到冷的顺序收集分片中驻留的页面：先是正在被固定的页面，再按淘汰顺序的逆序收集其余页面
+ * @param {vector<PageId>*} page_ids 存放收集到的页面
+ */
+void BufferPoolInstance::get_resident_pages(std::vector<PageId> *page_ids) {
+    std::scoped_lock lock(latch_);
+    for (size_t i = 0; i < pool_size_; i++) {
+        if (fd_links_[i].linked && frames_[i]->pin_count_ > 0) {
+            page_ids->emplace_back(frames_[i]->get_page_id());
+        }
+    }
+    candidates_.clear();
+    replacer_->get_victim_candidates(&candidates_, pool_size_);
+    for (auto it = candidates_.rbegin(); it != candidates_.rend(); ++it) {
+        if (fd_links_[*it].linked) {
+            page_ids->emplace_back(frames_[*it]->get_page_id());
+        }
+    }
+}
+
+/**
+ * @description: 把预读的页面装入一个空闲帧，不会淘汰其他页面。
+ *               页面已经在分片中，或者读取之后分片写过磁盘(读到的数据可能已经过时)时放弃装入
+ * @return {bool} 分片没有空闲帧时返回false，否则返回true
+ * @param {PageId} page_id 预读的页面
+ * @param {char*} data 页面数据
+ * @param {uint64_t} write_epoch 读取页面之前的write_epoch_
+ */
+bool BufferPoolInstance::install_page(PageId page_id, const char *data, uint64_t write_epoch) {
+    std::scoped_lock lock(latch_);
+    frame_id_t frame_id;
+    if (page_table_.find(page_id, &frame_id) || write_epoch != write_epoch_) {
+        return true;
+    }
+    if (free_list_.empty()) {
+        return false;
+    }
+    frame_id = free_list_.front();
+    free_list_.pop_front();
+    Page *page = frames_[frame_id];
+    update_page(page, page_id, frame_id);
+    memcpy(page->data_, data, PAGE_SIZE);
+    replacer_->unpin(frame_id);
+    return true;
+}
+
+/**
+ * @description: 为顺序预读预留一个帧，按照访问策略选择被淘汰的帧
+ * @return {Page*} 预留的帧，页面已经在分片中或者没有可用的帧时返回nullptr
+ * @param {PageId} page_id 将要读入的页面
+ * @param {BufferAccessStrategy*} strategy 批量操作的访问策略
+ * @param {frame_id_t*} frame_id 预留的帧号
+ */
+Page *BufferPoolInstance::reserve_read_ahead(PageId page_id, BufferAccessStrategy *strategy, frame_id_t *frame_id) {
+    std::scoped_lock lock(latch_);
+    if (page_table_.find(page_id, frame_id) || reading_pages_.count(page_id) > 0) {
+        return nullptr;
+    }
+    if (!find_victim_page(frame_id, page_id, strategy)) {
+        return nullptr;
+    }
+    Page *page = frames_[*frame_id];
+    // 帧先不进入页表，其他线程访问该页面时仍然自己从磁盘读取，并使这次预读作废
+    update_page(page, PageId{page_id.fd, INVALID_PAGE_ID}, *frame_id);
+    page->pin_count_ = 1;
+    reading_pages_.insert(page_id);
+    return page;
+}
+
+/**
+ * @description: 结束一个页面的预读，把读到的页面装入页表，或者归还预留的帧
+ * @param {PageId} page_id 预读的页面
+ * @param {frame_id_t} frame_id 预留的帧号
+ * @param {bool} success 是否完整地读到了页面
+ */
+void BufferPoolInstance::finish_read_ahead(PageId page_id, frame_id_t frame_id, bool success) {
+    std::scoped_lock lock(latch_);
+    Page *page = frames_[frame_id];
+    page->pin_count_ = 0;
+    if (reading_pages_.erase(page_id) == 0 || !success) {
+        free_list_.emplace_back(frame_id);
+        return;
+    }
+    page_table_.insert(page_id, frame_id);
+    page->id_ = page_id;
+    link_frame(frame_id);
+    replacer_->unpin(frame_id);
+}
+
+Page *BufferPoolInstance::new_tmp_page(PageId *page_id) {
+    assert(page_id->fd==TMP_FD);
+    std::scoped_lock<std::mutex> lock(latch_);
+    // 1.   获得一个可用的frame，若无法获得则返回nullptr
+    frame_id_t frame_id;
+    if(!find_victim_page(&frame_id)) {
+        return nullptr;
+    }
+    // 2.   由frame_id和分片下标编码出临时页的page_no
+    page_id->page_no = static_cast<page_id_t>(frame_id * num_instances_ + instance_index_);
+
+    auto page = frames_[frame_id];
+    // 3.   将frame的数据写回磁盘
+    update_page(page, *page_id,frame_id);
+    // 4.   固定frame，更新pin_count_
+    page->pin_count_++;
+    replacer_->pin(frame_id);
+    return page;
+}
+
+bool BufferPoolInstance::unpin_tmp_page(PageId page_id) {
+    std::scoped_lock<std::mutex> lock(latch_);
+
+    auto frame_id = static_cast<frame_id_t>(page_id.page_no / num_instances_);
+    auto page = frames_[frame_id];
+    assert(page->get_page_id().fd==TMP_FD);
+    auto& pin_count = page->pin_count_;
+    if(pin_count <= 0) {
+        return false;
+    }
+    pin_count--;
+    // 临时页不会再被访问，直接放回free_list_，不交给replacer
+    if(pin_count==0) {
+        replacer_->remove(frame_id);
+        free_list_.emplace_back(frame_id);
+    }
+    return true;
+}
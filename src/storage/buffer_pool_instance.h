@@ -0,0 +1,180 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "disk_manager.h"
+#include "errors.h"
+#include "common/config.h"
+#include "storage/frame_arena.h"
+#include "storage/page.h"
+#include "storage/page_table.h"
+#include "storage/buffer_access_strategy.h"
+#include "replacer/clock_replacer.h"
+#include "replacer/lru_k_replacer.h"
+#include "replacer/lru_replacer.h"
+#include "replacer/replacer.h"
+#include "recovery/log_manager.h"
+
+/**
+ * @description: buffer pool的一个分片。每个分片拥有独立的帧数组、页表、空闲链表、替换器和latch，
+ * 由BufferPoolManager按照PageId的哈希值把页面路由到固定的分片上，不同分片之间的操作互不阻塞。
+ */
+class BufferPoolInstance {
+   private:
+    /* 一次申请的一段连续帧，begin为其中第一个帧的frame_id，帧的元数据和数据分开存放 */
+    struct FrameChunk {
+        size_t begin;
+        std::unique_ptr<Page[]> pages;
+        FrameArena arena;
+    };
+
+    size_t pool_size_;      // 该分片当前可容纳页面的个数，即正在使用的帧数，frame_id < pool_size_
+    size_t num_instances_;  // buffer pool中分片的总数
+    size_t instance_index_; // 该分片在buffer pool中的下标
+    std::vector<Page *> frames_;        // frame_id -> Page，可能多于pool_size_，多出的部分是缩容后尚未释放的帧
+    std::vector<FrameChunk> chunks_;    // 帧按块申请，扩容时只追加新的块，已有的Page不会移动
+    PageTable page_table_;  // 帧号和页面号的映射哈希表，用于根据页面的PageId定位该页面的帧编号
+    std::list<frame_id_t> free_list_;   // 空闲帧编号的链表
+
+    /* 帧在所属文件的驻留帧链表中的前后指针 */
+    struct FrameLink {
+        frame_id_t prev = INVALID_FRAME_ID;
+        frame_id_t next = INVALID_FRAME_ID;
+        bool linked = false;
+    };
+    std::vector<FrameLink> fd_links_;               // 与frames_一一对应，把同一文件的驻留帧串成双向链表
+    std::unordered_map<int, frame_id_t> fd_heads_;  // fd -> 该文件驻留帧链表的表头，刷盘和删除文件时只需遍历该链表
+    DiskManager *disk_manager_;
+    LogManager *log_manager_;
+    Replacer *replacer_;    // 该分片的置换策略
+    std::mutex latch_;      // 只保护本分片的共享数据结构
+    std::vector<frame_id_t> candidates_;        // 后台写线程收集淘汰候选帧时复用的缓冲区，受latch_保护
+    std::atomic<size_t> num_victims_{0};        // 从replacer中淘汰的帧数
+    std::atomic<size_t> num_dirty_victims_{0};  // 其中需要在淘汰时同步写回的脏页数
+    std::atomic<uint64_t> write_epoch_{0};      // 分片每次写磁盘之前加一，用于判断预读的数据是否已经过时
+    std::unordered_set<PageId, PageIdHash> reading_pages_;  // 已经为顺序预读预留了帧、正在从磁盘读取的页面
+
+   public:
+    BufferPoolInstance(size_t pool_size, size_t num_instances, size_t instance_index, DiskManager *disk_manager,
+                       LogManager *log_manager);
+
+    ~BufferPoolInstance();
+
+    Page* fetch_page(PageId page_id, BufferAccessStrategy* strategy = nullptr);
+
+    bool unpin_page(PageId page_id, bool is_dirty);
+
+    bool flush_page(PageId page_id);
+
+    /**
+     * @description: 为已经分配好page_no的页面申请一个帧，page_no由BufferPoolManager预先分配，
+     * 因为只有知道了page_no才能确定页面属于哪个分片
+     * @param {PageId} page_id 新页面的page_id
+     * @param {BufferAccessStrategy*} strategy 批量操作的访问策略，可以为nullptr
+     */
+    Page* new_page(PageId page_id, BufferAccessStrategy* strategy = nullptr);
+
+    bool delete_page(PageId page_id);
+
+    void flush_all_pages(int fd);
+
+    void delete_all_pages(int fd);
+
+    size_t get_free_size() {
+        std::scoped_lock lock(latch_);
+        return free_list_.size();
+    }
+
+    size_t get_pool_size() {
+        std::scoped_lock lock(latch_);
+        return pool_size_;
+    }
+
+    /**
+     * @description: 在线调整分片的帧数。扩容时追加新的帧；缩容时被移除的帧中的页面优先迁移到
+     * 保留区间内的空闲帧，否则按WAL规则写回后淘汰。只要被移除的帧中还有被固定的页面，缩容就不会进行
+     * @return {bool} 调整成功返回true，缩容时被移除的帧中有页面被固定则返回false，分片保持原状
+     * @param {size_t} new_pool_size 新的帧数，至少为1
+     */
+    bool resize(size_t new_pool_size);
+
+    bool is_empty();
+
+    /**
+     * @description: 由后台写线程调用，把replacer中即将被淘汰的脏页提前写回磁盘，
+     * 只写回日志已经持久化的页面(page_lsn <= flushed_lsn)，这样淘汰时通常能直接复用干净的帧
+     * @return {size_t} 本次写回的页面数
+     * @param {size_t} lookahead 最多检查的淘汰候选帧数
+     */
+    size_t clean_victim_candidates(size_t lookahead);
+
+    size_t get_num_victims() const { return num_victims_.load(std::memory_order_relaxed); }
+
+    size_t get_num_dirty_victims() const { return num_dirty_victims_.load(std::memory_order_relaxed); }
+
+    uint64_t get_write_epoch() const { return write_epoch_.load(); }
+
+    void get_resident_pages(std::vector<PageId> *page_ids);
+
+    bool install_page(PageId page_id, const char *data, uint64_t write_epoch);
+
+    /**
+     * @description: 为顺序预读预留一个帧。帧被固定且不在页表中，读取完成后由finish_read_ahead装入页表或归还
+     * @return {Page*} 预留的帧，页面已经在分片中或者没有可用的帧时返回nullptr
+     * @param {PageId} page_id 将要读入的页面
+     * @param {BufferAccessStrategy*} strategy 批量操作的访问策略，可以为nullptr
+     * @param {frame_id_t*} frame_id 预留的帧号
+     */
+    Page *reserve_read_ahead(PageId page_id, BufferAccessStrategy *strategy, frame_id_t *frame_id);
+
+    /**
+     * @description: 结束一个页面的预读。读取成功并且期间没有其他线程装入过该页面时，把它放入页表，
+     * 作为未被固定的页面交给replacer，否则丢弃读到的数据，把帧放回free_list_
+     * @param {PageId} page_id 预读的页面
+     * @param {frame_id_t} frame_id reserve_read_ahead预留的帧号
+     * @param {bool} success 是否完整地读到了页面
+     */
+    void finish_read_ahead(PageId page_id, frame_id_t frame_id, bool success);
+
+    /**
+     * 临时page的page_no编码为 frame_id * num_instances_ + instance_index_，
+     * 这样BufferPoolManager可以直接由page_no找到对应的分片和帧
+     */
+    Page* new_tmp_page(PageId* page_id);
+
+    bool unpin_tmp_page(PageId page_id);
+
+   private:
+    bool find_victim_page(frame_id_t* frame_id);
+
+    bool find_victim_page(frame_id_t* frame_id, PageId new_page_id, BufferAccessStrategy* strategy);
+
+    void update_page(Page* page, PageId new_page_id, frame_id_t new_frame_id);
+
+    void grow_frames(size_t num_frames);
+
+    void link_frame(frame_id_t frame_id);
+
+    void unlink_frame(frame_id_t frame_id);
+
+    void flush_frames(int fd, std::vector<frame_id_t> &frame_ids);
+
+    void rebuild_index();
+};
@@ -10,93 +10,433 @@ See the Mulan PSL v2 for more details. */
 
 #include "buffer_pool_manager.h"
 
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <unordered_map>
+
+// 清单文件格式: magic, 文件个数, 每个文件的(名字长度, 名字), 页面个数, 每个页面的(文件下标, 页号)，均为uint32
+static constexpr uint32_t MANIFEST_MAGIC = 0x424d5852;  // "RXMB"
+
+BufferPoolManager::BufferPoolManager(size_t pool_size, DiskManager *disk_manager, LogManager *log_manager,
+                                     size_t num_instances)
+    : disk_manager_(disk_manager), log_manager_(log_manager) {
+    // 每个分片至少要有一个帧
+    num_instances_ = std::max<size_t>(1, std::min(num_instances, pool_size));
+    pool_size_ = std::max(pool_size, num_instances_);
+    instances_.reserve(num_instances_);
+    for (size_t i = 0; i < num_instances_; ++i) {
+        instances_.emplace_back(std::make_unique<BufferPoolInstance>(get_instance_size(pool_size_, i), num_instances_,
+                                                                     i, disk_manager_, log_manager_));
+    }
+}
+
+BufferPoolManager::~BufferPoolManager() {
+    stop_prefetch();
+    stop_background_writer();
+}
+
+void BufferPoolManager::start_background_writer() {
+    std::scoped_lock lock(bg_writer_latch_);
+    if (bg_writer_running_) {
+        return;
+    }
+    bg_writer_running_ = true;
+    bg_writer_ = std::thread(&BufferPoolManager::background_writer, this);
+}
+
+void BufferPoolManager::stop_background_writer() {
+    {
+        std::scoped_lock lock(bg_writer_latch_);
+        bg_writer_running_ = false;
+    }
+    bg_writer_cv_.notify_all();
+    if (bg_writer_.joinable()) {
+        bg_writer_.join();
+    }
+}
 
 /**
- * @description: 从free_list或replacer中得到可淘汰帧页的 *frame_id
- * @return {bool} true: 可替换帧查找成功 , false: 可替换帧查找失败
- * @param {frame_id_t*} frame_id 帧页id指针,返回成功找到的可替换帧id
- *
+ * @description: 后台写线程的主循环。每一轮在每个分片中检查一定数量的淘汰候选帧，写回其中的脏页。
+ *               检查的帧数跟随近期的淘汰速度：突发的淘汰立即生效，空闲时缓慢衰减；
+ *               淘汰时仍然遇到脏页说明写回不够及时，缩短两轮之间的间隔，一轮没有写回任何页面则逐渐延长间隔
  */
-bool BufferPoolManager::find_victim_page(frame_id_t* frame_id) {
-    // 1 使用BufferPoolManager::free_list_判断缓冲池是否已满需要淘汰页面
-    // 1.1 未满获得frame
-    // 1.2 已满使用lru_replacer中的方法选择淘汰页面
-    bool find_victim{false};
-    if(free_list_.empty()) {
-    // buffer pool 已满，需要从replacer中选择淘汰页面。
-    find_victim = replacer_->victim(frame_id);
-    } else {
-        *frame_id = free_list_.front();
-        free_list_.pop_front();
-        find_victim = true;
-    }
-    return find_victim;
+void BufferPoolManager::background_writer() {
+    int delay_ms = BGWRITER_MIN_DELAY_MS;
+    double victims_per_round = 0;   // 平滑后的每个分片每轮淘汰的帧数
+    size_t last_victims = 0;
+    size_t last_dirty_victims = 0;
+    auto last_manifest_time = std::chrono::steady_clock::now();
+    std::unique_lock lock(bg_writer_latch_);
+    while (!bg_writer_cv_.wait_for(lock, std::chrono::milliseconds(delay_ms), [this] { return !bg_writer_running_; })) {
+        std::string manifest_path = manifest_path_;
+        lock.unlock();
+        auto now = std::chrono::steady_clock::now();
+        if (!manifest_path.empty() &&
+            now - last_manifest_time >= std::chrono::milliseconds(BUFFER_POOL_MANIFEST_INTERVAL_MS)) {
+            last_manifest_time = now;
+            try {
+                save_manifest(manifest_path);
+            } catch (RMDBError &e) {
+                // 清单只用于预热，写入失败不影响正常运行
+            }
+        }
+        size_t num_victims = 0;
+        size_t num_dirty_victims = 0;
+        for (auto &instance : instances_) {
+            num_victims += instance->get_num_victims();
+            num_dirty_victims += instance->get_num_dirty_victims();
+        }
+        double recent_victims = static_cast<double>(num_victims - last_victims) / num_instances_;
+        size_t recent_dirty_victims = num_dirty_victims - last_dirty_victims;
+        last_victims = num_victims;
+        last_dirty_victims = num_dirty_victims;
+        if (recent_victims > victims_per_round) {
+            victims_per_round = recent_victims;
+        } else {
+            victims_per_round += (recent_victims - victims_per_round) / 16;
+        }
+        auto lookahead = static_cast<size_t>(victims_per_round * BGWRITER_LOOKAHEAD_MULTIPLIER);
+        lookahead = std::clamp(lookahead, BGWRITER_MIN_LOOKAHEAD, BGWRITER_MAX_LOOKAHEAD);
+
+        size_t num_written = 0;
+        for (auto &instance : instances_) {
+            num_written += instance->clean_victim_candidates(lookahead);
+        }
+        if (recent_dirty_victims > 0) {
+            delay_ms = std::max(BGWRITER_MIN_DELAY_MS, delay_ms / 2);
+        } else if (num_written == 0) {
+            delay_ms = std::min(BGWRITER_MAX_DELAY_MS, delay_ms * 2);
+        }
+        lock.lock();
+    }
+}
+
+void BufferPoolManager::save_manifest(const std::string &path) {
+    std::scoped_lock lock(manifest_latch_);
+    // 各分片分别按从热到冷的顺序收集驻留页面，再轮流合并，近似得到全局的热度顺序
+    std::vector<std::vector<PageId>> instance_pages(num_instances_);
+    size_t max_pages = 0;
+    for (size_t i = 0; i < num_instances_; ++i) {
+        instances_[i]->get_resident_pages(&instance_pages[i]);
+        max_pages = std::max(max_pages, instance_pages[i].size());
+    }
+    std::vector<std::string> file_names;
+    std::unordered_map<int, uint32_t> fd2index;   // 已经关闭的文件对应UINT32_MAX
+    std::vector<uint32_t> entries;
+    for (size_t rank = 0; rank < max_pages; ++rank) {
+        for (auto &pages : instance_pages) {
+            if (rank >= pages.size()) {
+                continue;
+            }
+            auto it = fd2index.find(pages[rank].fd);
+            if (it == fd2index.end()) {
+                uint32_t index = UINT32_MAX;
+                try {
+                    file_names.emplace_back(disk_manager_->get_file_name(pages[rank].fd));
+                    index = static_cast<uint32_t>(file_names.size() - 1);
+                } catch (FileNotOpenError &e) {
+                }
+                it = fd2index.emplace(pages[rank].fd, index).first;
+            }
+            if (it->second != UINT32_MAX) {
+                entries.emplace_back(it->second);
+                entries.emplace_back(static_cast<uint32_t>(pages[rank].page_no));
+            }
+        }
+    }
+
+    // 先写临时文件再改名，避免崩溃时留下不完整的清单
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        auto write_u32 = [&](uint32_t value) { out.write(reinterpret_cast<const char *>(&value), sizeof(value)); };
+        write_u32(MANIFEST_MAGIC);
+        write_u32(static_cast<uint32_t>(file_names.size()));
+        for (auto &name : file_names) {
+            write_u32(static_cast<uint32_t>(name.size()));
+            out.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+        write_u32(static_cast<uint32_t>(entries.size() / 2));
+        out.write(reinterpret_cast<const char *>(entries.data()),
+                  static_cast<std::streamsize>(entries.size() * sizeof(uint32_t)));
+        if (!out) {
+            throw InternalError("BufferPoolManager::save_manifest Error");
+        }
+    }
+    if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+        throw UnixError();
+    }
+}
+
+void BufferPoolManager::start_prefetch(const std::string &path) {
+    stop_prefetch();
+    {
+        std::scoped_lock lock(bg_writer_latch_);
+        manifest_path_ = path;
+    }
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return;
+    }
+    auto read_u32 = [&](uint32_t *value) {
+        return static_cast<bool>(in.read(reinterpret_cast<char *>(value), sizeof(*value)));
+    };
+    uint32_t magic, num_files;
+    if (!read_u32(&magic) || magic != MANIFEST_MAGIC || !read_u32(&num_files)) {
+        return;
+    }
+    // 清单中的文件按文件名找到当前打开的fd，没有打开的文件跳过
+    std::vector<int> fds;
+    for (uint32_t i = 0; i < num_files; ++i) {
+        uint32_t len;
+        if (!read_u32(&len) || len > PATH_MAX) {
+            return;
+        }
+        std::string name(len, '\0');
+        if (!in.read(name.data(), len)) {
+            return;
+        }
+        fds.emplace_back(disk_manager_->get_open_file_fd(name));
+    }
+    uint32_t num_pages;
+    if (!read_u32(&num_pages)) {
+        return;
+    }
+    std::vector<PageId> page_ids;
+    page_ids.reserve(std::min<size_t>(num_pages, pool_size_));
+    for (uint32_t i = 0; i < num_pages && page_ids.size() < pool_size_; ++i) {
+        uint32_t file_index, page_no;
+        if (!read_u32(&file_index) || !read_u32(&page_no)) {
+            break;
+        }
+        if (file_index < fds.size() && fds[file_index] != -1) {
+            page_ids.push_back(PageId{fds[file_index], static_cast<page_id_t>(page_no)});
+        }
+    }
+    if (page_ids.empty()) {
+        return;
+    }
+    prefetch_running_ = true;
+    prefetch_thread_ = std::thread(&BufferPoolManager::prefetch, this, std::move(page_ids));
+}
+
+void BufferPoolManager::stop_prefetch() {
+    prefetch_running_ = false;
+    if (prefetch_thread_.joinable()) {
+        prefetch_thread_.join();
+    }
 }
 
 /**
- * @description: 更新页面数据, 如果为脏页则需写入磁盘，再更新为新页面，更新page元数据(data, is_dirty, page_id)和page table
- * @param {Page*} page 写回页指针
- * @param {PageId} new_page_id 新的page_id
- * @param {frame_id_t} new_frame_id 新的帧frame_id
+ * @description: 预读线程。清单从热到冷分成若干批，每批内按(fd, page_no)排序，
+ *               同一文件中相距不超过PREFETCH_MAX_GAP_PAGES的页面合并为一次读取，间隔中的页面读出后丢弃。
+ *               读取前记录各分片的write_epoch，装入时分片写过磁盘则放弃该页面，避免装入过时的数据
+ * @param {vector<PageId>} page_ids 从热到冷排列的页面
  */
-void BufferPoolManager::update_page(Page *page, PageId new_page_id, frame_id_t new_frame_id) {
-    // 1 如果是脏页，写回磁盘，并且把dirty置为false
-    // 2 更新page table
-    // 3 重置page的data，更新page id
-    // 根据WAL规则，刷盘前必须先写入LOG
-    if(page->get_page_lsn() > log_manager_->flushed_lsn_) {
-        LOG_DEBUG("Trigger WAL");
-        log_manager_->flush_log_to_disk();
-    }
-    // 首先检查该页上是否是有页面。
-    if(page->is_dirty()&&page->get_page_id().fd!=TMP_FD){
-        page->is_dirty_ = false;
-        disk_manager_->write_page(page->get_page_id().fd, page->get_page_id().page_no, page->get_data(), PAGE_SIZE);
-        log_manager_->dirty_page_table_.erase(page->get_page_id());
-    }
-    page_table_.erase(page->get_page_id()); //update page table
-    if(new_page_id.page_no != INVALID_PAGE_ID) {
-        page_table_.insert(std::make_pair(new_page_id, new_frame_id));
-    }
-    page->reset_memory();
-    page->id_ = new_page_id;
+void BufferPoolManager::prefetch(std::vector<PageId> page_ids) {
+    // 缓冲区按PAGE_SIZE对齐，数据文件使用直接I/O时也可以直接读入
+    FrameArena buffer(static_cast<size_t>(PREFETCH_IO_DEPTH) * PREFETCH_MAX_READ_PAGES);
+    std::vector<DiskManager::PageRead> reads;
+    std::vector<size_t> read_ends;  // 每次读取覆盖的page_ids范围的结尾
+    std::vector<uint64_t> write_epochs(num_instances_);
+    std::vector<bool> is_full(num_instances_, false);
+    size_t num_full = 0;
+    for (size_t begin = 0; begin < page_ids.size(); begin += PREFETCH_BATCH_PAGES) {
+        size_t end = std::min(page_ids.size(), begin + PREFETCH_BATCH_PAGES);
+        std::sort(page_ids.begin() + begin, page_ids.begin() + end);
+        size_t i = begin;
+        while (i < end) {
+            if (!prefetch_running_) {
+                return;
+            }
+            // 合并出最多PREFETCH_IO_DEPTH次读取，一起交给IoEngine并发执行
+            reads.clear();
+            read_ends.clear();
+            size_t group_begin = i;
+            while (i < end && reads.size() < static_cast<size_t>(PREFETCH_IO_DEPTH)) {
+                size_t j = i + 1;
+                while (j < end && page_ids[j].fd == page_ids[i].fd &&
+                       page_ids[j].page_no - page_ids[j - 1].page_no <= PREFETCH_MAX_GAP_PAGES &&
+                       page_ids[j].page_no - page_ids[i].page_no < PREFETCH_MAX_READ_PAGES) {
+                    j++;
+                }
+                char *read_buffer = buffer.get_frame(reads.size() * PREFETCH_MAX_READ_PAGES);
+                reads.push_back(DiskManager::PageRead{page_ids[i].fd, page_ids[i].page_no, read_buffer,
+                                                      page_ids[j - 1].page_no - page_ids[i].page_no + 1, 0});
+                read_ends.push_back(j);
+                i = j;
+            }
+            for (size_t k = 0; k < num_instances_; ++k) {
+                write_epochs[k] = instances_[k]->get_write_epoch();
+            }
+            disk_manager_->read_pages_batch(&reads);
+            size_t k = group_begin;
+            for (size_t r = 0; r < reads.size(); ++r) {
+                for (; k < read_ends[r]; ++k) {
+                    int offset = page_ids[k].page_no - reads[r].first_page_no;
+                    size_t index = get_instance_index(page_ids[k]);
+                    if (offset >= reads[r].num_read || is_full[index]) {
+                        continue;
+                    }
+                    if (!instances_[index]->install_page(
+                            page_ids[k], reads[r].buffer + static_cast<size_t>(offset) * PAGE_SIZE,
+                            write_epochs[index])) {
+                        // 该分片已经没有空闲帧，所有分片都满了就结束预读
+                        is_full[index] = true;
+                        if (++num_full == num_instances_) {
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+    }
 }
 
 /**
- * @description: 从buffer pool获取需要的页。
- *              如果页表中存在page_id（说明该page在缓冲池中），并且pin_count++。
- *              如果页表不存在page_id（说明该page在磁盘中），则找缓冲池victim page，将其替换为磁盘中读取的page，pin_count置1。
- * @return {Page*} 若获得了需要的页则将其返回，否则返回nullptr
- * @param {PageId} page_id 需要获取的页的PageId
+ * @description: 根据游标的访问记录决定是否预读。游标走到已预读区域的后一半时预读下一个窗口，
+ *               窗口翻倍直到READAHEAD_MAX_PAGES；有访问策略时窗口不超过环形缓冲区的1/4，避免预读的页面在被访问之前就被环复用
+ * @param {ReadAheadState*} state 游标的预读状态
+ * @param {PageId} page_id 游标即将访问的页面
+ * @param {page_id_t} end_page_no 预读不超过该页面
+ * @param {BufferAccessStrategy*} strategy 游标的访问策略
  */
-Page* BufferPoolManager::fetch_page(PageId page_id) {
-    // 1.     从page_table_中搜寻目标页
-    // 1.1    若目标页有被page_table_记录，则将其所在frame固定(pin)，并返回目标页。
-    // 1.2    否则，尝试调用find_victim_page获得一个可用的frame，若失败则返回nullptr
-    // 2.     若获得的可用frame存储的为dirty page，则须调用update_page将page写回到磁盘
-    // 3.     调用disk_manager_的read_page读取目标页到frame
-    // 4.     固定目标页，更新pin_count_
-    // 5.     返回目标页
-    std::scoped_lock<std::mutex> lock(latch_);
-    auto it = page_table_.find(page_id);
-    if(it==page_table_.end()) {
-        // not find
+void BufferPoolManager::read_ahead(ReadAheadState *state, PageId page_id, page_id_t end_page_no,
+                                   BufferAccessStrategy *strategy) {
+    if (page_id.page_no == state->last_page_no_ + 1) {
+        state->num_sequential_++;
+    } else if (page_id.page_no != state->last_page_no_) {
+        state->num_sequential_ = 0;
+        state->window_ = READAHEAD_MIN_PAGES;
+        state->read_end_ = page_id.page_no + 1;
+    }
+    state->last_page_no_ = page_id.page_no;
+    if (!state->sequential_ && state->num_sequential_ < READAHEAD_SEQUENTIAL_ACCESSES) {
+        return;
+    }
+    int max_window = READAHEAD_MAX_PAGES;
+    if (strategy != nullptr) {
+        max_window = std::min<int>(max_window, static_cast<int>(BULKREAD_RING_SIZE / 4));
+    }
+    state->window_ = std::min(state->window_, max_window);
+    if (state->read_end_ - page_id.page_no > state->window_ / 2) {
+        return;
+    }
+    page_id_t first_page_no = std::max(state->read_end_, page_id.page_no + 1);
+    int num_pages = std::min<int>(state->window_, end_page_no - first_page_no);
+    if (num_pages <= 0) {
+        return;
+    }
+    read_pages_ahead(page_id.fd, first_page_no, num_pages, strategy);
+    state->read_end_ = first_page_no + num_pages;
+    state->window_ = std::min(state->window_ * 2, max_window);
+}
+
+/**
+ * @description: 把[first_page_no, first_page_no + num_pages)中不在buffer pool里的页面读入各自分片预留的帧，
+ *               页号连续的页面合并为一次最多READAHEAD_MAX_READ_PAGES页的分散读，所有读取一起交给IoEngine
+ */
+void BufferPoolManager::read_pages_ahead(int fd, page_id_t first_page_no, int num_pages,
+                                         BufferAccessStrategy *strategy) {
+    std::vector<PageId> page_ids;
+    std::vector<frame_id_t> frame_ids;
+    std::vector<char *> pages;
+    page_ids.reserve(num_pages);
+    frame_ids.reserve(num_pages);
+    pages.reserve(num_pages);
+    std::vector<DiskManager::PageRead> reads;
+    std::vector<size_t> read_begins;  // 每次读取的第一个页面在page_ids中的下标
+    for (page_id_t page_no = first_page_no; page_no < first_page_no + num_pages; ++page_no) {
+        PageId page_id{fd, page_no};
         frame_id_t frame_id;
-        if(!find_victim_page(&frame_id)) {
-            return nullptr;
+        Page *page = get_instance(page_id)->reserve_read_ahead(page_id, strategy, &frame_id);
+        if (page == nullptr) {
+            continue;
+        }
+        bool extend = !page_ids.empty() && page_ids.back().page_no + 1 == page_no &&
+                      reads.back().num_pages < READAHEAD_MAX_READ_PAGES;
+        page_ids.push_back(page_id);
+        frame_ids.push_back(frame_id);
+        pages.push_back(page->get_data());
+        if (extend) {
+            reads.back().num_pages++;
+        } else {
+            reads.push_back(DiskManager::PageRead{fd, page_no, nullptr, 1, 0, &pages.back()});
+            read_begins.push_back(page_ids.size() - 1);
+        }
+    }
+    if (reads.empty()) {
+        return;
+    }
+    disk_manager_->read_pages_batch(&reads);
+    for (size_t r = 0; r < reads.size(); ++r) {
+        for (int k = 0; k < reads[r].num_pages; ++k) {
+            size_t index = read_begins[r] + k;
+            get_instance(page_ids[index])->finish_read_ahead(page_ids[index], frame_ids[index], k < reads[r].num_read);
+        }
+    }
+}
+
+/**
+ * @description: 在线调整buffer pool的帧数。各分片依次调整，每个分片只在自己的latch下短暂停顿
+ * @return {bool} 所有分片都调整成功时返回true，否则pool_size_为实际的帧数
+ * @param {size_t} pool_size 新的帧数
+ */
+bool BufferPoolManager::resize(size_t pool_size) {
+    std::scoped_lock lock(resize_latch_);
+    pool_size = std::max(pool_size, num_instances_);
+    bool success = true;
+    size_t actual_size = 0;
+    for (size_t i = 0; i < num_instances_; ++i) {
+        if (!instances_[i]->resize(get_instance_size(pool_size, i))) {
+            success = false;
         }
-        auto p  = &pages_[frame_id];
-        update_page(p,page_id,frame_id); // 调用update_page将page写回到磁盘
-        disk_manager_->read_page(page_id.fd,page_id.page_no,p->get_data(),PAGE_SIZE); // 调用disk_manager_的read_page读取目标页到frame
-        p->pin_count_ = 1;
-        replacer_->pin(frame_id);
-        return p;
-    } else {
-        auto frame_id = it->second;
-        pages_[frame_id].pin_count_++;
-        replacer_->pin(frame_id);
-        return &pages_[frame_id];
+        actual_size += instances_[i]->get_pool_size();
     }
+    pool_size_ = actual_size;
+    return success;
+}
+
+bool BufferPoolManager::set_page_size(int page_size) {
+    std::scoped_lock lock(resize_latch_);
+    assert(is_valid_page_size(page_size));
+    // 下面直接替换instances_，后台写线程和预读线程都不能在运行
+    assert(!prefetch_thread_.joinable());
+    {
+        std::scoped_lock bg_lock(bg_writer_latch_);
+        assert(!bg_writer_running_);
+    }
+    if (page_size == PAGE_SIZE) {
+        return true;
+    }
+    for (auto &instance : instances_) {
+        if (!instance->is_empty()) {
+            return false;
+        }
+    }
+    size_t pool_size = std::max(get_pool_size() * PAGE_SIZE / page_size, num_instances_);
+    PAGE_SIZE = page_size;
+    // 分片个数不变，页面与分片之间的映射也就不变
+    for (size_t i = 0; i < num_instances_; ++i) {
+        instances_[i] = std::make_unique<BufferPoolInstance>(get_instance_size(pool_size, i), num_instances_, i,
+                                                             disk_manager_, log_manager_);
+    }
+    pool_size_ = pool_size;
+    return true;
+}
+
+/**
+ * @description: 从buffer pool获取需要的页，由page_id所在的分片负责
+ * @return {Page*} 若获得了需要的页则将其返回，否则返回nullptr
+ * @param {PageId} page_id 需要获取的页的PageId
+ * @param {BufferAccessStrategy*} strategy 批量操作的访问策略，为nullptr时使用共享的替换策略
+ */
+Page* BufferPoolManager::fetch_page(PageId page_id, BufferAccessStrategy* strategy) {
+    return get_instance(page_id)->fetch_page(page_id, strategy);
 }
 
 /**
@@ -106,32 +446,7 @@ Page* BufferPoolManager::fetch_page(PageId page_id) {
  * @param {bool} is_dirty 若目标page应该被标记为dirty则为true，否则为false
  */
 bool BufferPoolManager::unpin_page(PageId page_id, bool is_dirty) {
-    // 0. lock latch
-    std::scoped_lock<std::mutex> lock(latch_);
-    // 1. 尝试在page_table_中搜寻page_id对应的页P
-    auto it = page_table_.find(page_id);
-    // 1.1 P在页表中不存在 return false
-    if(it==page_table_.end()) {
-        return false;
-    }
-    // 1.2 P在页表中存在，获取其pin_count_
-    auto page = &pages_[it->second];
-    auto& pin_count = page->pin_count_;
-    // 2.1 若pin_count_已经等于0，则返回false
-    if(pin_count <= 0) {
-        return false;
-    }
-
-    // 2.2 若pin_count_大于0，则pin_count_自减一
-    pin_count--;
-    // 2.2.1 若自减后等于0，则调用replacer_的Unpin
-    if(pin_count==0) {
-        replacer_->unpin(it->second);
-        // free_list_.emplace_back(it->second);
-    }
-    // 3 根据参数is_dirty，更改P的is_dirty_
-    page->is_dirty_|=is_dirty;
-    return true;
+    return get_instance(page_id)->unpin_page(page_id, is_dirty);
 }
 
 /**
@@ -140,48 +455,20 @@ bool BufferPoolManager::unpin_page(PageId page_id, bool is_dirty) {
  * @param {PageId} page_id 目标页的page_id，不能为INVALID_PAGE_ID
  */
 bool BufferPoolManager::flush_page(PageId page_id) {
-    // 0. lock latch
-    std::scoped_lock<std::mutex> lock(latch_);
-    // 1. 查找页表,尝试获取目标页P
-    auto it = page_table_.find(page_id);
-    // 1.1 目标页P没有被page_table_记录 ，返回false
-    if(it==page_table_.end()) {
-        return false;
-    }
-    // 2. 无论P是否为脏都将其写回磁盘。
-    auto page = &pages_[it->second];
-    log_manager_->dirty_page_table_.erase(page_id);
-    disk_manager_->write_page(page->get_page_id().fd, page->get_page_id().page_no, page->get_data(), PAGE_SIZE);
-    // 3. 更新P的is_dirty_
-    page->is_dirty_ = false;
-    return true;
+    return get_instance(page_id)->flush_page(page_id);
 }
 
 /**
  * @description: 创建一个新的page，即从磁盘中移动一个新建的空page到缓冲池某个位置。
  * @return {Page*} 返回新创建的page，若创建失败则返回nullptr
  * @param {PageId*} page_id 当成功创建一个新的page时存储其page_id
+ * @param {BufferAccessStrategy*} strategy 批量操作的访问策略，为nullptr时使用共享的替换策略
  */
-Page* BufferPoolManager::new_page(PageId* page_id) {
-    std::scoped_lock<std::mutex> lock(latch_);
-    // 1.   获得一个可用的frame，若无法获得则返回nullptr
-    frame_id_t frame_id;
-
-    if(!find_victim_page(&frame_id)) {
-        return nullptr;
-    }
-    // 2.   在fd对应的文件分配一个新的page_id
+Page* BufferPoolManager::new_page(PageId* page_id, BufferAccessStrategy* strategy) {
+    // 先分配page_no才能确定新页面属于哪个分片
+    // 若该分片的帧全部被固定则返回nullptr，此时已分配的page_no不会被回收
     page_id->page_no = disk_manager_->allocate_page(page_id->fd);
-    auto page = &pages_[frame_id];
-    // 3.   将frame的数据写回磁盘
-    update_page(page, *page_id,frame_id);
-    // 4.   固定frame，更新pin_count_
-    page->pin_count_++;
-    replacer_->pin(frame_id);
-    // 需写回
-    disk_manager_->write_page(page_id->fd, page_id->page_no, page->data_, PAGE_SIZE);
-    // 5.   返回获得的page
-    return page;
+    return get_instance(*page_id)->new_page(*page_id, strategy);
 }
 
 /**
@@ -190,25 +477,7 @@ Page* BufferPoolManager::new_page(PageId* page_id) {
  * @param {PageId} page_id 目标页
  */
 bool BufferPoolManager::delete_page(PageId page_id) {
-    std::scoped_lock<std::mutex> lock(latch_);
-    // 1.   在page_table_中查找目标页，若不存在返回true
-    auto it = page_table_.find(page_id);
-    if(it==page_table_.end()) {
-        return true;
-    }
-    // 2.   若目标页的pin_count不为0，则返回false
-    auto page = &pages_[it->second];
-    if(page->pin_count_>0) {
-        return false;
-    }
-    page_table_.erase(it);
-    // 3.   将目标页数据写回磁盘，从页表中删除目标页，重置其元数据，将其加入free_list_，返回true
-    auto new_page_id = page->get_page_id();
-    new_page_id.page_no=INVALID_PAGE_ID;
-    update_page(page,new_page_id,it->second);
-    free_list_.emplace_back(it->second);
-    disk_manager_->deallocate_page(page_id.page_no);
-    return true;
+    return get_instance(page_id)->delete_page(page_id);
 }
 
 /**
@@ -216,74 +485,42 @@ bool BufferPoolManager::delete_page(PageId page_id) {
  * @param {int} fd 文件句柄
  */
 void BufferPoolManager::flush_all_pages(int fd) {
-    std::scoped_lock lock(latch_);
-    for (size_t i = 0; i < pool_size_; i++) {
-        Page *page = &pages_[i];
-        if (page->get_page_id().fd == fd && page->get_page_id().page_no != INVALID_PAGE_ID) {
-            log_manager_->dirty_page_table_.erase(page->get_page_id());
-            disk_manager_->write_page(page->get_page_id().fd, page->get_page_id().page_no, page->get_data(), PAGE_SIZE);
-            page->is_dirty_ = false;
-        }
+    for (auto &instance : instances_) {
+        instance->flush_all_pages(fd);
     }
 }
 
 void BufferPoolManager::delete_all_pages(int fd) {
-    std::scoped_lock lock(latch_);
-    for (size_t i = 0; i < pool_size_; i++) {
-        Page *page = &pages_[i];
-        if (page->get_page_id().fd == fd && page->get_page_id().page_no != INVALID_PAGE_ID) {
-            auto it = page_table_.find(page->get_page_id());
-            page_table_.erase(it);
-            auto new_page_id = page->get_page_id();
-            new_page_id.page_no=INVALID_PAGE_ID;
-            update_page(page,new_page_id,it->second);
-            free_list_.emplace_back(it->second);
-            disk_manager_->deallocate_page(page->get_page_id().page_no);
-        }
+    // 文件即将被删除，不能再把它的页面预读进来
+    stop_prefetch();
+    for (auto &instance : instances_) {
+        instance->delete_all_pages(fd);
     }
 }
 
+size_t BufferPoolManager::get_free_size() {
+    size_t free_size = 0;
+    for (auto &instance : instances_) {
+        free_size += instance->get_free_size();
+    }
+    return free_size;
+}
+
 Page *BufferPoolManager::new_tmp_page(PageId *page_id) {
     assert(page_id->fd==TMP_FD);
-    std::scoped_lock<std::mutex> lock(latch_);
-    // 1.   获得一个可用的frame，若无法获得则返回nullptr
-    frame_id_t frame_id;
-
-    if(!find_victim_page(&frame_id)) {
-        return nullptr;
+    // 临时页不需要按PageId路由，从下一个分片开始轮询，找到有空闲帧的分片为止
+    size_t start = next_tmp_instance_.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < num_instances_; ++i) {
+        Page *page = instances_[(start + i) % num_instances_]->new_tmp_page(page_id);
+        if (page != nullptr) {
+            return page;
+        }
     }
-    // 2.   在fd对应的文件分配一个新的page_id
-    page_id->page_no = frame_id;  // 直接将frame_id作为新的page_id
-
-    auto page = &pages_[frame_id];
-    // 3.   将frame的数据写回磁盘
-    update_page(page, *page_id,frame_id);
-    // 4.   固定frame，更新pin_count_
-    page->pin_count_++;
-    replacer_->pin(frame_id);
-    // 5.   返回获得的page
-    return page;
+    return nullptr;
 }
 
 bool BufferPoolManager::unpin_tmp_page(PageId page_id) {
-    std::scoped_lock<std::mutex> lock(latch_);
-
-    auto frame_id = page_id.page_no;
-    auto page = &pages_[frame_id];
-    assert(page->get_page_id().fd==TMP_FD);
-    auto& pin_count = page->pin_count_;
-    // 2.1 若pin_count_已经等于0，则返回false
-    if(pin_count <= 0) {
-        return false;
-    }
-
-    // 2.2 若pin_count_大于0，则pin_count_自减一
-    pin_count--;
-    // 2.2.1 若自减后等于0，则调用replacer_的Unpin
-    if(pin_count==0) {
-        replacer_->unpin(frame_id);
-        free_list_.emplace_back(frame_id);
-    }
-    // 3 根据参数is_dirty，更改P的is_dirty_
-    return true;
+    assert(page_id.fd==TMP_FD);
+    // 临时页的page_no编码了所在的分片
+    return instances_[page_id.page_no % num_instances_]->unpin_tmp_page(page_id);
 }
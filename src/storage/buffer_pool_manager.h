@@ -12,53 +12,53 @@ See the Mulan PSL v2 for more details. */
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <cassert>
-#include <list>
-#include <unordered_map>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "disk_manager.h"
 #include "errors.h"
 #include "common/config.h"
 #include "storage/page.h"
-#include "replacer/lru_replacer.h"
-#include "replacer/replacer.h"
+#include "storage/buffer_access_strategy.h"
+#include "storage/buffer_pool_instance.h"
+#include "storage/read_ahead.h"
 #include "recovery/log_manager.h"
+
+/**
+ * @description: 分片的buffer pool。页面按照PageId的哈希值被固定地分配给某一个BufferPoolInstance，
+ * 每个分片拥有自己的latch，因此访问不同分片的线程之间不会互相阻塞。对外接口与未分片时保持一致。
+ */
 class BufferPoolManager {
    private:
-    size_t pool_size_;      // buffer_pool中可容纳页面的个数，即帧的个数
-    Page *pages_;           // buffer_pool中的Page对象数组，在构造空间中申请内存空间，在析构函数中释放，大小为BUFFER_POOL_SIZE
-    std::unordered_map<PageId, frame_id_t, PageIdHash> page_table_; // 帧号和页面号的映射哈希表，用于根据页面的PageId定位该页面的帧编号
-    std::list<frame_id_t> free_list_;   // 空闲帧编号的链表
+    std::atomic<size_t> pool_size_;  // buffer_pool中可容纳页面的个数，即所有分片帧数之和
+    size_t num_instances_;  // 分片个数，启动后不再改变，否则页面与分片之间的映射会失效
+    std::mutex resize_latch_;   // 串行化resize，不影响正常的页面访问
+    std::vector<std::unique_ptr<BufferPoolInstance>> instances_;
+    std::atomic<size_t> next_tmp_instance_{0};  // 轮流从各个分片中申请临时页
     DiskManager *disk_manager_;
-    Replacer *replacer_;    // buffer_pool的置换策略，当前赛题中为LRU置换策略
-    std::mutex latch_;      // 用于共享数据结构的并发控制
-    std::vector<bool> is_used_; // 如果该frame上有page，标记为true
-    // page_id_t tmp_id_{0}; // 下一个tmp_page的id
+    LogManager *log_manager_;
+
+    std::thread bg_writer_;                 // 后台写线程
+    std::mutex bg_writer_latch_;
+    std::condition_variable bg_writer_cv_;  // 用于唤醒后台写线程退出
+    bool bg_writer_running_ = false;
+    std::string manifest_path_;             // 后台写线程定期把驻留页面清单写入该文件，为空时不写
+
+    std::thread prefetch_thread_;           // 打开数据库时根据清单预读页面的线程
+    std::atomic<bool> prefetch_running_{false};
+    std::mutex manifest_latch_;             // 串行化清单的写入
+
    public:
-    BufferPoolManager(size_t pool_size, DiskManager *disk_manager, LogManager *log_manager)
-        : pool_size_(pool_size), disk_manager_(disk_manager), log_manager_(log_manager) {
-        // 为buffer pool分配一块连续的内存空间
-        pages_ = new Page[pool_size_];
-        // 可以被Replacer改变
-        if (REPLACER_TYPE.compare("LRU"))
-            replacer_ = new LRUReplacer(pool_size_);
-        else if (REPLACER_TYPE.compare("CLOCK"))
-            replacer_ = new LRUReplacer(pool_size_);
-        else {
-            replacer_ = new LRUReplacer(pool_size_);
-        }
-        // 初始化时，所有的page都在free_list_中
-        for (size_t i = 0; i < pool_size_; ++i) {
-            free_list_.emplace_back(static_cast<frame_id_t>(i));  // static_cast转换数据类型
-        }
-        is_used_.reserve(pool_size);
-    }
+    BufferPoolManager(size_t pool_size, DiskManager *disk_manager, LogManager *log_manager,
+                      size_t num_instances = BUFFER_POOL_INSTANCES);
 
-    ~BufferPoolManager() {
-        delete[] pages_;
-        delete replacer_;
-    }
+    ~BufferPoolManager();
 
     /**
      * @description: 将目标页面标记为脏页
@@ -66,14 +66,22 @@ class BufferPoolManager {
      */
     static void mark_dirty(Page* page) { page->is_dirty_ = true; }
 
+    /**
+     * @description: 为批量操作创建一个访问策略，策略的生命周期由调用者管理
+     * @param {BufferAccessType} type 批量读或批量写
+     */
+    std::unique_ptr<BufferAccessStrategy> get_access_strategy(BufferAccessType type) {
+        return std::make_unique<BufferAccessStrategy>(type, num_instances_);
+    }
+
    public: 
-    Page* fetch_page(PageId page_id);
+    Page* fetch_page(PageId page_id, BufferAccessStrategy* strategy = nullptr);
 
     bool unpin_page(PageId page_id, bool is_dirty);
 
     bool flush_page(PageId page_id);
 
-    Page* new_page(PageId* page_id);
+    Page* new_page(PageId* page_id, BufferAccessStrategy* strategy = nullptr);
 
     bool delete_page(PageId page_id);
 
@@ -87,10 +95,7 @@ class BufferPoolManager {
      *
      * @return 当前bpm中空闲页的数量
      */
-    size_t get_free_size() {
-        std::scoped_lock lock(latch_);
-        return free_list_.size();
-    }
+    size_t get_free_size();
     /**
      * 创建一个临时的page (不会在磁盘中出现，只会在buffer_pool中出现)
      * @param page_id
@@ -104,10 +109,94 @@ class BufferPoolManager {
      * @return
      */
     bool unpin_tmp_page(PageId page_id);
+
+    /**
+     * @description: 在线调整buffer pool的帧数，帧数按照构造时的规则分配给各个分片，分片个数不变。
+     * 缩容时某个分片被移除的帧中还有被固定的页面，则该分片保持原来的大小，可以稍后重试
+     * @return {bool} 所有分片都调整成功时返回true
+     * @param {size_t} pool_size 新的帧数，不少于分片个数
+     */
+    bool resize(size_t pool_size);
+
+    size_t get_pool_size() const { return pool_size_.load(std::memory_order_relaxed); }
+
+    /**
+     * @description: 修改页面大小并重新申请所有分片的帧，buffer pool占用的内存保持不变。
+     * 只能在打开数据库之前、没有其他线程访问buffer pool时调用，此时后台写线程和预读线程都还没有启动
+     * @return {bool} buffer pool中还有页面时不能修改，返回false
+     * @param {int} page_size 新的页面大小，需要满足is_valid_page_size
+     */
+    bool set_page_size(int page_size);
+
+    /**
+     * @description: 页面大小必须是DEFAULT_PAGE_SIZE到MAX_PAGE_SIZE之间的2的幂，直接I/O要求页面按4KB对齐
+     */
+    static bool is_valid_page_size(int page_size) {
+        return page_size >= DEFAULT_PAGE_SIZE && page_size <= MAX_PAGE_SIZE && (page_size & (page_size - 1)) == 0;
+    }
+
+    /**
+     * @description: 连接算子可以占用的临时页个数，随buffer pool的大小变化
+     */
+    size_t get_join_pool_size() const { return get_pool_size() / JOIN_POOL_RATIO; }
+
+    size_t get_num_instances() const { return num_instances_; }
+
+    /**
+     * @description: 启动后台写线程，它在页面被淘汰之前把即将被淘汰的脏页写回磁盘，
+     * 使fetch_page缺页时通常能找到干净的帧，不需要在分片的latch内同步写盘
+     */
+    void start_background_writer();
+
+    /**
+     * @description: 停止后台写线程并等待其退出，关闭数据文件之前必须先调用
+     */
+    void stop_background_writer();
+
+    /**
+     * @description: 把buffer pool中驻留的页面按从热到冷的顺序写入清单文件，记录文件名和页号，
+     * 下次打开数据库时可以据此预读，避免buffer pool只能靠随机的单页读取慢慢预热
+     * @param {string&} path 清单文件的路径
+     */
+    void save_manifest(const std::string &path);
+
+    /**
+     * @description: 读取清单文件并启动预读线程。预读线程把清单中的页面按文件和页号排序后合并为大块的顺序读，
+     * 只装入空闲帧，不淘汰已有的页面；同时记住清单路径，之后由后台写线程定期更新清单
+     * @param {string&} path 清单文件的路径，文件不存在或格式不正确时不预读
+     */
+    void start_prefetch(const std::string &path);
+
+    /**
+     * @description: 停止预读线程并等待其退出，关闭或删除文件之前必须先调用
+     */
+    void stop_prefetch();
+
+    /**
+     * @description: 游标访问page_id之前调用。判定为顺序访问时，在page_id之后维持一个预读窗口，
+     * 把窗口中不在buffer pool里的页面用多页的分散读直接读入预留的帧，之后的fetch_page就不会缺页
+     * @param {ReadAheadState*} state 游标的预读状态
+     * @param {PageId} page_id 游标即将访问的页面
+     * @param {page_id_t} end_page_no 预读不超过该页面，通常是文件的页面数
+     * @param {BufferAccessStrategy*} strategy 游标的访问策略，不为nullptr时预读的页面也只占用其环形缓冲区
+     */
+    void read_ahead(ReadAheadState *state, PageId page_id, page_id_t end_page_no,
+                    BufferAccessStrategy *strategy = nullptr);
+
    private:
-    bool find_victim_page(frame_id_t* frame_id);
+    void background_writer();
+
+    void read_pages_ahead(int fd, page_id_t first_page_no, int num_pages, BufferAccessStrategy *strategy);
+
+    void prefetch(std::vector<PageId> page_ids);
+
+    size_t get_instance_size(size_t pool_size, size_t index) const {
+        // 帧数不能整除时，前面的分片各多分一个帧
+        return pool_size / num_instances_ + (index < pool_size % num_instances_ ? 1 : 0);
+    }
 
-    void update_page(Page* page, PageId new_page_id, frame_id_t new_frame_id);
+    // 分片内的页表使用哈希值的低位定位槽位，这里使用高32位选择分片，避免同一分片内的页面低位相同
+    size_t get_instance_index(PageId page_id) const { return (PageIdHash()(page_id) >> 32) % num_instances_; }
 
-    LogManager* log_manager_;
+    BufferPoolInstance* get_instance(PageId page_id) { return instances_[get_instance_index(page_id)].get(); }
 };
\ No newline at end of file
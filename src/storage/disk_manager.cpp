@@ -11,11 +11,34 @@ See the Mulan PSL v2 for more details. */
 #include "storage/disk_manager.h"
 
 #include <cassert>    // for assert
+#include <climits>    // for IOV_MAX
 #include <cstring>    // for memset
 #include <sys/stat.h>  // for stat
-#include <unistd.h>    // for lseek
+#include <sys/uio.h>   // for preadv, pwritev
+#include <fcntl.h>     // for fallocate
+#include <unistd.h>    // for lseek, ftruncate, fdatasync
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <memory>
 
 #include "defs.h"
+#include "storage/io_engine.h"
+
+/* 直接I/O要求缓冲区按逻辑块大小对齐，这里统一按PAGE_SIZE对齐 */
+static bool is_aligned(const char *buffer) { return reinterpret_cast<uintptr_t>(buffer) % PAGE_SIZE == 0; }
+
+/**
+ * @description: 每个线程一个按页面对齐的中转缓冲区，用于直接I/O时不对齐或者不足一页的读写，按最大的页面大小申请
+ */
+static char *get_bounce_buffer() {
+    struct alignas(MAX_PAGE_SIZE) AlignedPage {
+        char data[MAX_PAGE_SIZE];
+    };
+    thread_local std::unique_ptr<AlignedPage> bounce = std::make_unique<AlignedPage>();
+    return bounce->data;
+}
 
 DiskManager::DiskManager() { memset(fd2pageno_, 0, MAX_FD * (sizeof(std::atomic<page_id_t>) / sizeof(char))); }
 
@@ -32,11 +55,231 @@ void DiskManager::write_page(int fd, page_id_t page_no, const char *offset, int
     // 2.调用write()函数
     // 注意write返回值与num_bytes不等时 throw InternalError("DiskManager::write_page Error");
     //偏移量应该乘上PAGE_SIZE
-    if(lseek(fd,page_no*PAGE_SIZE,SEEK_SET) == -1) return;//定位到文件头并且判断是否成功
-    ssize_t res = write(fd,offset,num_bytes);//调用write()函数
+    // buffer pool的各个分片和后台写线程会并发读写同一个文件，lseek+write之间文件偏移量可能被其他线程修改，
+    // 因此使用pwrite一次完成定位和写入
+    if(fd_direct_[fd] && (num_bytes != PAGE_SIZE || !is_aligned(offset))) {
+        write_page_direct(fd, page_no, offset, num_bytes);
+        return;
+    }
+    ssize_t res = pwrite(fd,offset,num_bytes,static_cast<off_t>(page_no)*PAGE_SIZE);
     if(res != num_bytes) throw InternalError("DiskManager::write_page Error");//判断是否写入成功
 }
 
+/**
+ * @description: 以O_DIRECT打开的文件只能按对齐的整页读写。不足一页的写入先读出整页，覆盖前num_bytes字节后再整页写回，
+ *               保持页面其余部分的内容与普通I/O时一致
+ */
+void DiskManager::write_page_direct(int fd, page_id_t page_no, const char *offset, int num_bytes) {
+    char *bounce = get_bounce_buffer();
+    if (num_bytes < PAGE_SIZE) {
+        ssize_t res = pread(fd, bounce, PAGE_SIZE, static_cast<off_t>(page_no) * PAGE_SIZE);
+        if (res < 0) {
+            throw InternalError("DiskManager::write_page Error");
+        }
+        // 页面还不在文件中或者只有一部分，剩余的部分补0
+        memset(bounce + res, 0, PAGE_SIZE - res);
+    }
+    memcpy(bounce, offset, num_bytes);
+    ssize_t res = pwrite(fd, bounce, PAGE_SIZE, static_cast<off_t>(page_no) * PAGE_SIZE);
+    if (res != PAGE_SIZE) {
+        throw InternalError("DiskManager::write_page Error");
+    }
+}
+
+void DiskManager::read_page_direct(int fd, page_id_t page_no, char *offset, int num_bytes) {
+    char *bounce = get_bounce_buffer();
+    ssize_t res = pread(fd, bounce, PAGE_SIZE, static_cast<off_t>(page_no) * PAGE_SIZE);
+    if (res < num_bytes) {
+        throw InternalError("DiskManager::read_page Error");
+    }
+    memcpy(offset, bounce, num_bytes);
+}
+
+/**
+ * @description: 把编号连续的多个页面写入文件，每次pwritev最多提交IOV_MAX个页面，部分写入时继续写剩余的部分
+ * @param {int} fd 磁盘文件的文件句柄
+ * @param {page_id_t} first_page_no 第一个页面的编号
+ * @param {char* const*} pages 各个页面的数据
+ * @param {int} num_pages 页面个数
+ */
+void DiskManager::write_pages(int fd, page_id_t first_page_no, char *const *pages, int num_pages) {
+    struct iovec iov[IOV_MAX];
+    int done = 0;
+    while (done < num_pages) {
+        int cnt = std::min(num_pages - done, IOV_MAX);
+        for (int i = 0; i < cnt; i++) {
+            iov[i].iov_base = pages[done + i];
+            iov[i].iov_len = PAGE_SIZE;
+        }
+        off_t offset = static_cast<off_t>(first_page_no + done) * PAGE_SIZE;
+        ssize_t res = pwritev(fd, iov, cnt, offset);
+        if (res <= 0 || res % PAGE_SIZE != 0) {
+            throw InternalError("DiskManager::write_pages Error");
+        }
+        done += static_cast<int>(res / PAGE_SIZE);
+    }
+}
+
+void DiskManager::sync_file(int fd) {
+    if (fdatasync(fd) != 0) {
+        throw UnixError();
+    }
+}
+
+/**
+ * @description: 从文件中连续读取多个页面到buffer中
+ * @return {int} 实际读到的完整页面个数，读到文件末尾时少于num_pages，读取失败时返回-1
+ * @param {int} fd 磁盘文件的文件句柄
+ * @param {page_id_t} first_page_no 第一个页面的编号
+ * @param {char*} buffer 存放页面数据，至少num_pages * PAGE_SIZE字节
+ * @param {int} num_pages 页面个数
+ */
+int DiskManager::read_pages(int fd, page_id_t first_page_no, char *buffer, int num_pages) {
+    size_t total = static_cast<size_t>(num_pages) * PAGE_SIZE;
+    size_t done = 0;
+    while (done < total) {
+        ssize_t res = pread(fd, buffer + done, total - done, static_cast<off_t>(first_page_no) * PAGE_SIZE + done);
+        if (res < 0) {
+            return -1;
+        }
+        if (res == 0) {
+            break;
+        }
+        done += res;
+    }
+    return static_cast<int>(done / PAGE_SIZE);
+}
+
+/**
+ * @description: 从文件中连续读取多个页面，分别放入各自的缓冲区，每次preadv最多读取IOV_MAX个页面
+ * @return {int} 实际读到的完整页面个数，读到文件末尾时少于num_pages，读取失败时返回-1
+ * @param {int} fd 磁盘文件的文件句柄
+ * @param {page_id_t} first_page_no 第一个页面的编号
+ * @param {char* const*} pages 各个页面的缓冲区，每个PAGE_SIZE字节
+ * @param {int} num_pages 页面个数
+ */
+int DiskManager::read_pages(int fd, page_id_t first_page_no, char *const *pages, int num_pages) {
+    struct iovec iov[IOV_MAX];
+    int done = 0;
+    while (done < num_pages) {
+        int cnt = std::min(num_pages - done, IOV_MAX);
+        for (int i = 0; i < cnt; i++) {
+            iov[i].iov_base = pages[done + i];
+            iov[i].iov_len = PAGE_SIZE;
+        }
+        ssize_t res = preadv(fd, iov, cnt, static_cast<off_t>(first_page_no + done) * PAGE_SIZE);
+        if (res < 0) {
+            return -1;
+        }
+        done += static_cast<int>(res / PAGE_SIZE);
+        if (res % PAGE_SIZE != 0 || res == 0) {
+            // 读到了文件末尾，最后一个不完整的页面不算
+            break;
+        }
+    }
+    return done;
+}
+
+/**
+ * @description: 通过当前线程的IoEngine并发写入多段连续页面，同时在途的请求数不超过队列深度。
+ *               每段按IOV_MAX拆分成若干个pwritev请求，没有完整写入的请求改用write_pages同步重写
+ * @param {vector<PageWrite>&} writes 要写入的各段页面
+ */
+void DiskManager::write_pages_batch(const std::vector<PageWrite> &writes) {
+    struct Piece {
+        int fd;
+        page_id_t first_page_no;
+        char *const *pages;
+        int num_pages;
+        size_t iov_begin;
+    };
+    std::vector<Piece> pieces;
+    std::vector<struct iovec> iovs;
+    for (auto &write : writes) {
+        for (int done = 0; done < write.num_pages; done += IOV_MAX) {
+            int cnt = std::min(write.num_pages - done, IOV_MAX);
+            pieces.push_back(Piece{write.fd, write.first_page_no + done, write.pages + done, cnt, iovs.size()});
+            for (int i = 0; i < cnt; i++) {
+                iovs.push_back(iovec{write.pages[done + i], static_cast<size_t>(PAGE_SIZE)});
+            }
+        }
+    }
+    IoEngine *engine = IoEngine::get_local();
+    std::vector<IoEngine::Completion> completions;
+    size_t next = 0;
+    size_t in_flight = 0;
+    while (next < pieces.size() || in_flight > 0) {
+        while (next < pieces.size() && in_flight < engine->get_queue_depth()) {
+            Piece &piece = pieces[next];
+            engine->prep_writev(piece.fd, static_cast<off_t>(piece.first_page_no) * PAGE_SIZE, &iovs[piece.iov_begin],
+                                piece.num_pages, next);
+            next++;
+            in_flight++;
+        }
+        engine->submit();
+        completions.clear();
+        engine->wait(&completions, 1);
+        for (auto &completion : completions) {
+            in_flight--;
+            Piece &piece = pieces[completion.user_data];
+            if (completion.result != static_cast<ssize_t>(piece.num_pages) * PAGE_SIZE) {
+                write_pages(piece.fd, piece.first_page_no, piece.pages, piece.num_pages);
+            }
+        }
+    }
+}
+
+/**
+ * @description: 通过当前线程的IoEngine并发读取多段连续页面，同时在途的请求数不超过队列深度。
+ *               超过IOV_MAX个页面的分散读取和没有读满的请求改用read_pages同步读取，以区分文件末尾和读取失败
+ * @param {vector<PageRead>*} reads 要读取的各段页面，读到的页面数写入num_read
+ */
+void DiskManager::read_pages_batch(std::vector<PageRead> *reads) {
+    // 分散读取的请求需要的iovec数组在请求完成之前必须保持有效
+    std::vector<size_t> iov_begins(reads->size());
+    std::vector<struct iovec> iovs;
+    for (size_t i = 0; i < reads->size(); i++) {
+        PageRead &read = (*reads)[i];
+        iov_begins[i] = iovs.size();
+        if (read.pages != nullptr) {
+            for (int j = 0; j < std::min(read.num_pages, IOV_MAX); j++) {
+                iovs.push_back(iovec{read.pages[j], static_cast<size_t>(PAGE_SIZE)});
+            }
+        }
+    }
+    IoEngine *engine = IoEngine::get_local();
+    std::vector<IoEngine::Completion> completions;
+    size_t next = 0;
+    size_t in_flight = 0;
+    while (next < reads->size() || in_flight > 0) {
+        while (next < reads->size() && in_flight < engine->get_queue_depth()) {
+            PageRead &read = (*reads)[next];
+            off_t offset = static_cast<off_t>(read.first_page_no) * PAGE_SIZE;
+            if (read.pages != nullptr) {
+                engine->prep_readv(read.fd, offset, &iovs[iov_begins[next]], std::min(read.num_pages, IOV_MAX), next);
+            } else {
+                engine->prep_read(read.fd, offset, read.buffer, static_cast<size_t>(read.num_pages) * PAGE_SIZE, next);
+            }
+            next++;
+            in_flight++;
+        }
+        engine->submit();
+        completions.clear();
+        engine->wait(&completions, 1);
+        for (auto &completion : completions) {
+            in_flight--;
+            PageRead &read = (*reads)[completion.user_data];
+            if (completion.result == static_cast<ssize_t>(read.num_pages) * PAGE_SIZE) {
+                read.num_read = read.num_pages;
+            } else if (read.pages != nullptr) {
+                read.num_read = read_pages(read.fd, read.first_page_no, read.pages, read.num_pages);
+            } else {
+                read.num_read = read_pages(read.fd, read.first_page_no, read.buffer, read.num_pages);
+            }
+        }
+    }
+}
+
 /**
  * @description: 读取文件中指定编号的页面中的部分数据到内存中
  * @param {int} fd 磁盘文件的文件句柄
@@ -50,13 +293,17 @@ void DiskManager::read_page(int fd, page_id_t page_no, char *offset, int num_byt
     // 2.调用read()函数
     // 注意read返回值与num_bytes不等时，throw InternalError("DiskManager::read_page Error");
     //偏移量应该乘上PAGE_SIZE
-    if(lseek(fd,page_no*PAGE_SIZE,SEEK_SET) == -1) return;//定位到文件头并且判断是否成功
-    ssize_t res = read(fd,offset,num_bytes);//调用read()函数
+    if(fd_direct_[fd] && (num_bytes != PAGE_SIZE || !is_aligned(offset))) {
+        read_page_direct(fd, page_no, offset, num_bytes);
+        return;
+    }
+    ssize_t res = pread(fd,offset,num_bytes,static_cast<off_t>(page_no)*PAGE_SIZE);//与write_page相同，使用pread
     if(res != num_bytes) throw InternalError("DiskManager::read_page Error");//判断是否读取成功
 }
 
 /**
- * @description: 分配一个新的页号
+ * @description: 分配一个新的页号。文件按区(extent)预先扩展，分配到的页面在文件中一定存在，
+ *               还没有写入过的页面读出来是全0，因此新页面不需要立即写入磁盘
  * @return {page_id_t} 分配的新页号
  * @param {int} fd 指定文件的文件句柄
  */
@@ -64,11 +311,40 @@ page_id_t DiskManager::allocate_page(int fd) {
     // 简单的自增分配策略，指定文件的页面编号加1
     assert(fd >= 0 && fd < MAX_FD);
     // check(AntiO2) 是否需要持久化file handle
-    return fd2pageno_[fd]++;
+    page_id_t page_no = fd2pageno_[fd]++;
+    if (page_no >= fd2extent_end_[fd].load(std::memory_order_acquire)) {
+        extend_file(fd, page_no);
+    }
+    return page_no;
 }
 
-void DiskManager::deallocate_page(__attribute__((unused)) page_id_t page_id) {
-    // fd2pageno_[page_id];
+/**
+ * @description: 把文件扩展到包含page_no，每次扩展一个区，区的大小与文件当前大小相同，限制在
+ * [EXTENT_MIN_PAGES, EXTENT_MAX_PAGES]之间。优先用fallocate预留磁盘空间，使之后的写入不需要再分配块；
+ * 文件系统不支持fallocate时用ftruncate扩展文件大小，空洞读出来同样是全0
+ * @param {int} fd 文件句柄
+ * @param {page_id_t} page_no 需要包含的页面
+ */
+void DiskManager::extend_file(int fd, page_id_t page_no) {
+    std::scoped_lock<std::mutex> lock(extent_latch_);
+    page_id_t end = fd2extent_end_[fd].load(std::memory_order_relaxed);
+    if (page_no < end) {
+        // 其他线程已经扩展过
+        return;
+    }
+    page_id_t extent = std::clamp<page_id_t>(end, EXTENT_MIN_PAGES, EXTENT_MAX_PAGES);
+    page_id_t new_end = std::max(end + extent, page_no + 1);
+    off_t offset = static_cast<off_t>(end) * PAGE_SIZE;
+    off_t len = static_cast<off_t>(new_end - end) * PAGE_SIZE;
+    if (fallocate(fd, 0, offset, len) != 0) {
+        if (errno != EOPNOTSUPP && errno != ENOSYS) {
+            throw UnixError();
+        }
+        if (ftruncate(fd, offset + len) != 0) {
+            throw UnixError();
+        }
+    }
+    fd2extent_end_[fd].store(new_end, std::memory_order_release);
 }
 
 bool DiskManager::is_dir(const std::string& path) {
@@ -136,11 +412,13 @@ void DiskManager::destroy_file(const std::string &path) {
         throw FileNotFoundError(path.c_str());
     }
 
+    std::unique_lock<std::mutex> lock(files_latch_);
     std::unordered_map<std::string,int>::iterator iter;
     iter = path2fd_.find(path);
     if(iter != path2fd_.end() && iter->second != -1 ) {
         throw FileNotClosedError(path);//说明已经打开还未关闭
     }
+    lock.unlock();
     if( unlink(path.c_str())==-1) throw std::runtime_error("删除文件失败！");
 }
 
@@ -154,15 +432,31 @@ int DiskManager::open_file(const std::string &path) {
     // Todo:
     // 调用open()函数，使用O_RDWR模式
     // 注意不能重复打开相同文件，并且需要更新文件打开列表
+    std::scoped_lock<std::mutex> lock(files_latch_);
     std::unordered_map<std::string,int>::iterator iter;
     iter = path2fd_.find(path);
     if(iter != path2fd_.end() && iter->second != -1 ) {
         throw FileNotClosedError(path); // 说明已经打开
     }
-    int fd = open(path.c_str(), O_RDWR);//否则打开
+    // 日志按字节追加写入，不使用直接I/O
+    bool direct = direct_io_ && path != LOG_FILE_NAME;
+    int fd = open(path.c_str(), O_RDWR | (direct ? O_DIRECT : 0));//否则打开
+    if(fd==-1 && direct && errno == EINVAL) {
+        // 文件系统不支持O_DIRECT
+        direct = false;
+        fd = open(path.c_str(), O_RDWR);
+    }
     if(fd==-1)  {
         throw FileNotFoundError(path); // 打开失败
     }
+    fd_direct_[fd] = direct;
+    // 文件末尾已有的空间可以直接用来分配页面
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw UnixError();
+    }
+    fd2extent_end_[fd] = static_cast<page_id_t>(st.st_size / PAGE_SIZE);
     //更新文件打开列表
     path2fd_[path] = fd;
     fd2path_[fd] = path;
@@ -177,6 +471,7 @@ void DiskManager::close_file(int fd) {
     // Todo:
     // 调用close()函数
     // 注意不能关闭未打开的文件，并且需要更新文件打开列表
+    std::scoped_lock<std::mutex> lock(files_latch_);
     std::unordered_map<int,std::string>::iterator iter;
     iter = fd2path_.find(fd);
     if(iter == fd2path_.end() || iter->second.empty())
@@ -208,6 +503,7 @@ int DiskManager::get_file_size(const std::string &file_name) {
  * @param {int} fd 文件句柄
  */
 std::string DiskManager::get_file_name(int fd) {
+    std::scoped_lock<std::mutex> lock(files_latch_);
     if (!fd2path_.count(fd)) {
         throw FileNotOpenError(fd);
     }
@@ -220,10 +516,22 @@ std::string DiskManager::get_file_name(int fd) {
  * @param {string} &file_name 文件名
  */
 int DiskManager::get_file_fd(const std::string &file_name) {
-    if (!path2fd_.count(file_name)) {
+    int fd = get_open_file_fd(file_name);
+    if (fd == -1) {
         return open_file(file_name);
     }
-    return path2fd_[file_name];
+    return fd;
+}
+
+/**
+ * @description:  获得已经打开的文件的文件句柄，不会打开文件
+ * @return {int} 文件句柄，文件没有打开时返回-1
+ * @param {string} &file_name 文件名
+ */
+int DiskManager::get_open_file_fd(const std::string &file_name) {
+    std::scoped_lock<std::mutex> lock(files_latch_);
+    auto iter = path2fd_.find(file_name);
+    return iter == path2fd_.end() ? -1 : iter->second;
 }
 
 
@@ -17,8 +17,10 @@ See the Mulan PSL v2 for more details. */
 #include <atomic>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "common/config.h"
 #include "errors.h"  
@@ -28,6 +30,23 @@ See the Mulan PSL v2 for more details. */
  */
 class DiskManager {
    public:
+    /* 一次批量I/O中的一段编号连续的页面 */
+    struct PageWrite {
+        int fd;
+        page_id_t first_page_no;
+        char *const *pages;  // 各个页面的数据
+        int num_pages;
+    };
+
+    struct PageRead {
+        int fd;
+        page_id_t first_page_no;
+        char *buffer;                   // 至少num_pages * PAGE_SIZE字节，pages不为nullptr时不使用
+        int num_pages;
+        int num_read;                   // 输出，与read_pages的返回值相同
+        char *const *pages = nullptr;   // 不为nullptr时把各个页面分别读入pages[i]
+    };
+
     explicit DiskManager();
 
     ~DiskManager() = default;
@@ -36,9 +55,30 @@ class DiskManager {
 
     void read_page(int fd, page_id_t page_no, char *offset, int num_bytes);
 
-    page_id_t allocate_page(int fd);
+    /**
+     * @description: 把编号连续的多个页面用pwritev一次写入文件
+     * @param {int} fd 磁盘文件的文件句柄
+     * @param {page_id_t} first_page_no 第一个页面的编号
+     * @param {char* const*} pages 各个页面的数据，每个页面PAGE_SIZE字节
+     * @param {int} num_pages 页面个数
+     */
+    void write_pages(int fd, page_id_t first_page_no, char *const *pages, int num_pages);
+
+    /**
+     * @description: 把文件中已经写入的数据持久化到磁盘
+     * @param {int} fd 磁盘文件的文件句柄
+     */
+    void sync_file(int fd);
+
+    int read_pages(int fd, page_id_t first_page_no, char *buffer, int num_pages);
+
+    int read_pages(int fd, page_id_t first_page_no, char *const *pages, int num_pages);
 
-    void deallocate_page(page_id_t page_id);
+    void write_pages_batch(const std::vector<PageWrite> &writes);
+
+    void read_pages_batch(std::vector<PageRead> *reads);
+
+    page_id_t allocate_page(int fd);
 
     /*目录操作*/
     bool is_dir(const std::string &path);
@@ -56,6 +96,21 @@ class DiskManager {
 
     int open_file(const std::string &path);
 
+    /**
+     * @description: 开启后新打开的数据文件使用O_DIRECT，页面不再同时缓存在内核的page cache中，
+     * 日志文件仍然使用普通的带缓冲的I/O。直接I/O要求缓冲区按PAGE_SIZE对齐：buffer pool的帧满足这个要求，
+     * write_page/read_page遇到不对齐的缓冲区或者不足一页的读写时经过对齐的中转缓冲区，批量接口的缓冲区必须对齐
+     * @param {bool} direct_io 是否使用直接I/O，只影响之后打开的文件
+     */
+    void set_direct_io(bool direct_io) { direct_io_ = direct_io; }
+
+    bool is_direct_io() const { return direct_io_; }
+
+    /**
+     * @description: 文件是否以O_DIRECT打开，文件系统不支持O_DIRECT时退化为普通I/O
+     */
+    bool is_direct_fd(int fd) const { return fd_direct_[fd]; }
+
     int reset_file(const std::string &path);
 
     void close_file(int fd);
@@ -66,6 +121,8 @@ class DiskManager {
 
     int get_file_fd(const std::string &file_name);
 
+    int get_open_file_fd(const std::string &file_name);
+
     /*日志操作*/
     int read_log(char *log_data, int size, int offset);
 
@@ -91,12 +148,23 @@ class DiskManager {
 
     static constexpr int MAX_FD = 8192;
 public:
-    // 文件打开列表，用于记录文件是否被打开
+    // 文件打开列表，用于记录文件是否被打开，后台线程也会查询，修改和查询时需要持有files_latch_
+    std::mutex files_latch_;
     std::unordered_map<std::string, int> path2fd_;  //<Page文件磁盘路径,Page fd>哈希表
     std::unordered_map<int, std::string> fd2path_;  //<Page fd,Page文件磁盘路径>哈希表
 
 private:
 
+    void write_page_direct(int fd, page_id_t page_no, const char *offset, int num_bytes);
+
+    void read_page_direct(int fd, page_id_t page_no, char *offset, int num_bytes);
+
+    void extend_file(int fd, page_id_t page_no);
+
     int log_fd_ = -1;                             // WAL日志文件的文件句柄，默认为-1，代表未打开日志文件
     std::atomic<page_id_t> fd2pageno_[MAX_FD]{};  // 文件中已经分配的页面个数，初始值为0
+    bool direct_io_ = false;                      // 新打开的数据文件是否使用O_DIRECT
+    bool fd_direct_[MAX_FD]{};                    // 文件是否以O_DIRECT打开，在open_file返回fd之前设置
+    std::atomic<page_id_t> fd2extent_end_[MAX_FD]{};  // 文件已经扩展到的页面数，在open_file返回fd之前设置
+    std::mutex extent_latch_;                     // 扩展文件时持有，避免多个线程同时扩展同一个文件
 };
\ No newline at end of file
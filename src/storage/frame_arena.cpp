@@ -0,0 +1,94 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "frame_arena.h"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "errors.h"
+
+FrameArena::FrameArena(size_t num_frames) : frame_size_(PAGE_SIZE) {
+    size_t bytes = num_frames * frame_size_;
+    size_ = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    if (size_ == 0) {
+        return;
+    }
+#ifdef MAP_HUGETLB
+    // hugetlbfs的大页需要预留，不足一个大页的arena没有必要占用一整个大页
+    if (BUFFER_POOL_USE_HUGETLB && bytes >= HUGE_PAGE_SIZE) {
+        void *addr = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (addr != MAP_FAILED) {
+            data_ = static_cast<char *>(addr);
+            hugetlb_ = true;
+            return;
+        }
+    }
+#endif
+    // 多映射一个大页的空间，截掉首尾多余的部分，得到2MB对齐的区域
+    size_t map_size = size_ + HUGE_PAGE_SIZE;
+    void *addr = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+        throw UnixError();
+    }
+    auto base = reinterpret_cast<uintptr_t>(addr);
+    uintptr_t aligned = (base + HUGE_PAGE_SIZE - 1) & ~(static_cast<uintptr_t>(HUGE_PAGE_SIZE) - 1);
+    if (aligned > base) {
+        munmap(addr, aligned - base);
+    }
+    if (base + map_size > aligned + size_) {
+        munmap(reinterpret_cast<void *>(aligned + size_), base + map_size - aligned - size_);
+    }
+    data_ = reinterpret_cast<char *>(aligned);
+#ifdef MADV_HUGEPAGE
+    // 透明大页只是建议，内核不支持时忽略错误
+    madvise(data_, size_, MADV_HUGEPAGE);
+#endif
+}
+
+FrameArena::~FrameArena() {
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+}
+
+FrameArena::FrameArena(FrameArena &&other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      frame_size_(std::exchange(other.frame_size_, 0)),
+      size_(std::exchange(other.size_, 0)),
+      hugetlb_(std::exchange(other.hugetlb_, false)) {}
+
+FrameArena &FrameArena::operator=(FrameArena &&other) noexcept {
+    if (this != &other) {
+        if (data_ != nullptr) {
+            munmap(data_, size_);
+        }
+        data_ = std::exchange(other.data_, nullptr);
+        frame_size_ = std::exchange(other.frame_size_, 0);
+        size_ = std::exchange(other.size_, 0);
+        hugetlb_ = std::exchange(other.hugetlb_, false);
+    }
+    return *this;
+}
+
+void FrameArena::release(size_t begin, size_t end) {
+    if (begin >= end || data_ == nullptr) {
+        return;
+    }
+    // hugetlbfs的大页不能部分释放，只释放完整的大页
+    size_t granularity = hugetlb_ ? HUGE_PAGE_SIZE : frame_size_;
+    size_t first = (begin * frame_size_ + granularity - 1) / granularity * granularity;
+    size_t last = end * frame_size_ / granularity * granularity;
+    if (first < last) {
+        madvise(data_ + first, last - first, MADV_DONTNEED);
+    }
+}
@@ -0,0 +1,56 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/config.h"
+
+/**
+ * @description: buffer pool帧数据所在的内存区域。帧的元数据(Page对象)单独存放，这里只保存
+ * num_frames * PAGE_SIZE字节的页面数据。内存按2MB对齐，优先使用hugetlbfs的大页，
+ * 不可用时使用普通的匿名映射并通过madvise(MADV_HUGEPAGE)请求透明大页，以减少随机访问帧时的TLB miss。
+ * 匿名映射的内存在第一次访问时才由内核分配并清零，因此创建arena不会访问整个buffer pool。
+ */
+class FrameArena {
+   public:
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    explicit FrameArena(size_t num_frames);
+
+    ~FrameArena();
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    FrameArena(FrameArena &&other) noexcept;
+    FrameArena &operator=(FrameArena &&other) noexcept;
+
+    /**
+     * @description: 第frame_no个帧的数据起始地址
+     */
+    char *get_frame(size_t frame_no) const { return data_ + frame_no * frame_size_; }
+
+    /**
+     * @description: 把[begin, end)范围内帧的物理内存归还给操作系统，这些帧再次被访问时内容为全0
+     * @param {size_t} begin 第一个帧
+     * @param {size_t} end 最后一个帧的下一个
+     */
+    void release(size_t begin, size_t end);
+
+    bool is_hugetlb() const { return hugetlb_; }
+
+   private:
+    char *data_ = nullptr;  // 2MB对齐的起始地址
+    size_t frame_size_ = 0; // 每个帧的字节数，即创建arena时的PAGE_SIZE
+    size_t size_ = 0;       // 映射的字节数，是HUGE_PAGE_SIZE的整数倍
+    bool hugetlb_ = false;  // 是否使用了hugetlbfs的大页
+};
@@ -0,0 +1,236 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "io_engine.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+
+#include "errors.h"
+
+#ifdef RMDB_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include <algorithm>
+#include <cstring>
+#endif
+
+IoEngine *IoEngine::get_local() {
+    thread_local std::unique_ptr<IoEngine> engine = create();
+    return engine.get();
+}
+
+std::unique_ptr<IoEngine> IoEngine::create(unsigned queue_depth) {
+#ifdef RMDB_HAVE_IO_URING
+    try {
+        return std::make_unique<UringIoEngine>(queue_depth);
+    } catch (RMDBError &e) {
+        // 内核不支持io_uring，或者被seccomp等机制禁止
+    }
+#endif
+    return std::make_unique<SyncIoEngine>(queue_depth);
+}
+
+/* -------------------------------- SyncIoEngine -------------------------------- */
+
+void SyncIoEngine::prep_read(int fd, off_t offset, char *buf, size_t len, uint64_t user_data) {
+    pending_.push_back(Request{RequestType::READ, fd, offset, buf, len, nullptr, 0, user_data});
+}
+
+void SyncIoEngine::prep_readv(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) {
+    pending_.push_back(Request{RequestType::READV, fd, offset, nullptr, 0, iov, iovcnt, user_data});
+}
+
+void SyncIoEngine::prep_writev(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) {
+    pending_.push_back(Request{RequestType::WRITEV, fd, offset, nullptr, 0, iov, iovcnt, user_data});
+}
+
+void SyncIoEngine::submit() {
+    for (auto &request : pending_) {
+        ssize_t res;
+        switch (request.type) {
+            case RequestType::READ:
+                res = pread(request.fd, request.buf, request.len, request.offset);
+                break;
+            case RequestType::READV:
+                res = preadv(request.fd, request.iov, request.iovcnt, request.offset);
+                break;
+            default:
+                res = pwritev(request.fd, request.iov, request.iovcnt, request.offset);
+                break;
+        }
+        completions_.push_back(Completion{request.user_data, res < 0 ? -errno : res});
+    }
+    pending_.clear();
+}
+
+void SyncIoEngine::wait(std::vector<Completion> *completions, size_t min_complete) {
+    // 请求在submit时已经完成，这里全部返回
+    completions->insert(completions->end(), completions_.begin(), completions_.end());
+    completions_.clear();
+}
+
+#ifdef RMDB_HAVE_IO_URING
+/* -------------------------------- UringIoEngine -------------------------------- */
+
+UringIoEngine::UringIoEngine(unsigned queue_depth) {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, queue_depth, &params));
+    if (ring_fd_ < 0) {
+        throw UnixError();
+    }
+    sq_entries_ = params.sq_entries;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                    IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+        sq_ring_ = nullptr;
+        close(ring_fd_);
+        throw UnixError();
+    }
+    if (single_mmap) {
+        cq_ring_ = sq_ring_;
+    } else {
+        cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                        IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED) {
+            cq_ring_ = nullptr;
+            munmap(sq_ring_, sq_ring_size_);
+            close(ring_fd_);
+            throw UnixError();
+        }
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    void *sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                      IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        if (!single_mmap) {
+            munmap(cq_ring_, cq_ring_size_);
+        }
+        munmap(sq_ring_, sq_ring_size_);
+        close(ring_fd_);
+        throw UnixError();
+    }
+    sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+    auto *sq = static_cast<char *>(sq_ring_);
+    sq_head_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    auto *cq = static_cast<char *>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+}
+
+UringIoEngine::~UringIoEngine() {
+    munmap(sqes_, sqes_size_);
+    if (cq_ring_ != sq_ring_) {
+        munmap(cq_ring_, cq_ring_size_);
+    }
+    munmap(sq_ring_, sq_ring_size_);
+    close(ring_fd_);
+}
+
+/**
+ * @description: 取得提交队列尾部的一个空闲sqe，调用者保证在途的请求数不超过队列深度
+ */
+io_uring_sqe *UringIoEngine::get_sqe() {
+    unsigned tail = *sq_tail_;
+    unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (tail - head >= sq_entries_) {
+        // 提交队列已满，先把已准备的请求交给内核
+        submit();
+    }
+    unsigned index = tail & *sq_mask_;
+    io_uring_sqe *sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+    to_submit_++;
+    return sqe;
+}
+
+void UringIoEngine::prep_read(int fd, off_t offset, char *buf, size_t len, uint64_t user_data) {
+    io_uring_sqe *sqe = get_sqe();
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->off = static_cast<uint64_t>(offset);
+    sqe->addr = reinterpret_cast<uint64_t>(buf);
+    sqe->len = static_cast<uint32_t>(len);
+    sqe->user_data = user_data;
+}
+
+void UringIoEngine::prep_readv(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) {
+    io_uring_sqe *sqe = get_sqe();
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd;
+    sqe->off = static_cast<uint64_t>(offset);
+    sqe->addr = reinterpret_cast<uint64_t>(iov);
+    sqe->len = static_cast<uint32_t>(iovcnt);
+    sqe->user_data = user_data;
+}
+
+void UringIoEngine::prep_writev(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) {
+    io_uring_sqe *sqe = get_sqe();
+    sqe->opcode = IORING_OP_WRITEV;
+    sqe->fd = fd;
+    sqe->off = static_cast<uint64_t>(offset);
+    sqe->addr = reinterpret_cast<uint64_t>(iov);
+    sqe->len = static_cast<uint32_t>(iovcnt);
+    sqe->user_data = user_data;
+}
+
+void UringIoEngine::submit() {
+    while (to_submit_ > 0) {
+        long res = syscall(__NR_io_uring_enter, ring_fd_, to_submit_, 0, 0, nullptr, 0);
+        if (res < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                continue;
+            }
+            throw UnixError();
+        }
+        to_submit_ -= static_cast<unsigned>(res);
+    }
+}
+
+void UringIoEngine::wait(std::vector<Completion> *completions, size_t min_complete) {
+    size_t num_reaped = 0;
+    while (true) {
+        unsigned head = *cq_head_;
+        unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (; head != tail; head++) {
+            io_uring_cqe *cqe = &cqes_[head & *cq_mask_];
+            completions->push_back(Completion{cqe->user_data, cqe->res});
+            num_reaped++;
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+        if (num_reaped >= min_complete) {
+            return;
+        }
+        long res = syscall(__NR_io_uring_enter, ring_fd_, 0, min_complete - num_reaped, IORING_ENTER_GETEVENTS,
+                           nullptr, 0);
+        if (res < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            throw UnixError();
+        }
+    }
+}
+#endif
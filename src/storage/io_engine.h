@@ -0,0 +1,168 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common/config.h"
+
+/**
+ * @description: 异步I/O接口。调用者先用prep_read/prep_writev准备若干个请求，再调用submit一次提交，
+ * 之后通过wait收取完成的请求；同时在途(已准备但还没有被wait收取)的请求数不能超过get_queue_depth()。
+ * 请求使用的缓冲区和iovec数组在请求完成之前必须保持有效。
+ * 一个IoEngine只能由一个线程使用，get_local()为每个线程提供一个独立的实例：
+ * 系统支持io_uring时使用io_uring，否则退化为在submit中同步执行的pread/preadv/pwritev。
+ */
+class IoEngine {
+   public:
+    /* 一个完成的请求，result与pread/preadv/pwritev的返回值含义相同，出错时为-errno */
+    struct Completion {
+        uint64_t user_data;
+        ssize_t result;
+    };
+
+    virtual ~IoEngine() = default;
+
+    /**
+     * @description: 获取当前线程的IoEngine，第一次调用时创建
+     */
+    static IoEngine *get_local();
+
+    /**
+     * @description: 创建一个IoEngine，io_uring不可用时返回同步实现
+     * @param {unsigned} queue_depth 同时在途的最大请求数
+     */
+    static std::unique_ptr<IoEngine> create(unsigned queue_depth = IO_QUEUE_DEPTH);
+
+    virtual void prep_read(int fd, off_t offset, char *buf, size_t len, uint64_t user_data) = 0;
+
+    virtual void prep_readv(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) = 0;
+
+    virtual void prep_writev(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) = 0;
+
+    /**
+     * @description: 提交所有已经准备好的请求
+     */
+    virtual void submit() = 0;
+
+    /**
+     * @description: 收取完成的请求，至少等待min_complete个请求完成
+     * @param {vector<Completion>*} completions 追加完成的请求
+     * @param {size_t} min_complete 至少需要收取的请求数，不能超过在途的请求数
+     */
+    virtual void wait(std::vector<Completion> *completions, size_t min_complete) = 0;
+
+    virtual unsigned get_queue_depth() const = 0;
+
+    virtual bool is_async() const = 0;
+};
+
+/**
+ * @description: 同步实现，submit时依次执行所有请求
+ */
+class SyncIoEngine : public IoEngine {
+   public:
+    explicit SyncIoEngine(unsigned queue_depth) : queue_depth_(queue_depth) {}
+
+    void prep_read(int fd, off_t offset, char *buf, size_t len, uint64_t user_data) override;
+
+    void prep_readv(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) override;
+
+    void prep_writev(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) override;
+
+    void submit() override;
+
+    void wait(std::vector<Completion> *completions, size_t min_complete) override;
+
+    unsigned get_queue_depth() const override { return queue_depth_; }
+
+    bool is_async() const override { return false; }
+
+   private:
+    enum class RequestType { READ, READV, WRITEV };
+
+    struct Request {
+        RequestType type;
+        int fd;
+        off_t offset;
+        char *buf;
+        size_t len;
+        const struct iovec *iov;
+        int iovcnt;
+        uint64_t user_data;
+    };
+
+    unsigned queue_depth_;
+    std::vector<Request> pending_;          // 已准备还没有提交的请求
+    std::vector<Completion> completions_;   // 已经执行完还没有被收取的请求
+};
+
+#if __has_include(<linux/io_uring.h>)
+#define RMDB_HAVE_IO_URING 1
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+/**
+ * @description: 基于io_uring的实现，直接使用io_uring_setup/io_uring_enter系统调用，不依赖liburing
+ */
+class UringIoEngine : public IoEngine {
+   public:
+    /**
+     * @description: 创建io_uring，内核不支持或者被禁止时抛出UnixError
+     */
+    explicit UringIoEngine(unsigned queue_depth);
+
+    ~UringIoEngine() override;
+
+    void prep_read(int fd, off_t offset, char *buf, size_t len, uint64_t user_data) override;
+
+    void prep_readv(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) override;
+
+    void prep_writev(int fd, off_t offset, const struct iovec *iov, int iovcnt, uint64_t user_data) override;
+
+    void submit() override;
+
+    void wait(std::vector<Completion> *completions, size_t min_complete) override;
+
+    unsigned get_queue_depth() const override { return sq_entries_; }
+
+    bool is_async() const override { return true; }
+
+   private:
+    io_uring_sqe *get_sqe();
+
+    int ring_fd_ = -1;
+    unsigned sq_entries_ = 0;
+    unsigned to_submit_ = 0;        // 已准备还没有提交的请求数
+
+    void *sq_ring_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    void *cq_ring_ = nullptr;       // 内核支持IORING_FEAT_SINGLE_MMAP时与sq_ring_相同
+    size_t cq_ring_size_ = 0;
+    io_uring_sqe *sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+
+    unsigned *sq_head_ = nullptr;
+    unsigned *sq_tail_ = nullptr;
+    unsigned *sq_mask_ = nullptr;
+    unsigned *sq_array_ = nullptr;
+    unsigned *cq_head_ = nullptr;
+    unsigned *cq_tail_ = nullptr;
+    unsigned *cq_mask_ = nullptr;
+    io_uring_cqe *cqes_ = nullptr;
+};
+#endif
@@ -25,7 +25,7 @@ struct PageId {
 
     friend bool operator==(const PageId &x, const PageId &y) { return x.fd == y.fd && x.page_no == y.page_no; }
     bool operator<(const PageId& x) const {
-        if(fd < x.fd) return true;
+        if(fd != x.fd) return fd < x.fd;
         return page_no < x.page_no;
     }
 
@@ -33,19 +33,29 @@ struct PageId {
         return "{fd: " + std::to_string(fd) + " page_no: " + std::to_string(page_no) + "}"; 
     }
 
+    // fd和page_no各占32位，不同文件的页面不会冲突
     inline int64_t Get() const {
-        return (static_cast<int64_t>(fd << 16) | page_no);
+        return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(fd)) << 32) |
+                                    static_cast<uint32_t>(page_no));
     }
 };
 
-// PageId的自定义哈希算法, 用于构建unordered_map<PageId, frame_id_t, PageIdHash>
+// PageId的自定义哈希算法, 对Get()的64位值做一次完整的混合(murmur3 fmix64)，高位和低位都均匀分布
 struct PageIdHash {
-    size_t operator()(const PageId &x) const { return (x.fd << 16) | x.page_no; }
+    size_t operator()(const PageId &x) const {
+        uint64_t h = static_cast<uint64_t>(x.Get());
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
 };
 
 template <>
 struct std::hash<PageId> {
-    size_t operator()(const PageId &obj) const { return std::hash<int64_t>()(obj.Get()); }
+    size_t operator()(const PageId &obj) const { return PageIdHash()(obj); }
 };
 
 /**
@@ -54,10 +64,15 @@ struct std::hash<PageId> {
  */
 class Page {
     friend class BufferPoolManager;
+    friend class BufferPoolInstance;
 
    public:
     
-    Page() { reset_memory(); }
+    // 帧数据由BufferPoolInstance从FrameArena中分配，Page对象只保存帧的元数据
+    Page() = default;
+
+    // 不在buffer pool中的页面，数据由调用者管理，例如批量导入时在私有缓冲区中构造的页面
+    Page(const PageId &id, char *data) : id_(id), data_(data) {}
 
     ~Page() = default;
 
@@ -92,9 +107,9 @@ private:
     PageId id_;
 
     /** The actual data that is stored within a page.
-     *  该页面在bufferPool中的偏移地址
+     *  指向该帧在FrameArena中的PAGE_SIZE字节数据
      */
-    char data_[PAGE_SIZE] = {};
+    char *data_ = nullptr;
 
     /** 脏页判断 */
     bool is_dirty_ = false;
@@ -0,0 +1,121 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <vector>
+
+#include "common/config.h"
+#include "storage/page.h"
+
+/**
+ * @description: buffer pool分片使用的页表，PageId -> frame_id。
+ * 采用线性探测的开放寻址法，所有槽位存放在一块连续的数组中，命中时通常只需要访问一个cache line；
+ * 删除时使用backward shift，不留墓碑。页表中的页面数不会超过分片的帧数，
+ * 因此容量按帧数的两倍向上取2的幂，装载因子始终不超过1/2，不需要在运行中扩容。
+ * 页表本身不加锁，由所属分片的latch保护。
+ */
+class PageTable {
+   public:
+    explicit PageTable(size_t max_entries) { reset(max_entries); }
+
+    /**
+     * @description: 清空页表，并按照新的最大页面数重新分配槽位
+     * @param {size_t} max_entries 页表中最多同时存在的页面个数
+     */
+    void reset(size_t max_entries) {
+        size_t capacity = 16;
+        while (capacity < 2 * max_entries) {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, Slot{});
+        mask_ = capacity - 1;
+        size_ = 0;
+    }
+
+    /**
+     * @description: 查找页面所在的帧
+     * @return {bool} 页面在页表中则返回true
+     * @param {PageId&} page_id 目标页面
+     * @param {frame_id_t*} frame_id 返回页面所在的帧
+     */
+    bool find(const PageId &page_id, frame_id_t *frame_id) const {
+        for (size_t pos = PageIdHash()(page_id) & mask_;; pos = (pos + 1) & mask_) {
+            const Slot &slot = slots_[pos];
+            if (slot.frame_id == INVALID_FRAME_ID) {
+                return false;
+            }
+            if (slot.page_id == page_id) {
+                *frame_id = slot.frame_id;
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @description: 插入或更新页面所在的帧
+     */
+    void insert(const PageId &page_id, frame_id_t frame_id) {
+        for (size_t pos = PageIdHash()(page_id) & mask_;; pos = (pos + 1) & mask_) {
+            Slot &slot = slots_[pos];
+            if (slot.frame_id == INVALID_FRAME_ID) {
+                slot.page_id = page_id;
+                slot.frame_id = frame_id;
+                size_++;
+                return;
+            }
+            if (slot.page_id == page_id) {
+                slot.frame_id = frame_id;
+                return;
+            }
+        }
+    }
+
+    /**
+     * @description: 删除页面，并把其后同一探测序列上的元素前移填补空位
+     * @return {bool} 页面存在并被删除则返回true
+     */
+    bool erase(const PageId &page_id) {
+        size_t pos = PageIdHash()(page_id) & mask_;
+        while (true) {
+            if (slots_[pos].frame_id == INVALID_FRAME_ID) {
+                return false;
+            }
+            if (slots_[pos].page_id == page_id) {
+                break;
+            }
+            pos = (pos + 1) & mask_;
+        }
+        size_t hole = pos;
+        for (size_t next = (hole + 1) & mask_; slots_[next].frame_id != INVALID_FRAME_ID; next = (next + 1) & mask_) {
+            size_t home = PageIdHash()(slots_[next].page_id) & mask_;
+            // home不在(hole, next]之间时，元素可以移动到hole处而不会断开它的探测序列
+            if (((next - home) & mask_) >= ((next - hole) & mask_)) {
+                slots_[hole] = slots_[next];
+                hole = next;
+            }
+        }
+        slots_[hole] = Slot{};
+        size_--;
+        return true;
+    }
+
+    size_t size() const { return size_; }
+
+   private:
+    struct Slot {
+        PageId page_id;
+        frame_id_t frame_id = INVALID_FRAME_ID;  // INVALID_FRAME_ID表示空槽
+    };
+
+    std::vector<Slot> slots_;
+    size_t mask_;
+    size_t size_;
+};
@@ -0,0 +1,36 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "common/config.h"
+
+/**
+ * @description: 一个扫描游标的顺序预读状态，由游标持有，每次访问页面之前交给BufferPoolManager::read_ahead。
+ * 游标连续访问相邻的页面时判定为顺序访问；顺序扫描这类一定是顺序访问的游标可以直接给出提示。
+ * 顺序访问时在游标前方维持一个预读窗口，游标走过窗口的一半就预读下一个窗口，窗口大小每次翻倍直到上限，
+ * 访问不再连续时窗口恢复为初始大小。
+ */
+class ReadAheadState {
+    friend class BufferPoolManager;
+
+   public:
+    /**
+     * @param {bool} sequential 调用者保证按页号递增的顺序访问，不需要等待检测
+     */
+    explicit ReadAheadState(bool sequential = false) : sequential_(sequential) {}
+
+   private:
+    bool sequential_;
+    page_id_t last_page_no_ = INVALID_PAGE_ID;  // 上一次访问的页面
+    int num_sequential_ = 0;                    // 连续访问相邻页面的次数
+    int window_ = READAHEAD_MIN_PAGES;          // 下一次预读的页面数
+    page_id_t read_end_ = 0;                    // 已经预读到的页面之后的第一个页面
+};
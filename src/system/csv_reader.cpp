@@ -0,0 +1,358 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "csv_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+#include "errors.h"
+
+CsvReader::CsvReader(const std::string &file_name, std::vector<ColMeta> cols, int record_size, int num_workers)
+    : cols_(std::move(cols)), record_size_(record_size), num_workers_(num_workers) {
+    if (num_workers_ <= 0) {
+        num_workers_ = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw UnixError();
+    }
+    struct stat stat_buf;
+    if (fstat(fd, &stat_buf) != 0) {
+        close(fd);
+        throw UnixError();
+    }
+    size_ = static_cast<size_t>(stat_buf.st_size);
+    if (size_ > 0) {
+        void *addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            close(fd);
+            throw UnixError();
+        }
+        data_ = static_cast<char *>(addr);
+        madvise(data_, size_, MADV_SEQUENTIAL);
+    }
+    close(fd);
+
+    // 第一行是列名，舍弃
+    const char *end = data_ + size_;
+    const char *pos = data_ == nullptr ? end : static_cast<const char *>(memchr(data_, '\n', size_));
+    pos = pos == nullptr ? end : std::min(pos + 1, end);
+    while (pos < end) {
+        const char *chunk_end = end;
+        if (static_cast<size_t>(end - pos) > CSV_CHUNK_SIZE) {
+            auto newline = static_cast<const char *>(memchr(pos + CSV_CHUNK_SIZE, '\n', end - pos - CSV_CHUNK_SIZE));
+            chunk_end = newline == nullptr ? end : newline + 1;
+        }
+        chunks_.push_back(Chunk{pos, chunk_end});
+        pos = chunk_end;
+    }
+}
+
+CsvReader::~CsvReader() {
+    {
+        std::scoped_lock lock(latch_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+}
+
+void CsvReader::read(const std::function<void(const char *records, size_t num_records)> &consumer) {
+    int num_workers = static_cast<int>(std::min(chunks_.size(), static_cast<size_t>(num_workers_)));
+    for (int i = 0; i < num_workers; i++) {
+        workers_.emplace_back(&CsvReader::work, this);
+    }
+    for (auto &chunk : chunks_) {
+        {
+            std::unique_lock lock(latch_);
+            cv_.wait(lock, [&chunk]() { return chunk.ready; });
+        }
+        if (chunk.num_records > 0) {
+            consumer(chunk.records.data(), chunk.num_records);
+        }
+        if (chunk.error) {
+            std::rethrow_exception(chunk.error);
+        }
+        std::vector<char>().swap(chunk.records);
+        {
+            std::scoped_lock lock(latch_);
+            consumed_++;
+        }
+        cv_.notify_all();
+    }
+}
+
+/**
+ * @description: 工作线程依次领取分块进行转换，领先于调用者太多时等待
+ */
+void CsvReader::work() {
+    size_t max_pending = 2 * static_cast<size_t>(num_workers_);
+    while (true) {
+        size_t chunk_no;
+        {
+            std::unique_lock lock(latch_);
+            cv_.wait(lock, [&]() { return stop_ || next_chunk_ >= chunks_.size() || next_chunk_ < consumed_ + max_pending; });
+            if (stop_ || next_chunk_ >= chunks_.size()) {
+                return;
+            }
+            chunk_no = next_chunk_++;
+        }
+        Chunk &chunk = chunks_[chunk_no];
+        parse_chunk(&chunk);
+        {
+            std::scoped_lock lock(latch_);
+            chunk.ready = true;
+        }
+        cv_.notify_all();
+    }
+}
+
+/**
+ * @description: 转换分块中的每一行，空行跳过。某一行转换失败时记下异常，不再转换之后的行
+ */
+void CsvReader::parse_chunk(Chunk *chunk) const {
+    const char *pos = chunk->begin;
+    while (pos < chunk->end) {
+        auto newline = static_cast<const char *>(memchr(pos, '\n', chunk->end - pos));
+        const char *line_end = newline == nullptr ? chunk->end : newline;
+        const char *next = newline == nullptr ? chunk->end : newline + 1;
+        if (line_end > pos && line_end[-1] == '\r') {
+            line_end--;
+        }
+        if (line_end > pos) {
+            chunk->records.resize((chunk->num_records + 1) * record_size_);
+            try {
+                parse_line(pos, line_end, chunk->records.data() + chunk->num_records * record_size_);
+            } catch (...) {
+                chunk->error = std::current_exception();
+                return;
+            }
+            chunk->num_records++;
+        }
+        pos = next;
+    }
+}
+
+/**
+ * @description: 把一行转换成定长格式的记录
+ * @param {char*} rec 全0的记录缓冲区
+ */
+void CsvReader::parse_line(const char *begin, const char *end, char *rec) const {
+    const char *pos = begin;
+    for (size_t i = 0; i < cols_.size(); i++) {
+        auto &col = cols_[i];
+        auto comma = static_cast<const char *>(memchr(pos, ',', end - pos));
+        bool last = i + 1 == cols_.size();
+        if ((comma == nullptr) != last) {
+            throw InvalidValueCountError();
+        }
+        const char *field_end = last ? end : comma;
+        char *dest = rec + col.offset;
+        switch (col.type) {
+            case TYPE_INT: {
+                int value = parse_int(pos, field_end);
+                memcpy(dest, &value, sizeof(value));
+                break;
+            }
+            case TYPE_FLOAT: {
+                float value = parse_float(pos, field_end);
+                memcpy(dest, &value, sizeof(value));
+                break;
+            }
+            case TYPE_BIGINT: {
+                int64_t value = parse_bigint(pos, field_end);
+                memcpy(dest, &value, sizeof(value));
+                break;
+            }
+            case TYPE_DATETIME: {
+                int64_t value = parse_datetime(pos, field_end);
+                memcpy(dest, &value, sizeof(value));
+                break;
+            }
+            case TYPE_STRING: {
+                if (field_end - pos > col.len) {
+                    throw StringOverflowError();
+                }
+                memcpy(dest, pos, field_end - pos);
+                break;
+            }
+        }
+        pos = field_end + 1;
+    }
+}
+
+// 读取可选的正负号，返回是否为负
+static bool parse_sign(const char *&pos, const char *end) {
+    if (pos < end && (*pos == '-' || *pos == '+')) {
+        return *pos++ == '-';
+    }
+    return false;
+}
+
+int CsvReader::parse_int(const char *begin, const char *end) {
+    const char *pos = begin;
+    bool neg = parse_sign(pos, end);
+    int64_t value = 0;
+    if (pos == end || end - pos > 10) {
+        throw IncompatibleTypeError(coltype2str(TYPE_INT), std::string(begin, end));
+    }
+    for (; pos < end; pos++) {
+        unsigned digit = static_cast<unsigned char>(*pos) - '0';
+        if (digit > 9) {
+            throw IncompatibleTypeError(coltype2str(TYPE_INT), std::string(begin, end));
+        }
+        value = value * 10 + digit;
+    }
+    value = neg ? -value : value;
+    if (value < INT_MIN || value > INT_MAX) {
+        throw IncompatibleTypeError(coltype2str(TYPE_INT), std::string(begin, end));
+    }
+    return static_cast<int>(value);
+}
+
+int64_t CsvReader::parse_bigint(const char *begin, const char *end) {
+    const char *pos = begin;
+    bool neg = parse_sign(pos, end);
+    if (pos == end) {
+        throw IncompatibleTypeError(coltype2str(TYPE_BIGINT), std::string(begin, end));
+    }
+    uint64_t limit = neg ? static_cast<uint64_t>(INT64_MAX) + 1 : static_cast<uint64_t>(INT64_MAX);
+    uint64_t value = 0;
+    for (; pos < end; pos++) {
+        unsigned digit = static_cast<unsigned char>(*pos) - '0';
+        if (digit > 9) {
+            throw IncompatibleTypeError(coltype2str(TYPE_BIGINT), std::string(begin, end));
+        }
+        if (value > (limit - digit) / 10) {
+            throw BigintOutOfRangeError("", std::string(begin, end));
+        }
+        value = value * 10 + digit;
+    }
+    return neg ? static_cast<int64_t>(0 - value) : static_cast<int64_t>(value);
+}
+
+/**
+ * @description: 有效数字不超过2^24、10的指数不超过10时，两个操作数都能用float精确表示，
+ * 一次乘除的结果与strtof一样是正确舍入的；其他情况交给strtof
+ */
+float CsvReader::parse_float(const char *begin, const char *end) {
+    static const float pow10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    const char *pos = begin;
+    bool neg = parse_sign(pos, end);
+    uint64_t mantissa = 0;
+    int exp10 = 0;
+    int num_digits = 0;
+    bool fraction = false;
+    bool fast = true;
+    for (; pos < end; pos++) {
+        if (*pos == '.' && !fraction) {
+            fraction = true;
+            continue;
+        }
+        unsigned digit = static_cast<unsigned char>(*pos) - '0';
+        if (digit > 9) {
+            fast = false;
+            break;
+        }
+        if (mantissa >= 100000000000000000ULL) {
+            fast = false;
+            break;
+        }
+        mantissa = mantissa * 10 + digit;
+        exp10 -= fraction;
+        num_digits++;
+    }
+    if (num_digits == 0) {
+        fast = false;
+    }
+    while (fast && exp10 < 0 && mantissa != 0 && mantissa % 10 == 0) {
+        mantissa /= 10;
+        exp10++;
+    }
+    if (fast && mantissa <= (1ULL << 24) && exp10 >= -10 && exp10 <= 10) {
+        auto value = static_cast<float>(mantissa);
+        value = exp10 < 0 ? value / pow10[-exp10] : value * pow10[exp10];
+        return neg ? -value : value;
+    }
+    std::string str(begin, end);
+    char *parsed;
+    errno = 0;
+    float value = strtof(str.c_str(), &parsed);
+    if (str.empty() || parsed != str.c_str() + str.size() || errno == ERANGE) {
+        throw IncompatibleTypeError(coltype2str(TYPE_FLOAT), str);
+    }
+    return value;
+}
+
+// 读取num_digits位数字
+static bool parse_digits(const char *&pos, const char *end, int num_digits, int *value) {
+    if (end - pos < num_digits) {
+        return false;
+    }
+    *value = 0;
+    for (int i = 0; i < num_digits; i++, pos++) {
+        unsigned digit = static_cast<unsigned char>(*pos) - '0';
+        if (digit > 9) {
+            return false;
+        }
+        *value = *value * 10 + static_cast<int>(digit);
+    }
+    return true;
+}
+
+// 读取一个分隔符
+static bool parse_char(const char *&pos, const char *end, char c) {
+    if (pos == end || *pos != c) {
+        return false;
+    }
+    pos++;
+    return true;
+}
+
+/**
+ * @description: 解析YYYY-MM-DD HH:MM:SS格式的日期，与Value::set_datetime的校验规则和编码相同
+ * @return {int64_t} 按年月日时分秒依次拼接的数字
+ */
+int64_t CsvReader::parse_datetime(const char *begin, const char *end) {
+    const char *pos = begin;
+    int year, month, day, hour, minute, second;
+    bool ok = parse_digits(pos, end, 4, &year) && parse_char(pos, end, '-') && parse_digits(pos, end, 2, &month) &&
+              parse_char(pos, end, '-') && parse_digits(pos, end, 2, &day) && pos < end &&
+              isspace(static_cast<unsigned char>(*pos));
+    while (ok && pos < end && isspace(static_cast<unsigned char>(*pos))) {
+        pos++;
+    }
+    ok = ok && parse_digits(pos, end, 2, &hour) && parse_char(pos, end, ':') && parse_digits(pos, end, 2, &minute) &&
+         parse_char(pos, end, ':') && parse_digits(pos, end, 2, &second) && pos == end;
+    if (!ok || year < 1000 || month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 ||
+        second > 59 || (month == 2 && day > 29)) {
+        throw DateTimeAbsurdError("", std::string(begin, end));
+    }
+    int64_t value = year;
+    for (int part : {month, day, hour, minute, second}) {
+        value = value * 100 + part;
+    }
+    return value;
+}
@@ -0,0 +1,89 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sm_meta.h"
+
+constexpr size_t CSV_CHUNK_SIZE = 4 * 1024 * 1024;  // 每个分块的大约字节数，分块在行边界处结束
+
+/**
+ * @description: 并行读取CSV文件。文件映射到内存中，跳过第一行的列名后按行边界切分成若干分块，
+ * 工作线程把分块中的每一行转换成定长格式的记录，调用者所在的线程按文件中的顺序依次取走各个分块的记录。
+ * 同时转换完成而没有取走的分块数有上限，内存占用与文件大小无关
+ */
+class CsvReader {
+   public:
+    /**
+     * @param {string&} file_name CSV文件名
+     * @param {vector<ColMeta>&} cols 表的字段，每行的字段依次对应
+     * @param {int} record_size 记录的长度
+     * @param {int} num_workers 工作线程数，为0时使用CPU核数
+     */
+    CsvReader(const std::string &file_name, std::vector<ColMeta> cols, int record_size, int num_workers = 0);
+
+    ~CsvReader();
+
+    CsvReader(const CsvReader &) = delete;
+    CsvReader &operator=(const CsvReader &) = delete;
+
+    /**
+     * @description: 按文件中的顺序把每个分块的记录交给consumer，记录依次存放，每条record_size字节。
+     * 某一行转换失败时，该行之前的记录都已经交给consumer，随后抛出转换时的异常
+     */
+    void read(const std::function<void(const char *records, size_t num_records)> &consumer);
+
+    static int parse_int(const char *begin, const char *end);
+
+    static int64_t parse_bigint(const char *begin, const char *end);
+
+    static float parse_float(const char *begin, const char *end);
+
+    static int64_t parse_datetime(const char *begin, const char *end);
+
+   private:
+    struct Chunk {
+        const char *begin;
+        const char *end;
+        std::vector<char> records;
+        size_t num_records = 0;
+        std::exception_ptr error;
+        bool ready = false;
+    };
+
+    void work();
+
+    void parse_chunk(Chunk *chunk) const;
+
+    void parse_line(const char *begin, const char *end, char *rec) const;
+
+    std::vector<ColMeta> cols_;
+    int record_size_;
+    int num_workers_;
+    char *data_ = nullptr;      // 映射到内存中的文件
+    size_t size_ = 0;
+    std::vector<Chunk> chunks_;
+
+    std::mutex latch_;
+    std::condition_variable cv_;
+    size_t next_chunk_ = 0;     // 下一个待转换的分块
+    size_t consumed_ = 0;       // 已经取走的分块数
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
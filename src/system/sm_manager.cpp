@@ -15,6 +15,7 @@ See the Mulan PSL v2 for more details. */
 
 #include <fstream>
 
+#include "csv_reader.h"
 #include "index/ix.h"
 #include "record/rm.h"
 #include "record_printer.h"
@@ -32,8 +33,9 @@ bool SmManager::is_dir(const std::string& db_name) {
 /**
  * @description: 创建数据库，所有的数据库相关文件都放在数据库同名文件夹下
  * @param {string&} db_name 数据库名称
+ * @param {int} page_size 数据库的页面大小，记录在db.meta中，之后不能修改
  */
-void SmManager::create_db(const std::string& db_name) {
+void SmManager::create_db(const std::string& db_name, int page_size) {
     if (is_dir(db_name)) {
         throw DatabaseExistsError(db_name);
     }
@@ -48,6 +50,7 @@ void SmManager::create_db(const std::string& db_name) {
     //创建系统目录
     DbMeta *new_db = new DbMeta();
     new_db->name_ = db_name;
+    new_db->page_size_ = page_size;
 
     // 注意，此处ofstream会在当前目录创建(如果没有此文件先创建)和打开一个名为DB_META_NAME的文件
     std::ofstream ofs(DB_META_NAME);
@@ -101,11 +104,19 @@ void SmManager::open_db(const std::string& db_name) {
     // 读入ofs打开的DB_META_NAME文件，写入到db_
     ofs >> db_;
 
+    // 按数据库的页面大小重新申请buffer pool的帧，之后打开的文件都使用该页面大小
+    if (!BufferPoolManager::is_valid_page_size(db_.page_size_) ||
+        !buffer_pool_manager_->set_page_size(db_.page_size_)) {
+        throw InternalError("SmManager::open_db: cannot use page size " + std::to_string(db_.page_size_));
+    }
+
     //将数据库中包含的表 导入到当前fhs
     for (const auto &table: db_.tabs_) {
 
         auto file = rm_manager_->open_file(table.first);
         disk_manager_->set_fd2pageno(file->GetFd(), file->getFileHdr().num_pages);
+        file->get_zone_map().open(table.second.cols, file->getFileHdr().num_pages,
+                                  RmZoneMap::get_file_name(table.first));
         fhs_.emplace(table.first, std::move(file));
         const auto &indices = table.second.indexes;
         if (!INDEX_REBUILD_MODE) {
@@ -116,6 +127,9 @@ void SmManager::open_db(const std::string& db_name) {
             }
         }
     }
+
+    //3.根据上次关闭时的驻留页面清单在后台预读，预热buffer pool
+    buffer_pool_manager_->start_prefetch(BUFFER_POOL_MANIFEST_NAME);
 }
 /**
  * @description: 把数据库相关的元数据刷入磁盘中
@@ -131,12 +145,16 @@ void SmManager::flush_meta() {
  */
 void SmManager::close_db() {
     //lsy
-    //1.将数据落盘
+    //1.将数据落盘，并记录buffer pool中的驻留页面，下次打开时预读
+    buffer_pool_manager_->stop_prefetch();
+    buffer_pool_manager_->save_manifest(BUFFER_POOL_MANIFEST_NAME);
     flush_meta();
 
-    //2.关闭当前fhs_的文件及退出目录
-    for(auto &pair : fhs_)
+    //2.保存各表的zone map，关闭当前fhs_的文件及退出目录
+    for(auto &pair : fhs_) {
+        pair.second->get_zone_map().save(RmZoneMap::get_file_name(pair.first));
         rm_manager_->close_file(pair.second.get());
+    }
 
     // 回到根目录
     if (chdir("..") < 0) {
@@ -218,8 +236,10 @@ void SmManager::desc_table(const std::string& tab_name, Context* context) {
  * @param {string&} tab_name 表的名称
  * @param {vector<ColDef>&} col_defs 表的字段
  * @param {Context*} context 
+ * @param {bool} pax 是否按PAX格式存放表的数据，每个字段的值在页面中集中存放
  */
-void SmManager::create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context) {
+void SmManager::create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context,
+                             bool pax) {
     if (db_.is_table(tab_name)) {
         throw TableExistsError(tab_name);
     }
@@ -227,7 +247,15 @@ void SmManager::create_table(const std::string& tab_name, const std::vector<ColD
     int curr_offset = 0;
     TabMeta tab;
     tab.name = tab_name;
+    std::vector<RmVarCol> var_cols;
+    std::vector<RmMinipage> minipages;
     for (auto &col_def : col_defs) {
+        if (pax) {
+            minipages.push_back(RmMinipage{curr_offset, col_def.len});
+        }
+        if (col_def.var_len) {
+            var_cols.push_back(RmVarCol{curr_offset, col_def.len});
+        }
         ColMeta col = {.tab_name = tab_name,
                        .name = col_def.name,
                        .type = col_def.type,
@@ -239,10 +267,12 @@ void SmManager::create_table(const std::string& tab_name, const std::vector<ColD
     }
     // Create & open record file
     int record_size = curr_offset;  // record_size就是col meta所占的大小（表的元数据也是以记录的形式进行存储的）
-    rm_manager_->create_file(tab_name, record_size);
+    rm_manager_->create_file(tab_name, record_size, var_cols, minipages);
     db_.tabs_[tab_name] = tab;
     // fhs_[tab_name] = rm_manager_->open_file(tab_name);
-    fhs_.emplace(tab_name, rm_manager_->open_file(tab_name));
+    auto file = rm_manager_->open_file(tab_name);
+    file->get_zone_map().open(tab.cols, file->getFileHdr().num_pages, RmZoneMap::get_file_name(tab_name));
+    fhs_.emplace(tab_name, std::move(file));
 
     flush_meta();
 }
@@ -310,15 +340,12 @@ void SmManager::create_index(const std::string& tab_name, const std::vector<std:
     indexMeta.cols=index_cols;
     table.indexes.emplace_back(indexMeta);
 
-    auto table_file_handle = fhs_.find(tab_name)->second.get();
-    RmScan rm_scan(table_file_handle);
-    Transaction transaction(INVALID_TXN_ID); // TODO (AntiO2) 事务
-    while (!rm_scan.is_end()) {
-        auto rid = rm_scan.rid();
-        auto origin_key = table_file_handle->get_record(rid,context);
-        auto key = origin_key->key_from_rec(index_cols);
-        index_handler->insert_entry(key->data,rid, &transaction);
-        rm_scan.next();
+    try {
+        build_index(index_handler, index_cols, fhs_.find(tab_name)->second.get());
+    } catch (RMDBError &e) {
+        // 已有的记录违反唯一性时不保留建了一半的索引
+        drop_index(tab_name, col_names, context);
+        throw;
     }
     flush_meta();
 }
@@ -402,13 +429,13 @@ void SmManager::rebuild_index(const std::string &tab_name, const IndexMeta&index
 
     disk_manager_->write_page(fd, IX_FILE_HDR_PAGE, data, fhdr->tot_len_); // 将索引数据写到索引文件的第0页中（header page）
 
-    char page_buf[PAGE_SIZE];  // 在内存中初始化page_buf中的内容，然后将其写入磁盘
-    memset(page_buf, 0, PAGE_SIZE);
+    std::vector<char> page_buf(PAGE_SIZE);  // 在内存中初始化page_buf中的内容，然后将其写入磁盘
+    memset(page_buf.data(), 0, PAGE_SIZE);
     // 注意leaf header页号为1，也标记为叶子结点，其前一个/后一个叶子均指向root node
     // Create leaf list header page and write to file
     {
-        memset(page_buf, 0, PAGE_SIZE);
-        auto phdr = reinterpret_cast<IxPageHdr *>(page_buf);
+        memset(page_buf.data(), 0, PAGE_SIZE);
+        auto phdr = reinterpret_cast<IxPageHdr *>(page_buf.data());
         *phdr = {
                 .next_free_page_no = IX_NO_PAGE,
                 .parent = IX_NO_PAGE,
@@ -417,13 +444,13 @@ void SmManager::rebuild_index(const std::string &tab_name, const IndexMeta&index
                 .prev_leaf = IX_INIT_ROOT_PAGE,
                 .next_leaf = IX_INIT_ROOT_PAGE,
         };
-        disk_manager_->write_page(fd, IX_LEAF_HEADER_PAGE, page_buf, PAGE_SIZE);
+        disk_manager_->write_page(fd, IX_LEAF_HEADER_PAGE, page_buf.data(), PAGE_SIZE);
     }
     // 注意root node页号为2，也标记为叶子结点，其前一个/后一个叶子均指向leaf header
     // Create root node and write to file
     {
-        memset(page_buf, 0, PAGE_SIZE);
-        auto phdr = reinterpret_cast<IxPageHdr *>(page_buf);
+        memset(page_buf.data(), 0, PAGE_SIZE);
+        auto phdr = reinterpret_cast<IxPageHdr *>(page_buf.data());
         *phdr = {
                 .next_free_page_no = IX_NO_PAGE,
                 .parent = IX_NO_PAGE,
@@ -433,7 +460,7 @@ void SmManager::rebuild_index(const std::string &tab_name, const IndexMeta&index
                 .next_leaf = IX_LEAF_HEADER_PAGE,
         };
         // Must write PAGE_SIZE here in case of future fetch_node()
-        disk_manager_->write_page(fd, IX_INIT_ROOT_PAGE, page_buf, PAGE_SIZE);
+        disk_manager_->write_page(fd, IX_INIT_ROOT_PAGE, page_buf.data(), PAGE_SIZE);
     }
 
     disk_manager_->set_fd2pageno(fd, IX_INIT_NUM_PAGES - 1);  // DEBUG
@@ -444,89 +471,142 @@ void SmManager::rebuild_index(const std::string &tab_name, const IndexMeta&index
     // assert(ihs_.count(index_name)==0); // 确保之前没有创建过该index
     ihs_.emplace(index_name, std::make_unique<IxIndexHandle>(disk_manager_, buffer_pool_manager_, fd));
     auto index_handler = ihs_.find(index_name)->second.get();
-    auto table_file_handle = fhs_.find(tab_name)->second.get();
-    RmScan rm_scan(table_file_handle);
-    Transaction transaction(INVALID_TXN_ID);
-    while (!rm_scan.is_end()) {
-        auto rid = rm_scan.rid();
-        auto origin_key = table_file_handle->get_record(rid,context);
-        auto key = origin_key->key_from_rec(index_cols);
-        index_handler->insert_entry(key->data,rid, &transaction);
-        rm_scan.next();
-    }
+    build_index(index_handler, index_cols, fhs_.find(tab_name)->second.get());
 }
 
 //load lsy
-/**  TODO
- * @description: load data
+/**
+ * @description: load data。CsvReader在多个线程中把CSV文件转换成定长格式的记录，当前线程按文件中的顺序
+ * 通过RmBulkLoader把记录整页追加到表文件末尾，不逐条调用insert_record，每个索引的(key, rid)交给IxBulkBuilder，
+ * 所有记录读完后先检查每个索引的key是否重复，检查都通过后才更新表文件头并写入索引，空索引自底向上构建；
+ * 某一行转换失败或者key重复时表和索引都不变。批量导入的记录不进入写集合，只用于自动提交的LOAD；
+ * 显式事务中的LOAD逐条调用insert_record并写入写集合，由事务提交或回滚。
+ * 两种方式都持有表上的排他锁，直到语句的事务提交
  * @param {string} 要读取的文件名
  * @param {string} tab_name 表名称
  * @param {Context*} context
  */
 void SmManager::load_csv(std::string file_name,std::string tab_name,Context* context){
-    //思路是借鉴insert的方式，对csv里面的每一行进行insert
-    //1.打开文件
-    std::ifstream infile;
-    infile.open(file_name);
-    if(!infile.is_open()){
-        throw UnixError();
-    }
-    //2.读取文件 第一行 是每列的列名，舍弃
-    std::string line;
-    std::vector<std::string> values;
-    std::getline(infile,line);
-    //3.对每一行进行insert
-    //去拿sm_manager
-    extern std::unique_ptr<SmManager>  sm_manager;
-    auto sm_manager_ = sm_manager.get();
-    while(std::getline(infile,line)){
-        //将values清空
-        values.clear();
-        std::stringstream ss(line);
-        std::string value;
-        while(std::getline(ss,value,',')){
-            values.push_back(value);
+    auto fh_ = fhs_.at(tab_name).get();
+    context->lock_mgr_->lock_exclusive_on_table(context->txn_, fh_->GetFd());
+    auto &tab_ = db_.get_table(tab_name);
+    auto record_size = fh_->get_file_hdr().record_size;
+    CsvReader reader(file_name, tab_.cols, record_size);
+    if (context->txn_->get_txn_mode()) {
+        auto index_handles = get_index_handles(tab_);
+        reader.read([&](const char *records, size_t num_records) {
+            for (size_t r = 0; r < num_records; r++) {
+                insert_load_record(records + r * record_size, tab_, fh_, index_handles, context);
+            }
+        });
+        return;
+    }
+    std::vector<std::unique_ptr<IxBulkBuilder>> builders;
+    for (auto index_handle : get_index_handles(tab_)) {
+        builders.emplace_back(std::make_unique<IxBulkBuilder>(index_handle));
+    }
+    RmBulkLoader loader(fh_, context, tab_name);
+    std::vector<char> key;
+    try {
+        reader.read([&](const char *records, size_t num_records) {
+            for (size_t r = 0; r < num_records; r++) {
+                const char *rec = records + r * record_size;
+                Rid rid = loader.append(rec);
+                for (size_t i = 0; i < tab_.indexes.size(); i++) {
+                    key.clear();
+                    for (auto &col : tab_.indexes[i].cols) {
+                        key.insert(key.end(), rec + col.offset, rec + col.offset + col.len);
+                    }
+                    builders[i]->add(key.data(), rid);
+                }
+            }
+        });
+        for (auto &builder : builders) {
+            builder->check();
         }
+    } catch (RMDBError &e) {
+        loader.abort();
+        throw;
+    }
+    loader.finish();
+    for (auto &builder : builders) {
+        builder->finish();
+    }
+}
 
-        //这个时候values里面就是装有每一行的所有数据了，按照从左到右的顺序，先模仿portal的操作，对insert进行初始化
-//        if(context->txn_->get_isolation_level()==IsolationLevel::SERIALIZABLE) {
-//            auto fd = sm_manager->fhs_.at(tab_name).get()->GetFd();
-//            context->lock_mgr_->lock_exclusive_on_table(context->txn_,fd);
-//        }不需要加锁
-        auto fh_ = sm_manager_->fhs_.at(tab_name).get();
-        auto tab_ = sm_manager_->db_.get_table(tab_name);
-        // Make record buffer
-        RmRecord rec(fh_->get_file_hdr().record_size);
-        //根据table里面的数据得到各个列元素的类型，从而把values数据转化为std::vector<Value> values_
-        std::vector<Value> values_;
-        for (size_t i = 0; i < values.size(); i++) {//遍历一行的数据
-            auto &col = tab_.cols[i];
-            auto &val = values[i];
-            Value value_;//根据col来初始化value
-            if(col.type==ColType::TYPE_INT) {
-                value_.set_int(std::stoi(val));//将string转化为int
-            }else if(col.type==ColType::TYPE_FLOAT) {
-                value_.set_float(std::stof(val));//将string转化为float
-            }else if(col.type==ColType::TYPE_STRING) {
-                value_.set_str(val);//将string转化为string
-            }else if(col.type==ColType::TYPE_BIGINT) {
-                value_.set_bigint(val);//将string转化为bigint
-            }else if(col.type==TYPE_DATETIME){
-                value_.set_datetime(val);
+/**
+ * @description: 显式事务中的LOAD逐条插入一条记录，与InsertExecutor一样写入写集合和日志；
+ * 表上已经持有排他锁，不再加记录锁和间隙锁。key重复时删除这条记录已插入的索引项并标记删除记录
+ * @param {char*} rec 定长格式的记录
+ * @param {TabMeta&} tab 表的元数据
+ * @param {RmFileHandle*} file_handle 表文件句柄
+ * @param {vector<IxIndexHandle*>&} index_handles 与tab.indexes一一对应的索引句柄
+ * @param {Context*} context
+ */
+void SmManager::insert_load_record(const char* rec, const TabMeta& tab, RmFileHandle* file_handle,
+                                   const std::vector<IxIndexHandle*>& index_handles, Context* context) {
+    RmRecord record(file_handle->get_file_hdr().record_size, rec);
+    std::string tab_name = tab.name;
+    auto undo_next = context->txn_->get_prev_lsn();
+    auto rid = file_handle->insert_record(record.data, context, &tab_name);
+    auto undo_write = context->txn_->get_write_set()->rbegin();
+    context->txn_->append_write_record(std::make_unique<WriteRecord>(WType::INSERT_TUPLE, tab_name, rid, undo_next));
+    for (size_t i = 0; i < tab.indexes.size(); i++) {
+        try {
+            index_handles[i]->insert_entry(record.key_from_rec(tab.indexes[i].cols)->data, rid, context->txn_);
+        } catch (IndexEntryDuplicateError &e) {
+            for (size_t j = 0; j < i; j++) {
+                index_handles[j]->delete_entry(record.key_from_rec(tab.indexes[j].cols)->data, context->txn_);
             }
-            values_.push_back(value_);//将value_放入values_中
+            undo_next = context->txn_->get_prev_lsn();
+            file_handle->mark_delete_record(rid, context, &tab_name);
+            context->txn_->append_write_record(std::make_unique<WriteRecord>(WType::CLR_DELETE, tab_name, rid, record, undo_next));
+            context->txn_->get_write_set()->back()->undo_next_write_ = undo_write;
+            throw;
         }
-        //将values_中的数据存入rec中
-        for (size_t i = 0; i < values_.size(); i++) {
-            auto &col = tab_.cols[i];
-            auto &val = values_[i];
-            val.init_raw(col.len);
-            // 将Value数据存入rec中。
-            memcpy(rec.data + col.offset, val.raw->data, col.len);
+    }
+}
+
+/**
+ * @description: 获取表上所有索引的句柄，没有打开的索引先打开
+ * @param {TabMeta&} tab 表的元数据
+ * @return {vector<IxIndexHandle*>} 与tab.indexes一一对应的索引句柄
+ */
+std::vector<IxIndexHandle*> SmManager::get_index_handles(const TabMeta& tab) {
+    std::vector<IxIndexHandle*> index_handles;
+    for(auto &index:tab.indexes) {
+        auto index_name = ix_manager_->get_index_name(tab.name,index.cols);
+        auto iter = ihs_.find(index_name);
+        if(iter==ihs_.end()) {
+            iter = ihs_.emplace(index_name,ix_manager_->open_index(index_name)).first;
+        }
+        index_handles.emplace_back(iter->second.get());
+    }
+    return index_handles;
+}
+
+/**
+ * @description: 扫描表中的所有记录，把(key, rid)交给IxBulkBuilder，排序后自底向上构建索引
+ * @param {IxIndexHandle*} index_handle 索引句柄，通常是刚创建的空索引
+ * @param {vector<ColMeta>&} index_cols 索引包含的字段
+ * @param {RmFileHandle*} file_handle 表文件句柄
+ */
+void SmManager::build_index(IxIndexHandle* index_handle, const std::vector<ColMeta>& index_cols, RmFileHandle* file_handle) {
+    IxBulkBuilder builder(index_handle);
+    auto strategy = buffer_pool_manager_->get_access_strategy(BufferAccessType::BULKREAD);
+    RmPageScan page_scan(file_handle, strategy.get());
+    RecordBatch batch;
+    std::vector<char> key;
+    // 与RmScan一样包括被标记删除的记录
+    while (page_scan.next_batch(&batch, false)) {
+        for (size_t i = 0; i < batch.size(); i++) {
+            const char *rec = batch.data(i);
+            key.clear();
+            for (auto &col : index_cols) {
+                key.insert(key.end(), rec + col.offset, rec + col.offset + col.len);
+            }
+            builder.add(key.data(), batch.rid(i));
         }
-        auto undo_next = context->txn_->get_prev_lsn();
-        // Insert into record file
-        auto rid_ = fh_->insert_record(rec.data, context,&tab_name);
-        context->txn_->append_write_record(std::make_unique<WriteRecord>(WType::INSERT_TUPLE,tab_name,rid_, undo_next));
     }
+    builder.finish();
 }
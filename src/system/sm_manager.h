@@ -24,6 +24,7 @@ struct ColDef {
     std::string name;  // Column name
     ColType type;      // Type of column
     int len;           // Length of column
+    bool var_len = false;  // 是否为VARCHAR字段，在数据文件中按实际长度存储
 };
 
 /* 系统管理器，负责元数据管理和DDL语句的执行 */
@@ -59,7 +60,7 @@ class SmManager {
 
     bool is_dir(const std::string& db_name);
 
-    void create_db(const std::string& db_name);
+    void create_db(const std::string& db_name, int page_size = DEFAULT_PAGE_SIZE);
 
     void drop_db(const std::string& db_name);
 
@@ -75,7 +76,8 @@ class SmManager {
 
     void desc_table(const std::string& tab_name, Context* context);
 
-    void create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context);
+    void create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context,
+                      bool pax = false);
 
     void drop_table(const std::string& tab_name, Context* context);
 
@@ -91,4 +93,12 @@ class SmManager {
     void setOff(Context *context);
 
     void load_csv(std::string file_name, std::string tab_name, Context *context);
+
+    std::vector<IxIndexHandle*> get_index_handles(const TabMeta& tab);
+
+   private:
+    void build_index(IxIndexHandle* index_handle, const std::vector<ColMeta>& index_cols, RmFileHandle* file_handle);
+
+    void insert_load_record(const char* rec, const TabMeta& tab, RmFileHandle* file_handle,
+                            const std::vector<IxIndexHandle*>& index_handles, Context* context);
 };
\ No newline at end of file
@@ -11,12 +11,14 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <algorithm>
+#include <cassert>
 #include <iostream>
 #include <map>
 #include <string>
 #include <vector>
 #include <numeric>
 
+#include "common/config.h"
 #include "errors.h"
 #include "sm_defs.h"
 
@@ -308,6 +310,7 @@ class DbMeta {
    private:
     std::string name_;                      // 数据库名称
     std::map<std::string, TabMeta> tabs_;   // 数据库中包含的表
+    int page_size_ = DEFAULT_PAGE_SIZE;     // 数据库所有数据文件的页面大小，创建数据库时确定
 
    public:
     // DbMeta(std::string name) : name_(name) {}
@@ -341,6 +344,7 @@ class DbMeta {
         for (auto &entry : db_meta.tabs_) {
             os << entry.second << '\n';
         }
+        os << db_meta.page_size_ << '\n';
         return os;
     }
 
@@ -352,6 +356,10 @@ class DbMeta {
             is >> tab;
             db_meta.tabs_[tab.name] = tab;
         }
+        // 页面大小写在最后，没有记录页面大小的旧数据库使用默认值
+        if (!(is >> db_meta.page_size_)) {
+            db_meta.page_size_ = DEFAULT_PAGE_SIZE;
+        }
         return is;
     }
 };
@@ -34,7 +34,7 @@ class Transaction {
         write_set_ = std::make_shared<std::deque<  std::unique_ptr<WriteRecord> >>();
         lock_set_ = std::make_shared<std::unordered_set<LockDataId>>();
         index_latch_page_set_ = std::make_shared<std::deque<Page *>>();
-        index_deleted_page_set_ = std::make_shared<std::deque<Page*>>();
+        index_deleted_page_set_ = std::make_shared<std::deque<PageId>>();
         prev_lsn_ = INVALID_LSN;
         thread_id_ = std::this_thread::get_id();
     }
@@ -62,8 +62,8 @@ class Transaction {
     inline std::shared_ptr<std::deque<  std::unique_ptr<WriteRecord> >> get_write_set() { return write_set_; }
     inline void append_write_record( std::unique_ptr<WriteRecord> write_record) { write_set_->emplace_back(std::move(write_record)); }
 
-    inline std::shared_ptr<std::deque<Page*>> get_index_deleted_page_set() { return index_deleted_page_set_; }
-    inline void append_index_deleted_page(Page* page) { index_deleted_page_set_->push_back(page); }
+    inline std::shared_ptr<std::deque<PageId>> get_index_deleted_page_set() { return index_deleted_page_set_; }
+    inline void append_index_deleted_page(PageId page_id) { index_deleted_page_set_->push_back(page_id); }
 
     inline std::shared_ptr<std::deque<Page*>> get_index_latch_page_set() { return index_latch_page_set_; }
     inline void append_index_latch_page_set(Page* page) { index_latch_page_set_->push_back(page); }
@@ -86,7 +86,7 @@ class Transaction {
     [[nodiscard]] const std::shared_ptr<std::deque<Page *>> &getIndexLatchPageSet() const {
       return index_latch_page_set_;
     }
-    [[nodiscard]] const std::shared_ptr<std::deque<Page *>> &getIndexDeletedPageSet() const {
+    [[nodiscard]] const std::shared_ptr<std::deque<PageId>> &getIndexDeletedPageSet() const {
       return index_deleted_page_set_;
     }
     [[nodiscard]] const std::shared_ptr<std::unordered_set<int>> &getSTableLockSet() const {
@@ -164,7 +164,7 @@ class Transaction {
     std::shared_ptr<std::unordered_set<LockDataId>> lock_set_;  // 事务申请的所有锁
 
     std::shared_ptr<std::deque<Page*>> index_latch_page_set_;          // 维护事务执行过程中加锁的索引页面
-    std::shared_ptr<std::deque<Page*>> index_deleted_page_set_;    // 维护事务执行过程中删除的索引页面
+    std::shared_ptr<std::deque<PageId>> index_deleted_page_set_;   // 维护事务执行过程中删除的索引页面，记录页号，页面可能已经unpin
 
     // 事务拥有的表锁
     std::shared_ptr<std::unordered_set<int>> s_table_lock_set_;
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <random>
+#include "gtest/gtest.h"
+#include "index/ix.h"
+#include "storage/buffer_pool_manager.h"
+#include "storage/disk_manager.h"
+#include "transaction/transaction.h"
+
+const std::string TEST_DB_NAME = "IxBulkBuildTest_db";  // 以TEST_DB_NAME作为存放测试文件的根目录名
+
+class IndexBulkBuildTest : public ::testing::Test {
+public:
+    std::unique_ptr<DiskManager> disk_manager_;
+    std::unique_ptr<LogManager> log_manager_;
+    std::unique_ptr<BufferPoolManager> buffer_pool_manager_;
+    std::unique_ptr<IxManager> ix_manager_;
+    std::string filename_;      // 索引所在的表名，以测试点的名字命名
+    std::vector<ColMeta> cols_; // 用于创建索引的列
+
+public:
+    void SetUp() override {
+        disk_manager_ = std::make_unique<DiskManager>();
+        if (!disk_manager_->is_dir(TEST_DB_NAME)) {
+            disk_manager_->create_dir(TEST_DB_NAME);
+        }
+        assert(disk_manager_->is_dir(TEST_DB_NAME));
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+        if (!disk_manager_->is_file(LOG_FILE_NAME)) {
+            disk_manager_->create_file(LOG_FILE_NAME);
+        }
+        log_manager_ = std::make_unique<LogManager>(disk_manager_.get());
+        buffer_pool_manager_ = std::make_unique<BufferPoolManager>(64, disk_manager_.get(), log_manager_.get(), 4);
+        ix_manager_ = std::make_unique<IxManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        filename_ = std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + "TestTable";
+        cols_ = {{filename_, "id", TYPE_INT, 4, 0}};
+        if (ix_manager_->exists(filename_, cols_)) {
+            ix_manager_->destroy_index(filename_, cols_);
+        }
+    }
+
+    void TearDown() override {
+        ix_manager_.reset();
+        buffer_pool_manager_.reset();
+        log_manager_.reset();
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+        assert(disk_manager_->is_dir(TEST_DB_NAME));
+    };
+};
+
+TEST_F(IndexBulkBuildTest, IndexBulkBuild) {
+    ix_manager_->create_index(filename_, cols_);
+    auto ih = ix_manager_->open_index(filename_, cols_);
+    Transaction txn(0);
+
+    // 打乱顺序加入，排序缓冲区很小，需要归并多个临时文件；结点填充到80%，树有三层
+    const int num_keys = 100000;
+    std::vector<int> keys(num_keys);
+    for (int i = 0; i < num_keys; i++) {
+        keys[i] = 2 * i;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+    {
+        IxBulkBuilder builder(ih.get(), 0.8, 64 * 1024);
+        for (int key : keys) {
+            builder.add(reinterpret_cast<const char *>(&key), Rid{key / 100, key % 100});
+        }
+        builder.finish();
+    }
+    const auto *hdr = ih->getFileHdr();
+    int capacity = static_cast<int>(hdr->btree_order_ * 0.8);
+    int num_leaves = (num_keys + capacity - 1) / capacity;
+    int num_inner = (num_leaves + capacity - 1) / capacity;
+    EXPECT_GT(num_inner, 1);
+    EXPECT_EQ(hdr->num_pages_, IX_INIT_NUM_PAGES + num_leaves + num_inner + 1);
+    EXPECT_EQ(hdr->root_page_, hdr->num_pages_ - 1);
+    EXPECT_EQ(hdr->first_leaf_, IX_INIT_NUM_PAGES);
+    EXPECT_EQ(hdr->first_free_page_no_, IX_INIT_ROOT_PAGE);
+
+    // 重新打开后沿叶子链表按顺序读到所有key
+    ix_manager_->close_index(ih.get());
+    ih = ix_manager_->open_index(filename_, cols_);
+    hdr = ih->getFileHdr();
+    int next = 0;
+    int leaves = 0;
+    for (int page_no = hdr->first_leaf_; page_no != IX_LEAF_HEADER_PAGE; leaves++) {
+        PageId page_id{ih->getFd(), page_no};
+        IxNodeHandle node(hdr, buffer_pool_manager_->fetch_page(page_id));
+        EXPECT_GE(node.get_size(), capacity / 2);
+        for (int i = 0; i < node.get_size(); i++, next += 2) {
+            EXPECT_EQ(node.key_at(i), next);
+        }
+        EXPECT_NE(node.get_parent_page_no(), INVALID_PAGE_ID);
+        page_no = node.get_next_leaf();
+        buffer_pool_manager_->unpin_page(page_id, false);
+    }
+    EXPECT_EQ(next, 2 * num_keys);
+    EXPECT_EQ(leaves, num_leaves);
+
+    // 构建好的树可以继续查找和插入，分裂时先复用原来的根结点页面
+    std::vector<Rid> result;
+    for (int key = 0; key < 2 * num_keys; key += 997) {
+        result.clear();
+        EXPECT_EQ(ih->get_value(reinterpret_cast<const char *>(&key), &result, &txn), key % 2 == 0);
+        if (key % 2 == 0) {
+            EXPECT_EQ(result[0], (Rid{key / 100, key % 100}));
+        }
+    }
+    for (int key = 1; key < 2 * num_keys; key += 2) {
+        ih->insert_entry(reinterpret_cast<const char *>(&key), Rid{key / 100, key % 100}, &txn);
+    }
+    EXPECT_EQ(hdr->first_free_page_no_, IX_NO_PAGE);
+    for (int key = 0; key < 2 * num_keys; key += 97) {
+        result.clear();
+        EXPECT_TRUE(ih->get_value(reinterpret_cast<const char *>(&key), &result, &txn));
+    }
+
+    // 已有数据的索引逐条插入，key与索引中已有的key重复时check报错，索引不变
+    {
+        IxBulkBuilder builder(ih.get());
+        int key = 2 * num_keys;
+        builder.add(reinterpret_cast<const char *>(&key), Rid{0, 0});
+        key = 10;
+        builder.add(reinterpret_cast<const char *>(&key), Rid{0, 1});
+        EXPECT_THROW(builder.check(), IndexEntryDuplicateError);
+        EXPECT_THROW(builder.finish(), IndexEntryDuplicateError);
+        key = 2 * num_keys;
+        result.clear();
+        EXPECT_FALSE(ih->get_value(reinterpret_cast<const char *>(&key), &result, &txn));
+    }
+    ix_manager_->close_index(ih.get());
+    ix_manager_->destroy_index(filename_, cols_);
+
+    // 空索引批量构建时key重复，索引保持为空
+    ix_manager_->create_index(filename_, cols_);
+    ih = ix_manager_->open_index(filename_, cols_);
+    {
+        IxBulkBuilder builder(ih.get());
+        for (int key : {3, 1, 3}) {
+            builder.add(reinterpret_cast<const char *>(&key), Rid{0, key});
+        }
+        EXPECT_THROW(builder.finish(), IndexEntryDuplicateError);
+    }
+    EXPECT_EQ(ih->getFileHdr()->num_pages_, IX_INIT_NUM_PAGES);
+    EXPECT_EQ(ih->getFileHdr()->root_page_, IX_INIT_ROOT_PAGE);
+    ix_manager_->close_index(ih.get());
+    ix_manager_->destroy_index(filename_, cols_);
+}
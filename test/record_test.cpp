@@ -0,0 +1,476 @@
+#include <climits>
+#include <fstream>
+#include <random>
+#include "gtest/gtest.h"
+#include "record/rm.h"
+#include "storage/buffer_pool_manager.h"
+#include "storage/disk_manager.h"
+#include "system/csv_reader.h"
+
+const std::string TEST_DB_NAME = "RecordTest_db";  // 以TEST_DB_NAME作为存放测试文件的根目录名
+
+class RecordTest : public ::testing::Test {
+public:
+    std::unique_ptr<DiskManager> disk_manager_;
+    std::unique_ptr<LogManager> log_manager_;
+    std::unique_ptr<BufferPoolManager> buffer_pool_manager_;
+    std::unique_ptr<RmManager> rm_manager_;
+    std::string filename_;  // 每个测试点使用的表文件，以测试点的名字命名
+
+public:
+    // This function is called before every test.
+    void SetUp() override {
+        ::testing::Test::SetUp();
+        disk_manager_ = std::make_unique<DiskManager>();
+        // 如果测试目录不存在，则先创建测试目录
+        if (!disk_manager_->is_dir(TEST_DB_NAME)) {
+            disk_manager_->create_dir(TEST_DB_NAME);
+        }
+        assert(disk_manager_->is_dir(TEST_DB_NAME));  // 检查是否创建目录成功
+        // 进入测试目录
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+        filename_ = std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + "TestFile";
+        if (disk_manager_->is_file(filename_)) {
+            disk_manager_->destroy_file(filename_);
+        }
+        if (!disk_manager_->is_file(LOG_FILE_NAME)) {
+            disk_manager_->create_file(LOG_FILE_NAME);
+        }
+        log_manager_ = std::make_unique<LogManager>(disk_manager_.get());
+        buffer_pool_manager_ = std::make_unique<BufferPoolManager>(64, disk_manager_.get(), log_manager_.get(), 4);
+        rm_manager_ = std::make_unique<RmManager>(disk_manager_.get(), buffer_pool_manager_.get());
+    }
+
+    // This function is called after every test.
+    void TearDown() override {
+        rm_manager_.reset();
+        buffer_pool_manager_.reset();
+        log_manager_.reset();
+        // 返回上一层目录
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+        assert(disk_manager_->is_dir(TEST_DB_NAME));
+    };
+};
+
+TEST_F(RecordTest, PageBatchScan) {
+    const int record_size = 16;
+    rm_manager_->create_file(filename_, record_size);
+    auto file_handle = rm_manager_->open_file(filename_);
+    // 1、3号页面存放记录，2号页面为空
+    for (int i = 0; i < 3; i++) {
+        RmPageHandle page_handle = file_handle->create_new_page_handle();
+        ASSERT_NE(page_handle.page, nullptr);
+        buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), true);
+    }
+    std::vector<Rid> rids = {{1, 0}, {1, 2}, {1, 5}, {3, 1}};
+    char buf[record_size];
+    for (auto &rid : rids) {
+        memset(buf, 'a' + rid.page_no * 8 + rid.slot_no, record_size);
+        auto &hdr = file_handle->getFileHdr();
+        file_handle->insert_record_recover(rid, buf, INVALID_LSN, hdr.first_free_page_no, hdr.num_pages);
+    }
+    auto &hdr = file_handle->getFileHdr();
+    file_handle->mark_delete_record_recover(rids[1], INVALID_LSN, hdr.first_free_page_no, hdr.num_pages, true);
+
+    for (bool skip_mark_deleted : {true, false}) {
+        std::vector<Rid> scanned;
+        RmPageScan scan(file_handle.get());
+        RecordBatch batch;
+        while (scan.next_batch(&batch, skip_mark_deleted)) {
+            for (size_t i = 0; i < batch.size(); i++) {
+                Rid rid = batch.rid(i);
+                scanned.push_back(rid);
+                EXPECT_EQ(batch.data(i)[record_size - 1], 'a' + rid.page_no * 8 + rid.slot_no);
+            }
+            batch.release();
+        }
+        EXPECT_TRUE(scan.is_end());
+        std::vector<Rid> expected = rids;
+        if (skip_mark_deleted) {
+            expected.erase(expected.begin() + 1);
+        }
+        EXPECT_EQ(scanned, expected);
+    }
+
+    // 移动之后由新的批次持有页面，原批次为空，页面只unpin一次
+    {
+        RmPageScan scan(file_handle.get());
+        RecordBatch batch;
+        ASSERT_TRUE(scan.next_batch(&batch));
+        RecordBatch moved(std::move(batch));
+        EXPECT_TRUE(batch.empty());
+        EXPECT_EQ(moved.rid(0), rids[0]);
+        RecordBatch assigned;
+        assigned = std::move(moved);
+        EXPECT_TRUE(moved.empty());
+        EXPECT_EQ(assigned.data(0)[0], 'a' + 8);
+        EXPECT_FALSE(buffer_pool_manager_->delete_page(PageId{file_handle->GetFd(), 1}));
+    }
+    EXPECT_TRUE(buffer_pool_manager_->delete_page(PageId{file_handle->GetFd(), 1}));
+    rm_manager_->close_file(file_handle.get());
+    rm_manager_->destroy_file(filename_);
+}
+
+TEST_F(RecordTest, ZoneMapScan) {
+    const std::string zone_map_path = RmZoneMap::get_file_name(filename_);
+    std::vector<ColMeta> cols = {{filename_, "id", TYPE_INT, sizeof(int), 0, false},
+                                 {filename_, "name", TYPE_STRING, 12, sizeof(int), false}};
+    rm_manager_->create_file(filename_, sizeof(int) + 12);
+    auto file_handle = rm_manager_->open_file(filename_);
+    auto &zone_map = file_handle->get_zone_map();
+    zone_map.open(cols, file_handle->getFileHdr().num_pages, zone_map_path);
+    EXPECT_EQ(zone_map.find_col(0), 0);
+    EXPECT_EQ(zone_map.find_col(sizeof(int)), -1);
+    // 第i个页面存放id在[100 * i, 100 * i + 10)中的记录，4号页面为空
+    for (int i = 0; i < 4; i++) {
+        RmPageHandle page_handle = file_handle->create_new_page_handle();
+        ASSERT_NE(page_handle.page, nullptr);
+        buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), true);
+    }
+    char buf[sizeof(int) + 12] = {};
+    for (int page_no = 1; page_no <= 3; page_no++) {
+        for (int slot_no = 0; slot_no < 10; slot_no++) {
+            *reinterpret_cast<int *>(buf) = 100 * page_no + slot_no;
+            auto &hdr = file_handle->getFileHdr();
+            file_handle->insert_record_recover(Rid{page_no, slot_no}, buf, INVALID_LSN, hdr.first_free_page_no,
+                                               hdr.num_pages);
+        }
+    }
+    auto scan_pages = [&](CompOp op, int value) {
+        std::vector<int> pages;
+        RmPageScan scan(file_handle.get());
+        scan.set_predicates({ZonePredicate{0, op, reinterpret_cast<const char *>(&value)}});
+        RecordBatch batch;
+        while (scan.next_batch(&batch)) {
+            pages.push_back(batch.rid(0).page_no);
+            batch.release();
+        }
+        return pages;
+    };
+    EXPECT_EQ(scan_pages(OP_GE, 305), std::vector<int>({3}));
+    EXPECT_EQ(scan_pages(OP_EQ, 150), std::vector<int>());
+    EXPECT_EQ(scan_pages(OP_LT, 300), std::vector<int>({1, 2}));
+    // 更新记录后范围扩大
+    *reinterpret_cast<int *>(buf) = 1000;
+    auto &hdr = file_handle->getFileHdr();
+    file_handle->update_record_recover(Rid{1, 0}, buf, INVALID_LSN, hdr.first_free_page_no, hdr.num_pages);
+    EXPECT_EQ(scan_pages(OP_GE, 305), std::vector<int>({1, 3}));
+
+    // 保存后重新打开，范围保持不变，旁路文件被删除
+    zone_map.save(zone_map_path);
+    zone_map.open(cols, file_handle->getFileHdr().num_pages, zone_map_path);
+    EXPECT_FALSE(disk_manager_->is_file(zone_map_path));
+    EXPECT_EQ(scan_pages(OP_GE, 305), std::vector<int>({1, 3}));
+    // 没有旁路文件时页面范围未知，第一次扫描读取所有页面并重新统计
+    zone_map.open(cols, file_handle->getFileHdr().num_pages, zone_map_path);
+    EXPECT_EQ(scan_pages(OP_GE, 305), std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(scan_pages(OP_GE, 305), std::vector<int>({1, 3}));
+
+    rm_manager_->close_file(file_handle.get());
+    rm_manager_->destroy_file(filename_);
+}
+
+TEST_F(RecordTest, SlottedPage) {
+    // 记录为(int id, VARCHAR(200) name)
+    const int name_len = 200;
+    const int record_size = sizeof(int) + name_len;
+    rm_manager_->create_file(filename_, record_size, {RmVarCol{sizeof(int), name_len}});
+    auto file_handle = rm_manager_->open_file(filename_);
+    auto &hdr = file_handle->getFileHdr();
+    EXPECT_EQ(hdr.format, RM_FORMAT_SLOTTED);
+    EXPECT_GT(hdr.num_records_per_page, PAGE_SIZE / record_size);
+    RmPageHandle page_handle = file_handle->create_new_page_handle();
+    ASSERT_NE(page_handle.page, nullptr);
+    buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), true);
+
+    const int num_records = 40;
+    std::vector<std::string> names(num_records);
+    auto make_record = [&](int id, const std::string &name) {
+        std::vector<char> buf(record_size, 0);
+        memcpy(buf.data(), &id, sizeof(int));
+        memcpy(buf.data() + sizeof(int), name.data(), name.size());
+        return buf;
+    };
+    auto check_records = [&]() {
+        for (int i = 0; i < num_records; i++) {
+            if (names[i].empty()) {
+                continue;
+            }
+            auto rec = file_handle->get_record(Rid{1, i}, nullptr);
+            EXPECT_EQ(make_record(i, names[i]), std::vector<char>(rec->data, rec->data + record_size));
+        }
+    };
+    for (int i = 0; i < num_records; i++) {
+        names[i] = "n" + std::to_string(i);
+        auto buf = make_record(i, names[i]);
+        file_handle->insert_record_recover(Rid{1, i}, buf.data(), INVALID_LSN, hdr.first_free_page_no, hdr.num_pages);
+    }
+    check_records();
+    // 记录变长后重新分配空间，16条最长的记录占满了连续的空闲空间
+    for (int i = 0; i < 16; i++) {
+        names[i] = std::string(name_len, 'a' + i);
+        auto buf = make_record(i, names[i]);
+        file_handle->update_record_recover(Rid{1, i}, buf.data(), INVALID_LSN, hdr.first_free_page_no, hdr.num_pages);
+    }
+    check_records();
+    // 删除的记录留下空洞，再次变长时需要整理页面
+    for (int i = 0; i < 4; i++) {
+        names[i].clear();
+        file_handle->delete_record_recover(Rid{1, i}, INVALID_LSN, hdr.first_free_page_no, hdr.num_pages);
+    }
+    names[20] = std::string(name_len, 'z');
+    auto buf = make_record(20, names[20]);
+    file_handle->update_record_recover(Rid{1, 20}, buf.data(), INVALID_LSN, hdr.first_free_page_no, hdr.num_pages);
+    check_records();
+    page_handle = file_handle->fetch_page_handle(1);
+    EXPECT_EQ(page_handle.heap_hdr->heap_begin, PAGE_SIZE - page_handle.heap_hdr->used_bytes);
+    buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), false);
+
+    // 批量扫描得到解码后的记录
+    RmPageScan scan(file_handle.get());
+    RecordBatch batch;
+    ASSERT_TRUE(scan.next_batch(&batch));
+    EXPECT_EQ(batch.size(), static_cast<size_t>(num_records - 4));
+    EXPECT_EQ(batch.rid(16).slot_no, 20);
+    EXPECT_EQ(make_record(20, names[20]), std::vector<char>(batch.data(16), batch.data(16) + record_size));
+    batch.release();
+
+    rm_manager_->close_file(file_handle.get());
+    rm_manager_->destroy_file(filename_);
+}
+
+TEST_F(RecordTest, PaxPage) {
+    // 记录为(int a, CHAR(8) b, int c)
+    const int record_size = 2 * sizeof(int) + 8;
+    std::vector<RmMinipage> minipages = {{0, sizeof(int)}, {sizeof(int), 8}, {sizeof(int) + 8, sizeof(int)}};
+    rm_manager_->create_file(filename_, record_size, {}, minipages);
+    auto file_handle = rm_manager_->open_file(filename_);
+    auto &hdr = file_handle->getFileHdr();
+    EXPECT_EQ(hdr.format, RM_FORMAT_PAX);
+    ASSERT_EQ(file_handle->get_minipages().size(), minipages.size());
+    RmPageHandle page_handle = file_handle->create_new_page_handle();
+    ASSERT_NE(page_handle.page, nullptr);
+    buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), true);
+
+    const int num_records = 10;
+    auto make_record = [&](int i) {
+        std::vector<char> buf(record_size, 0);
+        int a = i, c = 100 * i;
+        memcpy(buf.data(), &a, sizeof(int));
+        snprintf(buf.data() + sizeof(int), 8, "s%d", i);
+        memcpy(buf.data() + sizeof(int) + 8, &c, sizeof(int));
+        return buf;
+    };
+    for (int i = 0; i < num_records; i++) {
+        auto buf = make_record(i);
+        file_handle->insert_record_recover(Rid{1, i}, buf.data(), INVALID_LSN, hdr.first_free_page_no, hdr.num_pages);
+    }
+    // 同一个字段的值在页面中连续存放
+    page_handle = file_handle->fetch_page_handle(1);
+    for (int i = 0; i < num_records; i++) {
+        EXPECT_EQ(reinterpret_cast<int *>(page_handle.slots)[i], i);
+    }
+    buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), false);
+    for (int i = 0; i < num_records; i++) {
+        auto rec = file_handle->get_record(Rid{1, i}, nullptr);
+        EXPECT_EQ(make_record(i), std::vector<char>(rec->data, rec->data + record_size));
+    }
+
+    // 条件只涉及字段a，输出字段c：批次中只有字段a，materialize后补齐字段c，字段b为0
+    RmPageScan scan(file_handle.get());
+    scan.set_columns({0}, {static_cast<int>(sizeof(int)) + 8});
+    RecordBatch batch;
+    ASSERT_TRUE(scan.next_batch(&batch));
+    ASSERT_EQ(batch.size(), static_cast<size_t>(num_records));
+    for (size_t i = 0; i < batch.size(); i++) {
+        auto expected = make_record(static_cast<int>(i));
+        std::vector<char> scanned(batch.data(i), batch.data(i) + record_size);
+        EXPECT_EQ(std::vector<char>(expected.begin(), expected.begin() + sizeof(int)),
+                  std::vector<char>(scanned.begin(), scanned.begin() + sizeof(int)));
+        EXPECT_EQ(std::vector<char>(record_size - sizeof(int), 0), std::vector<char>(scanned.begin() + sizeof(int), scanned.end()));
+        auto rec = batch.materialize(i);
+        memset(expected.data() + sizeof(int), 0, 8);
+        EXPECT_EQ(expected, std::vector<char>(rec->data, rec->data + record_size));
+    }
+    batch.release();
+
+    rm_manager_->close_file(file_handle.get());
+    rm_manager_->destroy_file(filename_);
+}
+
+TEST_F(RecordTest, FileHeaderLayout) {
+    const int record_size = sizeof(int) + 20;
+    // 直接修改第0号页面中文件头的页面格式和字段个数
+    auto write_layout = [&](int format, int num_var_cols, int num_minipages) {
+        int fd = disk_manager_->open_file(filename_);
+        std::vector<char> hdr_page(PAGE_SIZE);
+        disk_manager_->read_page(fd, RM_FILE_HDR_PAGE, hdr_page.data(), PAGE_SIZE);
+        auto hdr = reinterpret_cast<RmFileHdr *>(hdr_page.data());
+        hdr->format = format;
+        hdr->num_var_cols = num_var_cols;
+        hdr->num_minipages = num_minipages;
+        disk_manager_->write_page(fd, RM_FILE_HDR_PAGE, hdr_page.data(), PAGE_SIZE);
+        disk_manager_->close_file(fd);
+    };
+    auto expect_layout = [&](int format, int num_var_cols, int num_minipages) {
+        auto file_handle = rm_manager_->open_file(filename_);
+        EXPECT_EQ(file_handle->getFileHdr().format, format);
+        EXPECT_EQ(file_handle->getFileHdr().num_var_cols, num_var_cols);
+        EXPECT_EQ(file_handle->getFileHdr().num_minipages, num_minipages);
+        EXPECT_EQ(file_handle->get_minipages().size(), static_cast<size_t>(num_minipages));
+        rm_manager_->close_file(file_handle.get());
+    };
+
+    rm_manager_->create_file(filename_, record_size, {RmVarCol{sizeof(int), 20}});
+    expect_layout(RM_FORMAT_SLOTTED, 1, 0);
+    // 字段个数超出第0号页面、与格式不符，或者字段超出记录时按定长格式打开
+    write_layout(RM_FORMAT_SLOTTED, PAGE_SIZE, 0);
+    expect_layout(RM_FORMAT_FIXED, 0, 0);
+    write_layout(RM_FORMAT_SLOTTED, 1, 1);
+    expect_layout(RM_FORMAT_FIXED, 0, 0);
+    write_layout(RM_FORMAT_PAX, 0, 2);
+    expect_layout(RM_FORMAT_FIXED, 0, 0);
+    rm_manager_->destroy_file(filename_);
+
+    // 旧版本的文件头之后是未初始化的内容，未知的格式按定长格式打开，关闭时写回有效的文件头
+    rm_manager_->create_file(filename_, record_size);
+    write_layout(32581, 1701931256, 5);
+    expect_layout(RM_FORMAT_FIXED, 0, 0);
+    int fd = disk_manager_->open_file(filename_);
+    RmFileHdr hdr;
+    disk_manager_->read_page(fd, RM_FILE_HDR_PAGE, reinterpret_cast<char *>(&hdr), sizeof(hdr));
+    disk_manager_->close_file(fd);
+    EXPECT_EQ(hdr.format, RM_FORMAT_FIXED);
+    EXPECT_EQ(hdr.num_var_cols, 0);
+    rm_manager_->destroy_file(filename_);
+}
+
+TEST_F(RecordTest, BulkLoad) {
+    // 记录为(int id, int v)
+    const int record_size = 2 * sizeof(int);
+    rm_manager_->create_file(filename_, record_size);
+    auto file_handle = rm_manager_->open_file(filename_);
+    const auto &hdr = file_handle->getFileHdr();
+    Transaction txn(0);
+    Context context(nullptr, log_manager_.get(), &txn);
+
+    // 超过一个extent，最后一个页面不满
+    const int num_records = hdr.num_records_per_page * (RM_BULK_EXTENT_PAGES + 1) + 5;
+    auto make_record = [&](int i) {
+        std::vector<char> buf(record_size);
+        int v = 3 * i;
+        memcpy(buf.data(), &i, sizeof(int));
+        memcpy(buf.data() + sizeof(int), &v, sizeof(int));
+        return buf;
+    };
+    std::vector<Rid> rids;
+    RmBulkLoader loader(file_handle.get(), &context, filename_);
+    // 放弃的导入不改变文件头，之后的导入从同一个页面开始
+    {
+        RmBulkLoader aborted(file_handle.get(), &context, filename_);
+        for (int i = 0; i < hdr.num_records_per_page * RM_BULK_EXTENT_PAGES + 1; i++) {
+            aborted.append(make_record(-1).data());
+        }
+        aborted.abort();
+    }
+    EXPECT_EQ(hdr.num_pages, 1);
+    for (int i = 0; i < num_records; i++) {
+        rids.push_back(loader.append(make_record(i).data()));
+    }
+    // 第一个extent已经写出，finish之前文件头不变
+    EXPECT_EQ(hdr.num_pages, 1);
+    EXPECT_EQ(rids.front(), (Rid{1, 0}));
+    loader.finish();
+    EXPECT_EQ(hdr.num_pages, RM_BULK_EXTENT_PAGES + 3);
+    EXPECT_EQ(hdr.first_free_page_no, RM_BULK_EXTENT_PAGES + 2);
+    EXPECT_EQ(rids.back(), (Rid{RM_BULK_EXTENT_PAGES + 2, 4}));
+    // 整个导入只写一条日志
+    EXPECT_EQ(log_manager_->flushed_lsn_.load(), 1);
+    EXPECT_EQ(txn.get_prev_lsn(), 1);
+
+    // 重新打开文件后通过buffer pool读到导入的记录，之后的插入使用最后一个页面的空闲空间
+    rm_manager_->close_file(file_handle.get());
+    file_handle = rm_manager_->open_file(filename_);
+    for (int i = 0; i < num_records; i += 97) {
+        auto rec = file_handle->get_record(rids[i], nullptr);
+        EXPECT_EQ(make_record(i), std::vector<char>(rec->data, rec->data + record_size));
+    }
+    int scanned = 0;
+    for (RmScan scan(file_handle.get()); !scan.is_end(); scan.next()) {
+        scanned++;
+    }
+    EXPECT_EQ(scanned, num_records);
+    std::string table_name = filename_;
+    auto rid = file_handle->insert_record(make_record(num_records).data(), &context, &table_name);
+    EXPECT_EQ(rid, (Rid{RM_BULK_EXTENT_PAGES + 2, 5}));
+
+    rm_manager_->close_file(file_handle.get());
+    rm_manager_->destroy_file(filename_);
+}
+
+TEST_F(RecordTest, CsvReader) {
+    // 手写的转换与std::stof等标准转换的结果一致
+    std::mt19937 rng(7);
+    for (int i = 0; i < 10000; i++) {
+        std::string str = std::to_string(static_cast<int>(rng() % 2000000) - 1000000) + "." + std::to_string(rng() % 1000);
+        EXPECT_EQ(CsvReader::parse_float(str.data(), str.data() + str.size()), std::stof(str)) << str;
+    }
+    for (std::string str : {"0.1", "-0", "3.4e5", "16777217", "123456.789012"}) {
+        EXPECT_EQ(CsvReader::parse_float(str.data(), str.data() + str.size()), std::stof(str)) << str;
+    }
+    std::string str = "-2147483648";
+    EXPECT_EQ(CsvReader::parse_int(str.data(), str.data() + str.size()), INT_MIN);
+    str = "2147483648";
+    EXPECT_THROW(CsvReader::parse_int(str.data(), str.data() + str.size()), IncompatibleTypeError);
+    str = "-9223372036854775808";
+    EXPECT_EQ(CsvReader::parse_bigint(str.data(), str.data() + str.size()), INT64_MIN);
+    str = "9223372036854775808";
+    EXPECT_THROW(CsvReader::parse_bigint(str.data(), str.data() + str.size()), BigintOutOfRangeError);
+    str = "2023-05-18  09:12:19";
+    EXPECT_EQ(CsvReader::parse_datetime(str.data(), str.data() + str.size()), 20230518091219);
+    str = "2023-02-30 09:12:19";
+    EXPECT_THROW(CsvReader::parse_datetime(str.data(), str.data() + str.size()), DateTimeAbsurdError);
+
+    // 文件跨越多个分块，记录按文件中的顺序交给调用者
+    const std::string filename = "CsvReaderTestFile.csv";
+    std::vector<ColMeta> cols = {{"t", "id", TYPE_INT, 4, 0}, {"t", "name", TYPE_STRING, 8, 4},
+                                 {"t", "ts", TYPE_DATETIME, 8, 12}};
+    const int record_size = 20;
+    const int num_records = 500000;
+    {
+        std::ofstream out(filename);
+        out << "id,name,ts\n";
+        for (int i = 0; i < num_records; i++) {
+            out << i << ",n" << i % 1000 << ",2024-01-02 03:04:05\r\n";
+            if (i % 100000 == 0) {
+                out << "\n";
+            }
+        }
+    }
+    CsvReader reader(filename, cols, record_size, 4);
+    int next = 0;
+    reader.read([&](const char *records, size_t count) {
+        for (size_t i = 0; i < count; i++, next++) {
+            const char *rec = records + i * record_size;
+            EXPECT_EQ(*reinterpret_cast<const int *>(rec), next);
+            EXPECT_EQ(std::string(rec + 4), "n" + std::to_string(next % 1000));
+            EXPECT_EQ(*reinterpret_cast<const int64_t *>(rec + 12), 20240102030405);
+        }
+    });
+    EXPECT_EQ(next, num_records);
+
+    // 转换失败的行之前的记录都已经读出
+    {
+        std::ofstream out(filename);
+        out << "id,name,ts\n1,a,2024-01-02 03:04:05\n2,toolongname,2024-01-02 03:04:05\n3,c,2024-01-02 03:04:05\n";
+    }
+    CsvReader bad_reader(filename, cols, record_size);
+    size_t read_records = 0;
+    EXPECT_THROW(bad_reader.read([&](const char *, size_t count) { read_records += count; }), StringOverflowError);
+    EXPECT_EQ(read_records, 1u);
+    unlink(filename.c_str());
+}
@@ -2,11 +2,18 @@
 // Created by Anti on 2023/7/9.
 //
 
+#include <climits>
+#include <fstream>
 #include <random>
 #include <thread>
 #include "gtest/gtest.h"
+#include "record/bitmap.h"
+#include "replacer/clock_replacer.h"
+#include "replacer/lru_k_replacer.h"
 #include "replacer/lru_replacer.h"
+#include "storage/buffer_pool_manager.h"
 #include "storage/disk_manager.h"
+#include "storage/page_table.h"
 
 constexpr int MAX_FILES = 32;
 constexpr int MAX_PAGES = 128;
@@ -145,6 +152,550 @@ TEST_F(DiskManagerTest, PageOperation) {
     EXPECT_EQ(disk_manager_->is_file(filename), false);
 }
 
+/**
+ * @brief 批量读通过环形缓冲区换页，不会占满整个buffer pool
+ */
+TEST_F(DiskManagerTest, BufferAccessStrategy) {
+    const std::string filename = "BufferAccessStrategyTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const int num_pages = 2048;
+    const int num_hot_pages = 10;
+    const size_t pool_size = 1024;
+    char data[PAGE_SIZE] = {0};
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        memcpy(data + PAGE_SIZE / 2, &page_no, sizeof(int));
+        disk_manager_->write_page(fd, page_no, data, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    LogManager log_manager(disk_manager_.get());
+    BufferPoolManager bpm(pool_size, disk_manager_.get(), &log_manager, 1);
+    // 热点页面经过共享的替换策略装入
+    for (int page_no = 0; page_no < num_hot_pages; page_no++) {
+        Page *page = bpm.fetch_page(PageId{fd, page_no});
+        ASSERT_NE(page, nullptr);
+        bpm.unpin_page(page->get_page_id(), false);
+    }
+    // 批量读只占用环形缓冲区大小的帧
+    auto strategy = bpm.get_access_strategy(BufferAccessType::BULKREAD);
+    for (int page_no = num_hot_pages; page_no < num_pages; page_no++) {
+        Page *page = bpm.fetch_page(PageId{fd, page_no}, strategy.get());
+        ASSERT_NE(page, nullptr);
+        EXPECT_EQ(*reinterpret_cast<int *>(page->get_data() + PAGE_SIZE / 2), page_no);
+        bpm.unpin_page(page->get_page_id(), false);
+    }
+    EXPECT_EQ(bpm.get_free_size(), pool_size - num_hot_pages - BULKREAD_RING_SIZE);
+    // 再次扫描时，帧仍在环中被复用
+    for (int page_no = num_hot_pages; page_no < num_pages; page_no++) {
+        Page *page = bpm.fetch_page(PageId{fd, page_no}, strategy.get());
+        ASSERT_NE(page, nullptr);
+        EXPECT_EQ(*reinterpret_cast<int *>(page->get_data() + PAGE_SIZE / 2), page_no);
+        bpm.unpin_page(page->get_page_id(), false);
+    }
+    EXPECT_EQ(bpm.get_free_size(), pool_size - num_hot_pages - BULKREAD_RING_SIZE);
+
+    bpm.delete_all_pages(fd);
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+TEST_F(DiskManagerTest, BufferPoolResize) {
+    const std::string filename = "BufferPoolResizeTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const int num_pages = 64;
+    char data[PAGE_SIZE] = {0};
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        disk_manager_->write_page(fd, page_no, data, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    LogManager log_manager(disk_manager_.get());
+    BufferPoolManager bpm(num_pages, disk_manager_.get(), &log_manager, 1);
+    // 所有帧都装入脏页，第一个和最后一个页面保持固定
+    std::vector<Page *> pages;
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        Page *page = bpm.fetch_page(PageId{fd, page_no});
+        ASSERT_NE(page, nullptr);
+        memcpy(page->get_data() + PAGE_SIZE / 2, &page_no, sizeof(int));
+        pages.push_back(page);
+    }
+    for (int page_no = 1; page_no < num_pages - 1; page_no++) {
+        bpm.unpin_page(PageId{fd, page_no}, true);
+    }
+    // 被移除的帧中还有被固定的页面，不能缩容
+    EXPECT_FALSE(bpm.resize(16));
+    EXPECT_EQ(bpm.get_pool_size(), num_pages);
+    bpm.unpin_page(PageId{fd, num_pages - 1}, true);
+    EXPECT_TRUE(bpm.resize(16));
+    EXPECT_EQ(bpm.get_pool_size(), 16);
+    // 固定的页面没有移动，被淘汰的脏页已经写回磁盘
+    EXPECT_EQ(*reinterpret_cast<int *>(pages[0]->get_data() + PAGE_SIZE / 2), 0);
+    for (int page_no = 1; page_no < num_pages; page_no++) {
+        Page *page = bpm.fetch_page(PageId{fd, page_no});
+        ASSERT_NE(page, nullptr);
+        EXPECT_EQ(*reinterpret_cast<int *>(page->get_data() + PAGE_SIZE / 2), page_no);
+        bpm.unpin_page(page->get_page_id(), false);
+    }
+    EXPECT_EQ(bpm.get_free_size(), 0);
+    // 扩容后新增的帧全部空闲
+    EXPECT_TRUE(bpm.resize(128));
+    EXPECT_EQ(bpm.get_pool_size(), 128);
+    EXPECT_EQ(bpm.get_free_size(), 112);
+    EXPECT_EQ(pages[0], bpm.fetch_page(PageId{fd, 0}));
+    bpm.unpin_page(PageId{fd, 0}, false);
+    bpm.unpin_page(PageId{fd, 0}, false);
+
+    bpm.delete_all_pages(fd);
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+TEST_F(DiskManagerTest, BackgroundWriter) {
+    const std::string filename = "BackgroundWriterTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const int num_pages = 64;
+    char data[PAGE_SIZE] = {0};
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        disk_manager_->write_page(fd, page_no, data, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    LogManager log_manager(disk_manager_.get());
+    BufferPoolManager bpm(num_pages, disk_manager_.get(), &log_manager, 1);
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        Page *page = bpm.fetch_page(PageId{fd, page_no});
+        ASSERT_NE(page, nullptr);
+        memcpy(page->get_data() + PAGE_SIZE / 2, &page_no, sizeof(int));
+        bpm.unpin_page(page->get_page_id(), true);
+    }
+    // 日志全部持久化之后，最先被淘汰的页面由后台写线程写回，页面仍然留在buffer pool中
+    log_manager.flush_log_to_disk();
+    bpm.start_background_writer();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    bpm.stop_background_writer();
+    for (int page_no = 0; page_no < static_cast<int>(BGWRITER_MIN_LOOKAHEAD); page_no++) {
+        disk_manager_->read_page(fd, page_no, data, PAGE_SIZE);
+        EXPECT_EQ(*reinterpret_cast<int *>(data + PAGE_SIZE / 2), page_no);
+    }
+    EXPECT_EQ(bpm.get_free_size(), 0);
+    disk_manager_->read_page(fd, num_pages - 1, data, PAGE_SIZE);
+    EXPECT_EQ(*reinterpret_cast<int *>(data + PAGE_SIZE / 2), 0);
+
+    bpm.delete_all_pages(fd);
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+TEST_F(DiskManagerTest, FlushAndDeleteFilePages) {
+    const std::string filenames[2] = {"FlushFilePagesTestFile0", "FlushFilePagesTestFile1"};
+    const int num_pages = 100;
+    int fds[2];
+    char data[PAGE_SIZE] = {0};
+    for (int i = 0; i < 2; i++) {
+        if (disk_manager_->is_file(filenames[i])) {
+            disk_manager_->destroy_file(filenames[i]);
+        }
+        disk_manager_->create_file(filenames[i]);
+        fds[i] = disk_manager_->open_file(filenames[i]);
+        for (int page_no = 0; page_no < num_pages; page_no++) {
+            disk_manager_->write_page(fds[i], page_no, data, PAGE_SIZE);
+        }
+        disk_manager_->set_fd2pageno(fds[i], num_pages);
+    }
+
+    LogManager log_manager(disk_manager_.get());
+    BufferPoolManager bpm(4 * num_pages, disk_manager_.get(), &log_manager, 4);
+    // 两个文件的页面交错装入，只修改其中页号不是3的倍数的页面
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        for (int fd : fds) {
+            Page *page = bpm.fetch_page(PageId{fd, page_no});
+            ASSERT_NE(page, nullptr);
+            bool is_dirty = page_no % 3 != 0;
+            if (is_dirty) {
+                memcpy(page->get_data() + PAGE_SIZE / 2, &page_no, sizeof(int));
+            }
+            bpm.unpin_page(page->get_page_id(), is_dirty);
+        }
+    }
+    bpm.flush_all_pages(fds[0]);
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        disk_manager_->read_page(fds[0], page_no, data, PAGE_SIZE);
+        EXPECT_EQ(*reinterpret_cast<int *>(data + PAGE_SIZE / 2), page_no % 3 != 0 ? page_no : 0);
+        disk_manager_->read_page(fds[1], page_no, data, PAGE_SIZE);
+        EXPECT_EQ(*reinterpret_cast<int *>(data + PAGE_SIZE / 2), 0);
+    }
+    // 删除一个文件的页面只释放该文件占用的帧，脏页在释放前写回
+    bpm.delete_all_pages(fds[1]);
+    EXPECT_EQ(bpm.get_free_size(), 3 * num_pages);
+    for (int page_no = 1; page_no < num_pages; page_no++) {
+        disk_manager_->read_page(fds[1], page_no, data, PAGE_SIZE);
+        EXPECT_EQ(*reinterpret_cast<int *>(data + PAGE_SIZE / 2), page_no % 3 != 0 ? page_no : 0);
+    }
+
+    for (int i = 0; i < 2; i++) {
+        bpm.delete_all_pages(fds[i]);
+        disk_manager_->close_file(fds[i]);
+        disk_manager_->destroy_file(filenames[i]);
+    }
+    EXPECT_EQ(bpm.get_free_size(), 4 * num_pages);
+}
+
+TEST_F(DiskManagerTest, ManifestPrefetch) {
+    const std::string filename = "ManifestPrefetchTestFile";
+    const std::string manifest = "ManifestPrefetchTestFile.manifest";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const int num_pages = 1000;
+    const size_t pool_size = 256;
+    char data[PAGE_SIZE] = {0};
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        memcpy(data + PAGE_SIZE / 2, &page_no, sizeof(int));
+        disk_manager_->write_page(fd, page_no, data, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    LogManager log_manager(disk_manager_.get());
+    {
+        // 每隔3页访问一次，清单中的页面不连续
+        BufferPoolManager bpm(pool_size, disk_manager_.get(), &log_manager);
+        for (int page_no = 0; page_no < num_pages; page_no += 3) {
+            Page *page = bpm.fetch_page(PageId{fd, page_no});
+            ASSERT_NE(page, nullptr);
+            bpm.unpin_page(page->get_page_id(), false);
+        }
+        bpm.save_manifest(manifest);
+    }
+    BufferPoolManager bpm(pool_size, disk_manager_.get(), &log_manager);
+    bpm.start_prefetch(manifest);
+    for (int i = 0; i < 100 && bpm.get_free_size() > 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    bpm.stop_prefetch();
+    // 清单中的页面数多于帧数，预读会装满buffer pool，页面内容与磁盘一致
+    EXPECT_EQ(bpm.get_free_size(), 0);
+    for (int page_no = num_pages - 1; page_no >= 0; page_no--) {
+        Page *page = bpm.fetch_page(PageId{fd, page_no});
+        ASSERT_NE(page, nullptr);
+        EXPECT_EQ(*reinterpret_cast<int *>(page->get_data() + PAGE_SIZE / 2), page_no);
+        bpm.unpin_page(page->get_page_id(), false);
+    }
+
+    bpm.delete_all_pages(fd);
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+    disk_manager_->destroy_file(manifest);
+}
+
+/**
+ * @brief 通过IoEngine批量写入和读取多段页面，包括超过IOV_MAX的段和越过文件末尾的读取
+ */
+TEST_F(DiskManagerTest, BatchIo) {
+    const std::string filename = "BatchIoTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const int num_pages = IOV_MAX + 100;
+    std::vector<char> data(static_cast<size_t>(num_pages) * PAGE_SIZE);
+    std::vector<char *> pages(num_pages);
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        pages[page_no] = data.data() + static_cast<size_t>(page_no) * PAGE_SIZE;
+        memcpy(pages[page_no], &page_no, sizeof(int));
+    }
+    // 一个大段，后面再用若干个单页的段覆盖其中的部分页面
+    std::vector<DiskManager::PageWrite> writes{{fd, 0, pages.data(), num_pages}};
+    disk_manager_->write_pages_batch(writes);
+    writes.clear();
+    for (int page_no = 0; page_no < num_pages; page_no += 7) {
+        int value = -page_no;
+        memcpy(pages[page_no], &value, sizeof(int));
+        writes.push_back(DiskManager::PageWrite{fd, page_no, &pages[page_no], 1});
+    }
+    disk_manager_->write_pages_batch(writes);
+
+    std::vector<char> buffer(data.size());
+    std::vector<DiskManager::PageRead> reads;
+    for (int page_no = 0; page_no < num_pages; page_no += 64) {
+        reads.push_back(DiskManager::PageRead{fd, page_no, buffer.data() + static_cast<size_t>(page_no) * PAGE_SIZE,
+                                              std::min(64, num_pages - page_no), 0});
+    }
+    std::vector<char> tail(4 * PAGE_SIZE);
+    reads.push_back(DiskManager::PageRead{fd, num_pages - 2, tail.data(), 4, 0});
+    disk_manager_->read_pages_batch(&reads);
+    for (size_t i = 0; i + 1 < reads.size(); i++) {
+        EXPECT_EQ(reads[i].num_read, reads[i].num_pages);
+    }
+    EXPECT_EQ(reads.back().num_read, 2);
+    EXPECT_EQ(buffer, data);
+
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+/**
+ * @brief 顺序预读：给出提示的游标立即预读，没有提示的游标连续访问相邻页面后才预读，预读的页面内容与磁盘一致
+ */
+TEST_F(DiskManagerTest, ReadAhead) {
+    const std::string filename = "ReadAheadTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    const int num_pages = 1000;
+    char data[PAGE_SIZE] = {0};
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        memcpy(data + PAGE_SIZE / 2, &page_no, sizeof(int));
+        disk_manager_->write_page(fd, page_no, data, PAGE_SIZE);
+    }
+    disk_manager_->set_fd2pageno(fd, num_pages);
+
+    LogManager log_manager(disk_manager_.get());
+    const size_t pool_size = 512;
+    BufferPoolManager bpm(pool_size, disk_manager_.get(), &log_manager);
+    ReadAheadState detected;
+    bpm.read_ahead(&detected, PageId{fd, 500}, num_pages);
+    bpm.read_ahead(&detected, PageId{fd, 501}, num_pages);
+    EXPECT_EQ(bpm.get_free_size(), pool_size);
+    bpm.read_ahead(&detected, PageId{fd, 502}, num_pages);
+    EXPECT_EQ(bpm.get_free_size(), pool_size - READAHEAD_MIN_PAGES);
+
+    // 顺序扫描整个文件，buffer pool装不下时预读的页面替换掉已经扫描过的页面
+    ReadAheadState sequential(true);
+    for (int page_no = 0; page_no < num_pages; page_no++) {
+        bpm.read_ahead(&sequential, PageId{fd, page_no}, num_pages);
+        Page *page = bpm.fetch_page(PageId{fd, page_no});
+        ASSERT_NE(page, nullptr);
+        EXPECT_EQ(*reinterpret_cast<int *>(page->get_data() + PAGE_SIZE / 2), page_no);
+        bpm.unpin_page(page->get_page_id(), false);
+    }
+
+    bpm.delete_all_pages(fd);
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+/**
+ * @brief 直接I/O：不对齐或者不足一页的读写经过中转缓冲区，不足一页的写入保留页面的其余部分
+ */
+TEST_F(DiskManagerTest, DirectIo) {
+    const std::string filename = "DirectIoTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    disk_manager_->set_direct_io(true);
+    int fd = disk_manager_->open_file(filename);
+    disk_manager_->set_direct_io(false);
+
+    std::vector<char> data(PAGE_SIZE + 1);
+    char *unaligned = data.data() + 1;
+    for (int page_no = 0; page_no < 4; page_no++) {
+        memset(unaligned, 'a' + page_no, PAGE_SIZE);
+        disk_manager_->write_page(fd, page_no, unaligned, PAGE_SIZE);
+    }
+    int header = 12345;
+    disk_manager_->write_page(fd, 0, reinterpret_cast<char *>(&header), sizeof(header));
+    int read_header = 0;
+    disk_manager_->read_page(fd, 0, reinterpret_cast<char *>(&read_header), sizeof(read_header));
+    EXPECT_EQ(read_header, header);
+    disk_manager_->read_page(fd, 0, unaligned, PAGE_SIZE);
+    EXPECT_EQ(unaligned[sizeof(header)], 'a');
+
+    // buffer pool的帧是对齐的，直接读写
+    LogManager log_manager(disk_manager_.get());
+    disk_manager_->set_fd2pageno(fd, 4);
+    {
+        BufferPoolManager bpm(64, disk_manager_.get(), &log_manager);
+        Page *page = bpm.fetch_page(PageId{fd, 3});
+        ASSERT_NE(page, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(page->get_data()) % PAGE_SIZE, 0);
+        EXPECT_EQ(page->get_data()[PAGE_SIZE - 1], 'd');
+        page->get_data()[0] = 'z';
+        bpm.unpin_page(page->get_page_id(), true);
+        bpm.flush_all_pages(fd);
+    }
+    disk_manager_->read_page(fd, 3, unaligned, PAGE_SIZE);
+    EXPECT_EQ(unaligned[0], 'z');
+
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+TEST_F(DiskManagerTest, ExtentAllocation) {
+    const std::string filename = "ExtentTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    disk_manager_->set_fd2pageno(fd, 0);
+
+    // 第一次分配页面时文件扩展一个区，区内的页面可以直接读出全0
+    EXPECT_EQ(disk_manager_->allocate_page(fd), 0);
+    EXPECT_EQ(disk_manager_->get_file_size(filename), EXTENT_MIN_PAGES * PAGE_SIZE);
+    for (int i = 1; i < EXTENT_MIN_PAGES; i++) {
+        disk_manager_->allocate_page(fd);
+    }
+    EXPECT_EQ(disk_manager_->get_file_size(filename), EXTENT_MIN_PAGES * PAGE_SIZE);
+    char buf[PAGE_SIZE];
+    memset(buf, 'x', PAGE_SIZE);
+    disk_manager_->read_page(fd, EXTENT_MIN_PAGES - 1, buf, PAGE_SIZE);
+    EXPECT_EQ(buf[0], 0);
+    EXPECT_EQ(disk_manager_->allocate_page(fd), EXTENT_MIN_PAGES);
+    EXPECT_EQ(disk_manager_->get_file_size(filename), 2 * EXTENT_MIN_PAGES * PAGE_SIZE);
+
+    // 新页面在淘汰或刷盘时才写回
+    LogManager log_manager(disk_manager_.get());
+    {
+        BufferPoolManager bpm(64, disk_manager_.get(), &log_manager);
+        PageId page_id{fd, INVALID_PAGE_ID};
+        Page *page = bpm.new_page(&page_id);
+        ASSERT_NE(page, nullptr);
+        EXPECT_TRUE(page->is_dirty());
+        page->get_data()[0] = 'n';
+        bpm.unpin_page(page_id, false);
+        disk_manager_->read_page(fd, page_id.page_no, buf, PAGE_SIZE);
+        EXPECT_EQ(buf[0], 0);
+        bpm.flush_all_pages(fd);
+        disk_manager_->read_page(fd, page_id.page_no, buf, PAGE_SIZE);
+        EXPECT_EQ(buf[0], 'n');
+    }
+
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+TEST_F(DiskManagerTest, PageSize) {
+    const std::string filename = "PageSizeTestFile";
+    if (disk_manager_->is_file(filename)) {
+        disk_manager_->destroy_file(filename);
+    }
+    EXPECT_FALSE(BufferPoolManager::is_valid_page_size(6144));
+    EXPECT_FALSE(BufferPoolManager::is_valid_page_size(2 * MAX_PAGE_SIZE));
+    EXPECT_TRUE(BufferPoolManager::is_valid_page_size(16384));
+
+    LogManager log_manager(disk_manager_.get());
+    BufferPoolManager bpm(64, disk_manager_.get(), &log_manager, 4);
+    // 修改页面大小时buffer pool占用的内存不变
+    ASSERT_TRUE(bpm.set_page_size(16384));
+    EXPECT_EQ(PAGE_SIZE, 16384);
+    EXPECT_EQ(bpm.get_pool_size(), 16);
+
+    disk_manager_->create_file(filename);
+    int fd = disk_manager_->open_file(filename);
+    disk_manager_->set_fd2pageno(fd, 0);
+    for (int i = 0; i < 3; i++) {
+        PageId page_id{fd, INVALID_PAGE_ID};
+        Page *page = bpm.new_page(&page_id);
+        ASSERT_NE(page, nullptr);
+        memset(page->get_data(), 'a' + i, PAGE_SIZE);
+        bpm.unpin_page(page_id, true);
+    }
+    bpm.flush_all_pages(fd);
+    EXPECT_GE(disk_manager_->get_file_size(filename), 3 * 16384);
+    std::vector<char> buf(PAGE_SIZE);
+    disk_manager_->read_page(fd, 2, buf.data(), PAGE_SIZE);
+    EXPECT_EQ(buf[0], 'c');
+    EXPECT_EQ(buf[PAGE_SIZE - 1], 'c');
+
+    // buffer pool中还有页面时不能修改
+    EXPECT_FALSE(bpm.set_page_size(DEFAULT_PAGE_SIZE));
+    bpm.delete_all_pages(fd);
+    ASSERT_TRUE(bpm.set_page_size(DEFAULT_PAGE_SIZE));
+    EXPECT_EQ(bpm.get_pool_size(), 64);
+
+    disk_manager_->close_file(fd);
+    disk_manager_->destroy_file(filename);
+}
+
+TEST(BITMAP_TEST, WORD_SEARCH_TEST) {
+    std::mt19937 rng(0);
+    for (int max_n : {1, 7, 63, 64, 65, 200, 512, 1000}) {
+        for (int density : {0, 1, 50, 99, 100}) {
+            std::vector<char> bm((max_n + BITMAP_WIDTH - 1) / BITMAP_WIDTH + 1, 0);
+            for (int i = 0; i < max_n; i++) {
+                if (static_cast<int>(rng() % 100) < density) {
+                    Bitmap::set(bm.data(), i);
+                }
+            }
+            // 位图之后的字节不属于位图，不能影响结果
+            bm.back() = static_cast<char>(0xff);
+            std::vector<int> expected;
+            for (int i = 0; i < max_n; i++) {
+                if (Bitmap::is_set(bm.data(), i)) {
+                    expected.push_back(i);
+                }
+            }
+            EXPECT_EQ(Bitmap::count(bm.data(), max_n), static_cast<int>(expected.size()));
+            std::vector<int> positions(max_n);
+            int cnt = Bitmap::get_set_bits(bm.data(), max_n, positions.data());
+            positions.resize(cnt);
+            EXPECT_EQ(positions, expected);
+            for (int curr = -1; curr < max_n; curr++) {
+                for (bool bit : {false, true}) {
+                    int res = curr + 1;
+                    while (res < max_n && Bitmap::is_set(bm.data(), res) != bit) {
+                        res++;
+                    }
+                    ASSERT_EQ(Bitmap::next_bit(bit, bm.data(), max_n, curr), res);
+                }
+            }
+        }
+    }
+}
+
+TEST(PAGE_TABLE_TEST, RANDOM_TEST) {
+    const size_t max_entries = 4096;
+    PageTable page_table(max_entries);
+    std::unordered_map<PageId, frame_id_t> expected;
+    std::default_random_engine rng(0);
+    // fd<<16|page_no会冲突的页面号：超过65536页的文件与其他文件
+    std::uniform_int_distribution<int> fd_dist(3, 6);
+    std::uniform_int_distribution<int> page_dist(0, 200000);
+    for (int i = 0; i < 200000; i++) {
+        PageId page_id{fd_dist(rng), page_dist(rng) % 3 == 0 ? page_dist(rng) % 64 : page_dist(rng)};
+        if (expected.size() < max_entries && rng() % 2 == 0) {
+            frame_id_t frame_id = static_cast<frame_id_t>(rng() % max_entries);
+            page_table.insert(page_id, frame_id);
+            expected[page_id] = frame_id;
+        } else if (!expected.empty() && rng() % 4 != 0) {
+            // 删除一个已存在的页面
+            auto it = expected.begin();
+            EXPECT_TRUE(page_table.erase(it->first));
+            expected.erase(it);
+        } else {
+            EXPECT_EQ(page_table.erase(page_id), expected.erase(page_id) == 1);
+        }
+        EXPECT_EQ(page_table.size(), expected.size());
+    }
+    for (auto &entry : expected) {
+        frame_id_t frame_id;
+        ASSERT_TRUE(page_table.find(entry.first, &frame_id));
+        EXPECT_EQ(frame_id, entry.second);
+    }
+    frame_id_t frame_id;
+    EXPECT_FALSE(page_table.find(PageId{3, 1 << 20}, &frame_id));
+    EXPECT_FALSE((PageId{3, 0} < PageId{1, 1}));
+    EXPECT_NE(PageIdHash()(PageId{3, 65536}), PageIdHash()(PageId{4, 0}));
+}
+
 TEST(LRU_TEST, SAMPLE_TEST) {
     LRUReplacer lru_replacer(7);
 
@@ -269,3 +820,122 @@ TEST(LRU_TEST, Conc_Test) {
         EXPECT_EQ(0, lru_replacer->victim(&result));
     }
 }
+
+TEST(CLOCK_TEST, SAMPLE_TEST) {
+    ClockReplacer clock_replacer(7);
+
+    // Scenario: unpin six elements, i.e. add them to the replacer.
+    clock_replacer.unpin(1);
+    clock_replacer.unpin(2);
+    clock_replacer.unpin(3);
+    clock_replacer.unpin(4);
+    clock_replacer.unpin(5);
+    clock_replacer.unpin(6);
+    clock_replacer.unpin(1);
+    EXPECT_EQ(6, clock_replacer.Size());
+
+    // Scenario: get three victims from the clock.
+    int value;
+    clock_replacer.victim(&value);
+    EXPECT_EQ(1, value);
+    clock_replacer.victim(&value);
+    EXPECT_EQ(2, value);
+    clock_replacer.victim(&value);
+    EXPECT_EQ(3, value);
+
+    // Scenario: pin elements in the replacer.
+    // Note that 3 has already been victimized, so pinning 3 should have no effect.
+    clock_replacer.pin(3);
+    clock_replacer.pin(4);
+    EXPECT_EQ(2, clock_replacer.Size());
+
+    // Scenario: unpin 4. We expect that the reference bit of 4 will be set to 1.
+    clock_replacer.unpin(4);
+
+    // Scenario: continue looking for victims. 4 gets a second chance.
+    clock_replacer.victim(&value);
+    EXPECT_EQ(5, value);
+    clock_replacer.victim(&value);
+    EXPECT_EQ(6, value);
+    clock_replacer.victim(&value);
+    EXPECT_EQ(4, value);
+    EXPECT_EQ(0, clock_replacer.Size());
+    EXPECT_FALSE(clock_replacer.victim(&value));
+}
+
+TEST(CLOCK_TEST, CONCURRENT_TEST) {
+    const int num_frames = 1024;
+    const int num_threads = 4;
+    ClockReplacer clock_replacer(num_frames);
+    std::vector<std::thread> threads;
+    // 每个线程负责一段互不相交的frame，反复unpin/victim/pin
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&clock_replacer, t]() {
+            int per_thread = num_frames / num_threads;
+            for (int round = 0; round < 100; round++) {
+                for (int i = 0; i < per_thread; i++) {
+                    clock_replacer.unpin(t * per_thread + i);
+                }
+                for (int i = 0; i < per_thread / 2; i++) {
+                    clock_replacer.pin(t * per_thread + i);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(num_frames / 2, clock_replacer.Size());
+    std::vector<bool> evicted(num_frames, false);
+    int value;
+    while (clock_replacer.victim(&value)) {
+        EXPECT_FALSE(evicted[value]);
+        EXPECT_GE(value % (num_frames / num_threads), num_frames / num_threads / 2);
+        evicted[value] = true;
+    }
+    EXPECT_EQ(0, clock_replacer.Size());
+}
+
+TEST(LRUK_TEST, SCAN_RESISTANCE_TEST) {
+    LRUKReplacer lruk_replacer(8, 2, 2);
+    auto access = [&lruk_replacer](int frame_id) {
+        lruk_replacer.pin(frame_id);
+        lruk_replacer.unpin(frame_id);
+    };
+
+    // Scenario: frames 0 and 1 are referenced twice, frames 2 and 3 once.
+    access(0);
+    access(1);
+    access(2);
+    access(3);
+    access(0);
+    access(1);
+
+    // Scenario: a scan touches frames 4..7, reading each page several times in a row.
+    // Back-to-back accesses are correlated and only count as one reference.
+    for (int frame_id = 4; frame_id < 8; frame_id++) {
+        access(frame_id);
+        access(frame_id);
+        access(frame_id);
+    }
+    EXPECT_EQ(8, lruk_replacer.Size());
+
+    // Scenario: frames referenced only once go first in LRU order, then the re-referenced ones.
+    int value;
+    for (int expected : {2, 3, 4, 5, 6, 7, 0, 1}) {
+        EXPECT_TRUE(lruk_replacer.victim(&value));
+        EXPECT_EQ(expected, value);
+    }
+    EXPECT_FALSE(lruk_replacer.victim(&value));
+
+    // Scenario: a victimized frame starts with an empty history.
+    access(0);
+    access(1);
+    access(1);
+    lruk_replacer.pin(2);
+    lruk_replacer.unpin(2);
+    lruk_replacer.remove(2);
+    EXPECT_EQ(2, lruk_replacer.Size());
+    EXPECT_TRUE(lruk_replacer.victim(&value));
+    EXPECT_EQ(0, value);
+}